@@ -0,0 +1,98 @@
+/*
+ * Sprite One - RGB565 Color Display Demo
+ * Exercises the ST7789 PIO SPI + DMA backend with a native 16bpp
+ * framebuffer: draw into fb565 with the color primitives below, then
+ * hand the whole frame to DMA with flushAsyncColor() and keep
+ * composing the next one while it scans out. A full 240x240x16bpp
+ * refresh is ~14.7ms of wire time at 62.5MHz SPI with no CPU in the
+ * transfer.
+ *
+ * Wiring (defaults from sprite_display.h):
+ *   SCK=GP18  MOSI=GP19  DC=GP20  RST=GP21  CS=GP17
+ */
+
+#include "../sprite_one_unified/sprite_display.h"
+
+#define FB_W ST7789_WIDTH
+#define FB_H ST7789_HEIGHT
+
+// 112.5KB - the RP2040 fits exactly one full-color frame alongside a
+// sketch this size, so this demo single-buffers and relies on the DMA
+// flush being snapshot-free (draw only after flushBusy() clears).
+static uint16_t fb565[FB_W * FB_H];
+
+ST7789Display display;
+
+// ===== RGB565 drawing layer =====
+
+void fb565_clear(uint16_t color) {
+  for (uint32_t i = 0; i < (uint32_t)FB_W * FB_H; i++) fb565[i] = color;
+}
+
+void fb565_pixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= FB_W || y < 0 || y >= FB_H) return;
+  fb565[(uint32_t)y * FB_W + x] = color;
+}
+
+void fb565_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  int16_t x1 = x < 0 ? 0 : x;
+  int16_t y1 = y < 0 ? 0 : y;
+  int16_t x2 = (x + w > FB_W) ? FB_W : x + w;
+  int16_t y2 = (y + h > FB_H) ? FB_H : y + h;
+  for (int16_t j = y1; j < y2; j++) {
+    uint16_t* row = &fb565[(uint32_t)j * FB_W + x1];
+    for (int16_t i = x1; i < x2; i++) *row++ = color;
+  }
+}
+
+// ===== Demo animation =====
+
+struct Box {
+  int16_t x, y, dx, dy;
+  uint16_t color;
+};
+
+Box boxes[4];
+
+void setup() {
+  Serial.begin(115200);
+  delay(2000);
+
+  Serial.println("Sprite One RGB565 demo (ST7789 via PIO SPI + DMA)");
+  if (!display.init()) {
+    Serial.println("Display init failed (not RP2040?)");
+    while (true) delay(1000);
+  }
+
+  boxes[0] = {  10,  10,  3,  2, st7789_color565(255,  64,  64) };
+  boxes[1] = { 180,  40, -2,  3, st7789_color565( 64, 255,  64) };
+  boxes[2] = {  60, 160,  2, -3, st7789_color565( 64,  64, 255) };
+  boxes[3] = { 120,  90, -3, -2, st7789_color565(255, 255,  64) };
+}
+
+void loop() {
+  uint32_t t0 = micros();
+
+  // Compose the next frame - the previous one may still be on the wire,
+  // so wait for DMA to release the buffer first (single-buffered demo)
+  while (display.flushBusy()) tight_loop_contents();
+
+  fb565_clear(st7789_color565(8, 8, 24));
+  for (int i = 0; i < 4; i++) {
+    Box& b = boxes[i];
+    b.x += b.dx; b.y += b.dy;
+    if (b.x < 0 || b.x > FB_W - 40) b.dx = -b.dx;
+    if (b.y < 0 || b.y > FB_H - 40) b.dy = -b.dy;
+    fb565_rect(b.x, b.y, 40, 40, b.color);
+  }
+
+  uint32_t t_draw = micros() - t0;
+  display.flushAsyncColor(fb565);
+
+  static uint32_t frames = 0;
+  if (++frames % 100 == 0) {
+    Serial.printf("frame %lu: draw=%luus (flush runs in background)\n",
+                  frames, t_draw);
+  }
+  delay(16);  // ~60Hz pacing
+}
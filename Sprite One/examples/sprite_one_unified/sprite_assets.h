@@ -0,0 +1,169 @@
+/*
+ * sprite_assets.h
+ * Flash-resident sprite asset store with LRU RAM cache
+ * CMD_STORE_FLASH persists sprite art to LittleFS so the host no
+ * longer re-uploads every bitmap on boot; CMD_LOAD_SPRITE binds a
+ * stored asset to a sprite slot. Hot assets composite out of a small
+ * LRU cache in SRAM; cold ones are paged in from flash on first use.
+ * Uploads may be RLE-compressed (pairs of [count][value] - 1bpp art
+ * is mostly runs of 0x00/0xFF); assets are stored decoded so a cache
+ * fill is a single read.
+ */
+
+#ifndef SPRITE_ASSETS_H
+#define SPRITE_ASSETS_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "sprite_engine.h"
+
+// Asset upload formats
+#define ASSET_FMT_RAW  0
+#define ASSET_FMT_RLE  1
+
+// Cache geometry: 8 slots x 128 bytes covers eight 32x32 1bpp assets
+// (~1.1KB SRAM). Eviction is LRU, skipping slots a live sprite still
+// composites from.
+#define ASSET_CACHE_SLOTS 8
+#define ASSET_MAX_BYTES   128
+
+class SpriteAssetStore {
+private:
+  struct AssetSlot {
+    bool valid;
+    uint8_t id;
+    uint8_t w, h;
+    uint16_t size;
+    uint32_t last_used;
+    uint8_t data[ASSET_MAX_BYTES] __attribute__((aligned(4)));
+  };
+
+  AssetSlot slots[ASSET_CACHE_SLOTS];
+  uint32_t use_clock;       // Monotonic LRU counter
+  SpriteEngine* engine;     // For eviction pinning
+
+  void assetPath(char* out, size_t out_len, uint8_t id) {
+    snprintf(out, out_len, "/sprites/%02X.spr", id);
+  }
+
+  int8_t findSlot(uint8_t id) {
+    for (uint8_t i = 0; i < ASSET_CACHE_SLOTS; i++) {
+      if (slots[i].valid && slots[i].id == id) return i;
+    }
+    return -1;
+  }
+
+  // Pick the least-recently-used slot whose bitmap no sprite is still
+  // rendering from (evicting those would leave dangling pointers in
+  // the compositor). Returns -1 when everything is pinned.
+  int8_t evictSlot() {
+    int8_t best = -1;
+    for (uint8_t i = 0; i < ASSET_CACHE_SLOTS; i++) {
+      if (!slots[i].valid) return i;
+      if (engine && engine->usesData(slots[i].data)) continue;
+      if (best < 0 || slots[i].last_used < slots[best].last_used) best = i;
+    }
+    return best;
+  }
+
+  // Decode [count][value] run pairs. Returns decoded size, 0 on error.
+  static uint16_t rleDecode(const uint8_t* src, uint16_t src_len,
+                            uint8_t* dst, uint16_t dst_max) {
+    uint16_t out = 0;
+    for (uint16_t i = 0; i + 1 < src_len; i += 2) {
+      uint8_t count = src[i];
+      if (count == 0 || out + count > dst_max) return 0;
+      memset(dst + out, src[i + 1], count);
+      out += count;
+    }
+    return out;
+  }
+
+public:
+  SpriteAssetStore() : use_clock(0), engine(nullptr) {
+    memset(slots, 0, sizeof(slots));
+  }
+
+  void begin(SpriteEngine* eng) {
+    engine = eng;
+    if (!LittleFS.exists("/sprites")) LittleFS.mkdir("/sprites");
+  }
+
+  // Persist an asset. Data is decoded (if RLE) and written to flash as
+  // [w][h][size u16 LE][bitmap]; a stale cache entry is dropped.
+  bool store(uint8_t id, uint8_t w, uint8_t h, uint8_t fmt,
+             const uint8_t* data, uint16_t len) {
+    uint16_t expect = ((uint16_t)w * h + 7) / 8;
+    if (expect == 0 || expect > ASSET_MAX_BYTES) return false;
+
+    static uint8_t decoded[ASSET_MAX_BYTES];
+    const uint8_t* bitmap = data;
+    if (fmt == ASSET_FMT_RLE) {
+      if (rleDecode(data, len, decoded, sizeof(decoded)) != expect) return false;
+      bitmap = decoded;
+    } else if (fmt == ASSET_FMT_RAW) {
+      if (len < expect) return false;
+    } else {
+      return false;
+    }
+
+    char path[24];
+    assetPath(path, sizeof(path), id);
+    File f = LittleFS.open(path, "w");
+    if (!f) return false;
+    uint8_t hdr[4] = { w, h, (uint8_t)(expect & 0xFF), (uint8_t)(expect >> 8) };
+    bool ok = f.write(hdr, 4) == 4 && f.write(bitmap, expect) == expect;
+    f.close();
+    if (!ok) { LittleFS.remove(path); return false; }
+
+    int8_t idx = findSlot(id);
+    if (idx >= 0) slots[idx].valid = false;  // Re-fault on next get()
+    return true;
+  }
+
+  // Fetch an asset, faulting it into the cache from flash on a miss.
+  // The returned pointer stays valid while a sprite references it (the
+  // evictor skips pinned slots).
+  const uint8_t* get(uint8_t id, uint8_t* w, uint8_t* h) {
+    int8_t idx = findSlot(id);
+    if (idx < 0) {
+      idx = evictSlot();
+      if (idx < 0) return nullptr;  // All slots pinned by live sprites
+
+      char path[24];
+      assetPath(path, sizeof(path), id);
+      File f = LittleFS.open(path, "r");
+      if (!f) return nullptr;
+      uint8_t hdr[4];
+      if (f.read(hdr, 4) != 4) { f.close(); return nullptr; }
+      uint16_t size = hdr[2] | ((uint16_t)hdr[3] << 8);
+      if (size == 0 || size > ASSET_MAX_BYTES ||
+          f.read(slots[idx].data, size) != size) {
+        f.close();
+        slots[idx].valid = false;
+        return nullptr;
+      }
+      f.close();
+      slots[idx].valid = true;
+      slots[idx].id = id;
+      slots[idx].w = hdr[0];
+      slots[idx].h = hdr[1];
+      slots[idx].size = size;
+    }
+
+    slots[idx].last_used = ++use_clock;
+    if (w) *w = slots[idx].w;
+    if (h) *h = slots[idx].h;
+    return slots[idx].data;
+  }
+
+  bool remove(uint8_t id) {
+    int8_t idx = findSlot(id);
+    if (idx >= 0) slots[idx].valid = false;
+    char path[24];
+    assetPath(path, sizeof(path), id);
+    return LittleFS.remove(path);
+  }
+};
+
+#endif // SPRITE_ASSETS_H
@@ -11,64 +11,89 @@
 
 #include <Arduino.h>
 
-// Command queue entry
+#ifdef ARDUINO_ARCH_RP2040
+#include "hardware/sync.h"
+// Real data barrier + SEV/WFE doorbell between the cores. A compiler
+// fence only orders the instruction stream; DMB orders the actual
+// stores so Core 1 never sees an index move before the payload bytes.
+#define QUEUE_DMB()  __dmb()
+#define QUEUE_SEV()  __sev()
+#define QUEUE_WFE()  __wfe()
+#else
+#define QUEUE_DMB()  asm volatile("" ::: "memory")
+#define QUEUE_SEV()
+#define QUEUE_WFE()
+#endif
+
+// Command queue entry (pop target - the ring itself is variable-length)
 struct CommandQueueEntry {
   uint8_t cmd;
   uint8_t len;
-  uint8_t payload[64];
+  uint8_t payload[255];
 };
 
-// Lock-free ring buffer (single producer, single consumer)
-template<int SIZE>
+// Lock-free SPSC byte ring (single producer, single consumer).
+// Records are length-prefixed - [cmd][len][payload] - so a 3-byte
+// CMD_PIXEL costs 5 ring bytes instead of a fixed 64-byte slot, and a
+// full 255-byte payload fits in the same structure. Indices free-run
+// and are masked on access; SIZE_BYTES must be a power of two.
+template<uint32_t SIZE_BYTES>
 class CommandQueue {
 private:
-  volatile CommandQueueEntry queue[SIZE];
-  volatile uint32_t head;  // Write index (Core 0)
-  volatile uint32_t tail;  // Read index (Core 1)
+  uint8_t buf[SIZE_BYTES];
+  volatile uint32_t head;  // Write index (Core 0), free-running
+  volatile uint32_t tail;  // Read index (Core 1), free-running
+  
+  static inline uint32_t wrap(uint32_t i) { return i & (SIZE_BYTES - 1); }
   
 public:
   CommandQueue() : head(0), tail(0) {}
   
   // Enqueue (called from Core 0)
   bool push(uint8_t cmd, const uint8_t* payload, uint8_t len) {
-    uint32_t next = (head + 1) % SIZE;
-    if (next == tail) return false;  // Queue full
+    uint32_t h = head;
+    uint32_t used = h - tail;
+    if (SIZE_BYTES - used < (uint32_t)(2 + len)) return false;  // Queue full
     
-   queue[head].cmd = cmd;
-    queue[head].len = len;
-    if (len > 0 && payload) {
-      memcpy((void*)queue[head].payload, payload, min(len, 64));
+    buf[wrap(h++)] = cmd;
+    buf[wrap(h++)] = len;
+    for (uint8_t i = 0; i < len; i++) {
+      buf[wrap(h++)] = payload[i];
     }
     
-    asm volatile("" ::: "memory");  // Compiler barrier
-    head = next;
+    QUEUE_DMB();    // Record bytes land before the index moves
+    head = h;
+    QUEUE_SEV();    // Doorbell: wake Core 1 out of WFE
     return true;
   }
   
   // Dequeue (called from Core 1)
   bool pop(CommandQueueEntry* out) {
     if (tail == head) return false;  // Queue empty
+    QUEUE_DMB();    // Index observed before the record bytes are read
     
-    out->cmd = queue[tail].cmd;
-    out->len = queue[tail].len;
-    memcpy(out->payload, (void*)queue[tail].payload, queue[tail].len);
+    uint32_t t = tail;
+    out->cmd = buf[wrap(t++)];
+    uint8_t len = buf[wrap(t++)];
+    out->len = len;
+    for (uint8_t i = 0; i < len; i++) {
+      out->payload[i] = buf[wrap(t++)];
+    }
     
-    asm volatile("" ::: "memory");  // Compiler barrier
-    tail = (tail + 1) % SIZE;
+    QUEUE_DMB();    // Fully consumed before the space is recycled
+    tail = t;
     return true;
   }
   
-  uint32_t count() const {
-    if (head >= tail) return head - tail;
-    return SIZE - (tail - head);
-  }
+  uint32_t bytesUsed() const { return head - tail; }
   
   bool isEmpty() const { return head == tail; }
-  bool isFull() const { return ((head + 1) % SIZE) == tail; }
+  bool isFull() const { return SIZE_BYTES - (head - tail) < 2 + 255; }
 };
 
-// Global command queue (16 entries max)
-static CommandQueue<16> cmd_queue;
+// Global command queue (1KB ring - same SRAM as ~15 of the old fixed
+// slots, but holds hundreds of small drawing commands)
+static CommandQueue<1024> cmd_queue;
 
 // Response queue (Core 1 -> Core 0)
 struct ResponseEntry {
@@ -94,13 +119,14 @@ public:
     if (next == tail) return false;
     
     queue[head] = *resp;
-    asm volatile("" ::: "memory");
+    QUEUE_DMB();
     head = next;
     return true;
   }
   
   bool pop(ResponseEntry* out) {
     if (tail == head) return false;
+    QUEUE_DMB();
     
     // Copy from volatile queue element-by-element
     out->cmd = queue[tail].cmd;
@@ -108,7 +134,7 @@ public:
     out->len = queue[tail].len;
     memcpy(out->data, (void*)queue[tail].data, queue[tail].len);
     
-    asm volatile("" ::: "memory");
+    QUEUE_DMB();
     tail = (tail + 1) % SIZE;
     return true;
   }
@@ -267,10 +293,12 @@ inline void core1_loop() {
     } else {
       // Idle - count free cycles for performance monitoring
       core1_flags.free_cycles++;
+      // Sleep until Core 0 rings the doorbell. push() issues SEV after
+      // moving the index, and WFE falls straight through if the event
+      // register is already set, so a push racing this spot is not
+      // lost - wakeup is a few cycles instead of a 10us poll tick.
+      QUEUE_WFE();
     }
-    
-    // Small delay to prevent busy-waiting
-    delayMicroseconds(10);
   }
 }
 
@@ -1,8 +1,10 @@
 /*
  * sprite_dynamic.h
  * The "Universal Adaptor" for Sprite One
- * Dynamically constructs AIfES models from binary `.aif32` files (V3 Format)
+ * Dynamically constructs AIfES models from binary `.aif32` files (V3/V4 Format)
  * Includes on-device training (Backprop) support.
+ * V4 carries int8 (Q7) weights plus per-layer quantization params for
+ * integer-only inference on the FPU-less M0+.
  */
 
 #ifndef SPRITE_DYNAMIC_H
@@ -14,6 +16,7 @@
 #define MODEL_MAGIC 0x54525053 // "SPRT"
 #define MODEL_VERSION_V2 2
 #define MODEL_VERSION_V3 3
+#define MODEL_VERSION_V4 4     // Q7 quantized (int8 weights, int32 bias)
 
 // Struct for the file header (Legacy V2)
 struct DynamicModelHeader {
@@ -62,13 +65,42 @@ struct LayerDescriptor {
     uint16_t reserved; 
 };
 
-#define MAX_ARENA_SIZE (80 * 1024) 
+// V4 per-layer quantization record (8 bytes), one per descriptor entry.
+// Sits between the descriptor table and the weight blob.
+// For INPUT the result params describe how the host quantized the inputs;
+// for DENSE the weights are symmetric Q7 (zero_point 0) and the bias is
+// stored as int32 in Q(bias_shift).
+struct LayerQuantDescriptor {
+    uint16_t result_shift;
+    int8_t   result_zero;
+    uint8_t  weights_shift;
+    uint16_t bias_shift;
+    uint16_t reserved;
+};
+
+#define MAX_ARENA_SIZE (80 * 1024)
+
+// Arena allocation tags - every arena_alloc() is charged to one of these
+// so a full arena can be diagnosed (CMD_MEM_STATS) instead of guessed at.
+#define ARENA_TAG_WEIGHTS  0  // Weight/bias blobs copied into RAM
+#define ARENA_TAG_LAYERS   1  // Layer structs and quantization params
+#define ARENA_TAG_TRAINING 2  // Adam state + gradient scratch
+#define ARENA_TAG_SCRATCH  3  // Inference intermediate tensors
+#define ARENA_TAG_COUNT    4
 
 class DynamicModel {
 private:
     static uint8_t arena[MAX_ARENA_SIZE];
     size_t arena_head;
 
+    // Per-tag accounting plus the worst case seen since boot. The high
+    // water mark and failure record deliberately survive reset() so a
+    // field unit can still tell us what blew the budget after a reload.
+    size_t tag_used[ARENA_TAG_COUNT];
+    static size_t arena_high_water;
+    size_t fail_size;   // Request size of the most recent failed alloc
+    uint8_t fail_tag;   // ...and the tag that made it (0xFF = none yet)
+
     aimodel_t model;
     
     // Model shape tracking
@@ -83,15 +115,35 @@ private:
     void* training_memory;
     bool is_training_ready;
 
-    void* arena_alloc(size_t size) {
+    // Q7 path (V4 models): inference-only, 4x smaller weights
+    bool model_is_q7;
+    aimath_q7_params_t* input_q_params;
+
+    // Zero-copy mode: weights stay in the caller's buffer (typically
+    // memory-mapped XIP flash) instead of being copied into the arena.
+    bool weights_in_place;
+    const uint8_t* src_file;
+    size_t src_len;
+
+    // Persistent inference scratch, planned once per load
+    void* inference_memory;
+    size_t inference_memory_size;
+
+    void* arena_alloc(size_t size, uint8_t tag = ARENA_TAG_LAYERS) {
         size_t aligned_size = (size + 3) & ~3;
-        if (arena_head + aligned_size > MAX_ARENA_SIZE) return nullptr;
+        if (arena_head + aligned_size > MAX_ARENA_SIZE) {
+            fail_size = size;
+            fail_tag = tag;
+            return nullptr;
+        }
         void* ptr = &arena[arena_head];
         arena_head += aligned_size;
+        tag_used[tag] += aligned_size;
+        if (arena_head > arena_high_water) arena_high_water = arena_head;
         return ptr;
     }
 
-    bool loadV3(const uint8_t* file_data, size_t file_len) {
+    bool loadV3(const uint8_t* file_data, size_t file_len, bool copy_weights) {
         const DynamicModelHeaderV3* hdr = (const DynamicModelHeaderV3*)file_data;
         uint16_t num_layers = hdr->layer_count;
         const LayerDescriptor* descriptors = (const LayerDescriptor*)(file_data + 32);
@@ -100,10 +152,18 @@ private:
         
         if (32 + descriptors_size + hdr->total_weights_size > file_len) return false;
 
-        void* weights_store = arena_alloc(hdr->total_weights_size);
-        if (!weights_store) return false;
-        memcpy(weights_store, weights_src, hdr->total_weights_size);
-        uint8_t* weights_curr = (uint8_t*)weights_store;
+        uint8_t* weights_curr;
+        if (!copy_weights && (((uintptr_t)weights_src & 3) == 0)) {
+            // Zero-copy: reference the (flash-resident) file image directly.
+            // Inference only reads weights, so no arena copy is needed.
+            weights_curr = (uint8_t*)weights_src;
+            weights_in_place = true;
+        } else {
+            void* weights_store = arena_alloc(hdr->total_weights_size, ARENA_TAG_WEIGHTS);
+            if (!weights_store) return false;
+            memcpy(weights_store, weights_src, hdr->total_weights_size);
+            weights_curr = (uint8_t*)weights_store;
+        }
 
         ailayer_t* prev = nullptr;
         uint16_t current_shape[3] = {0, 0, 0}; // C, H, W
@@ -142,6 +202,7 @@ private:
                 uint16_t neurons = desc->param1;
                 *d = AILAYER_DENSE_F32_A(neurons);
                 prev = ailayer_dense_f32_default(d, prev);
+                d->linear = SpriteMatvec::linear_f32; // Fork/join forward
                 
                 uint16_t in_dim = is_flat ? current_shape[0] : (current_shape[0] * current_shape[1] * current_shape[2]);
                 size_t w_size = in_dim * neurons * sizeof(float);
@@ -223,27 +284,201 @@ private:
         model.output_layer = prev;
         output_shape[0] = 1;
         output_shape[1] = is_flat ? current_shape[0] : (current_shape[0]*current_shape[1]*current_shape[2]);
-        return true; 
+        return true;
+    }
+
+    // V4: same descriptor walk as loadV3, but builds Q7 layers from int8
+    // weights. A quantization table (one LayerQuantDescriptor per layer)
+    // sits between the descriptors and the weight blob. Flat (dense)
+    // topologies only - Conv2D models stay on the F32/V3 path.
+    bool loadV4(const uint8_t* file_data, size_t file_len, bool copy_weights) {
+        const DynamicModelHeaderV3* hdr = (const DynamicModelHeaderV3*)file_data;
+        uint16_t num_layers = hdr->layer_count;
+        const LayerDescriptor* descriptors = (const LayerDescriptor*)(file_data + 32);
+        size_t descriptors_size = num_layers * sizeof(LayerDescriptor);
+        const LayerQuantDescriptor* quants = (const LayerQuantDescriptor*)(file_data + 32 + descriptors_size);
+        size_t quants_size = num_layers * sizeof(LayerQuantDescriptor);
+        const uint8_t* weights_src = file_data + 32 + descriptors_size + quants_size;
+
+        if (32 + descriptors_size + quants_size + hdr->total_weights_size > file_len) return false;
+
+        uint8_t* weights_curr;
+        if (!copy_weights && (((uintptr_t)weights_src & 3) == 0)) {
+            weights_curr = (uint8_t*)weights_src;
+            weights_in_place = true;
+        } else {
+            void* weights_store = arena_alloc(hdr->total_weights_size, ARENA_TAG_WEIGHTS);
+            if (!weights_store) return false;
+            memcpy(weights_store, weights_src, hdr->total_weights_size);
+            weights_curr = (uint8_t*)weights_store;
+        }
+
+        ailayer_t* prev = nullptr;
+        uint16_t current_dim = 0;
+
+        for (int i=0; i<num_layers; i++) {
+            const LayerDescriptor* desc = &descriptors[i];
+            const LayerQuantDescriptor* q = &quants[i];
+
+            if (desc->type == LAYER_TYPE_INPUT) {
+                ailayer_input_q7_t* input_layer = (ailayer_input_q7_t*)arena_alloc(sizeof(ailayer_input_q7_t));
+                aimath_q7_params_t* in_p = (aimath_q7_params_t*)arena_alloc(sizeof(aimath_q7_params_t));
+                if (!input_layer || !in_p) return false;
+
+                in_p->shift = q->result_shift;
+                in_p->zero_point = q->result_zero;
+                input_q_params = in_p;
+
+                input_shape[0] = 1; input_shape[1] = desc->param1;
+                input_dim = 2;
+                *input_layer = AILAYER_INPUT_Q7_M(2, input_shape, in_p);
+                model.input_layer = ailayer_input_q7_default(input_layer);
+                prev = (ailayer_t*)model.input_layer;
+                current_dim = desc->param1;
+
+            } else if (desc->type == LAYER_TYPE_DENSE) {
+                ailayer_dense_q7_t* d = (ailayer_dense_q7_t*)arena_alloc(sizeof(ailayer_dense_q7_t));
+                aimath_q7_params_t* res_p = (aimath_q7_params_t*)arena_alloc(sizeof(aimath_q7_params_t));
+                aimath_q7_params_t* w_p = (aimath_q7_params_t*)arena_alloc(sizeof(aimath_q7_params_t));
+                aimath_q31_params_t* b_p = (aimath_q31_params_t*)arena_alloc(sizeof(aimath_q31_params_t));
+                if (!d || !res_p || !w_p || !b_p) return false;
+
+                uint16_t neurons = desc->param1;
+                *d = AILAYER_DENSE_Q7_A(neurons);
+
+                res_p->shift = q->result_shift;
+                res_p->zero_point = q->result_zero;
+                w_p->shift = q->weights_shift;
+                w_p->zero_point = 0;          // Symmetric weight quantization
+                b_p->shift = q->bias_shift;
+                b_p->zero_point = 0;
+
+                d->base.result.tensor_params = res_p;
+                d->weights.tensor_params = w_p;
+                d->bias.tensor_params = b_p;
+
+                // Blob layout per dense layer: int8 weights (padded to 4), int32 bias
+                size_t w_size = (size_t)current_dim * neurons;
+                d->weights.data = weights_curr; weights_curr += (w_size + 3) & ~3;
+                d->bias.data    = weights_curr; weights_curr += neurons * sizeof(int32_t);
+
+                prev = ailayer_dense_q7_default(d, prev);
+                current_dim = neurons;
+
+            } else if (desc->type == LAYER_TYPE_RELU) {
+                ailayer_relu_q7_t* r = (ailayer_relu_q7_t*)arena_alloc(sizeof(ailayer_relu_q7_t));
+                if (!r) return false;
+                *r = AILAYER_RELU_Q7_A();
+                prev = ailayer_relu_q7_default(r, prev);
+
+            } else if (desc->type == LAYER_TYPE_SIGMOID) {
+                ailayer_sigmoid_q7_t* s = (ailayer_sigmoid_q7_t*)arena_alloc(sizeof(ailayer_sigmoid_q7_t));
+                if (!s) return false;
+                *s = AILAYER_SIGMOID_Q7_A();
+                prev = ailayer_sigmoid_q7_default(s, prev);
+
+            } else if (desc->type == LAYER_TYPE_SOFTMAX) {
+                ailayer_softmax_q7_t* s = (ailayer_softmax_q7_t*)arena_alloc(sizeof(ailayer_softmax_q7_t));
+                if (!s) return false;
+                *s = AILAYER_SOFTMAX_Q7_A();
+                prev = ailayer_softmax_q7_default(s, prev);
+
+            } else {
+                return false; // Layer type not supported on the Q7 path
+            }
+        }
+
+        model.output_layer = prev;
+        output_shape[0] = 1;
+        output_shape[1] = current_dim;
+        model_is_q7 = true;
+        return true;
     }
 
 public:
-    DynamicModel() : arena_head(0), training_memory(nullptr), is_training_ready(false) {}
-    
+    // Checkpoint of the arena (head + tag accounting). Take one before a
+    // burst of allocations that may need undoing, hand it back to
+    // arena_release() - no more raw arena_head rewinds at call sites.
+    struct ArenaScope {
+        size_t head;
+        size_t used[ARENA_TAG_COUNT];
+    };
+
+    ArenaScope arena_mark() {
+        ArenaScope s;
+        s.head = arena_head;
+        memcpy(s.used, tag_used, sizeof(tag_used));
+        return s;
+    }
+
+    void arena_release(const ArenaScope& s) {
+        arena_head = s.head;
+        memcpy(tag_used, s.used, sizeof(tag_used));
+    }
+
+private:
+    // Arena state just before prepare_training() allocated, so
+    // release_training() can hand the Adam/gradient space back without
+    // reloading the whole model.
+    ArenaScope training_scope;
+
+public:
+    DynamicModel() : arena_head(0), training_memory(nullptr), is_training_ready(false),
+                     model_is_q7(false), input_q_params(nullptr),
+                     weights_in_place(false), src_file(nullptr), src_len(0),
+                     inference_memory(nullptr), inference_memory_size(0),
+                     fail_size(0), fail_tag(0xFF) {
+        memset(tag_used, 0, sizeof(tag_used));
+    }
+
     void reset() {
         arena_head = 0;
+        memset(tag_used, 0, sizeof(tag_used));
         model.input_layer = nullptr;
         training_memory = nullptr;
         is_training_ready = false;
+        model_is_q7 = false;
+        input_q_params = nullptr;
+        weights_in_place = false;
+        src_file = nullptr;
+        src_len = 0;
+        inference_memory = nullptr;
+        inference_memory_size = 0;
+    }
+
+    // Plan the inference memory once, right after the graph is built.
+    // The topology cannot change between loads, so infer() is spared the
+    // per-call rescheduling (and the old hardcoded 4096-byte guess is
+    // replaced by the exact size AIfES reports).
+    bool schedule_inference() {
+        uint32_t size = aialgo_sizeof_inference_memory(&model);
+        inference_memory = arena_alloc(size, ARENA_TAG_SCRATCH);
+        if (!inference_memory) return false;
+        inference_memory_size = size;
+        aialgo_schedule_inference_memory(&model, inference_memory, size);
+        return true;
     }
 
-    bool load(const uint8_t* file_data, size_t file_len) {
+    // Load a model image. With copy_weights=false the weight blob is
+    // referenced in place (zero-copy) instead of being copied into the
+    // arena - valid as long as the caller keeps the buffer alive, and the
+    // natural mode for images sitting in memory-mapped XIP flash. Training
+    // needs writable weights, so prepare_training() transparently re-loads
+    // with a RAM copy.
+    bool load(const uint8_t* file_data, size_t file_len, bool copy_weights = true) {
         reset();
         if (file_len < 32) return false;
         const DynamicModelHeader* hdr = (const DynamicModelHeader*)file_data;
         if (hdr->magic != MODEL_MAGIC) return false;
-        
+
+        src_file = file_data;
+        src_len = file_len;
+
         if (hdr->version == MODEL_VERSION_V3) {
-            return loadV3(file_data, file_len);
+            return loadV3(file_data, file_len, copy_weights) && schedule_inference();
+        }
+        if (hdr->version == MODEL_VERSION_V4) {
+            return loadV4(file_data, file_len, copy_weights) && schedule_inference();
         }
         
         // V2 Fallback (Fixed Sentinel topology)
@@ -268,9 +503,11 @@ public:
         x = ailayer_relu_f32_default(r1, x);
         x = ailayer_dense_f32_default(d2, x);
         model.output_layer = ailayer_softmax_f32_default(sm, x);
+        d1->linear = SpriteMatvec::linear_f32; // 128x128 - the fork payoff
+        d2->linear = SpriteMatvec::linear_f32;
         
         size_t w_size = (128*128 + 128 + 128*5 + 5)*sizeof(float);
-        void* w_store = arena_alloc(w_size);
+        void* w_store = arena_alloc(w_size, ARENA_TAG_WEIGHTS);
         if (!w_store) return false;
         memcpy(w_store, weights_ptr, w_size);
         
@@ -280,19 +517,25 @@ public:
         d2->weights.data = (float*)curr; curr += 128*5*4;
         d2->bias.data    = (float*)curr; curr += 5*4;
         
-        return true; 
+        return schedule_inference();
     }
 
     bool prepare_training(float learning_rate = 0.01f) {
         if (!model.input_layer) return false;
+        if (model_is_q7) return false; // Q7 models are inference-only
+        if (weights_in_place) {
+            // Weights live in read-only flash; migrate to a RAM copy first
+            if (!src_file || !load(src_file, src_len, true)) return false;
+        }
         adam_opti = AIOPTI_ADAM_F32(learning_rate, 0.9f, 0.999f, 1e-7f);
         optimizer = aiopti_adam_f32_default(&adam_opti);
         model.loss = ailoss_mse_f32_default(&mse_loss, model.output_layer);
-        
+
+        training_scope = arena_mark();
         uint32_t memory_size = aialgo_sizeof_training_memory(&model, optimizer);
-        training_memory = arena_alloc(memory_size);
+        training_memory = arena_alloc(memory_size, ARENA_TAG_TRAINING);
         if (!training_memory) return false;
-        
+
         aialgo_schedule_training_memory(&model, optimizer, training_memory, memory_size);
         aialgo_init_model_for_training(&model, optimizer);
         is_training_ready = true;
@@ -310,26 +553,67 @@ public:
     }
 
     float* infer(float* input_data) {
-        size_t scratch_size = 4096;
-        void* scratch_mem = arena_alloc(scratch_size);
-        if (!scratch_mem) return nullptr;
-        aialgo_schedule_inference_memory(&model, scratch_mem, scratch_size);
-        
-        aitensor_t in_tensor = AITENSOR_2D_F32(input_shape, input_data);
+        if (!inference_memory) return nullptr; // Planned at load()
+
         static float output_buffer[128];
-        aitensor_t out_tensor = AITENSOR_2D_F32(output_shape, output_buffer);
-        
-        aialgo_inference_model(&model, &in_tensor, &out_tensor);
-        arena_head = (uint8_t*)scratch_mem - arena;
+
+        if (model_is_q7) {
+            // Quantize inputs, run integer-only, de-quantize outputs
+            static int8_t q_in[256];
+            static int8_t q_out[128];
+            uint16_t n_in = min((uint16_t)256, get_input_count());
+            for (uint16_t i = 0; i < n_in; i++) {
+                q_in[i] = FLOAT_TO_Q7(input_data[i], input_q_params->shift, input_q_params->zero_point);
+            }
+            aitensor_t in_tensor = AITENSOR_2D_Q7(input_shape, input_q_params, q_in);
+            aimath_q7_params_t* out_p = (aimath_q7_params_t*)model.output_layer->result.tensor_params;
+            aitensor_t out_tensor = AITENSOR_2D_Q7(output_shape, out_p, q_out);
+
+            aialgo_inference_model(&model, &in_tensor, &out_tensor);
+
+            uint16_t n_out = min((uint16_t)128, get_output_count());
+            for (uint16_t i = 0; i < n_out; i++) {
+                output_buffer[i] = Q7_TO_FLOAT(q_out[i], out_p->shift, out_p->zero_point);
+            }
+        } else {
+            aitensor_t in_tensor = AITENSOR_2D_F32(input_shape, input_data);
+            aitensor_t out_tensor = AITENSOR_2D_F32(output_shape, output_buffer);
+            aialgo_inference_model(&model, &in_tensor, &out_tensor);
+        }
+
         return output_buffer;
     }
-    
+
+    // Drop the optimizer state and gradient scratch, returning the arena
+    // to its pre-prepare_training() shape. Inference keeps working; the
+    // next prepare_training() simply re-allocates.
+    void release_training() {
+        if (!is_training_ready) return;
+        arena_release(training_scope);
+        training_memory = nullptr;
+        is_training_ready = false;
+        model.loss = nullptr;
+    }
+
+    size_t get_inference_memory_size() { return inference_memory_size; }
+
+    // ===== Arena instrumentation (CMD_MEM_STATS) =====
+    size_t arena_used() { return arena_head; }
+    size_t arena_capacity() { return MAX_ARENA_SIZE; }
+    size_t arena_high_water_mark() { return arena_high_water; }
+    size_t arena_tag_used(uint8_t tag) { return (tag < ARENA_TAG_COUNT) ? tag_used[tag] : 0; }
+    size_t arena_last_fail_size() { return fail_size; }
+    uint8_t arena_last_fail_tag() { return fail_tag; }
+
     uint16_t get_input_count() { return (input_dim == 2) ? input_shape[1] : (input_shape[1]*input_shape[2]*input_shape[3]); }
     uint16_t get_output_count() { return output_shape[1]; }
     bool is_training() { return is_training_ready; }
     bool is_loaded() { return model.input_layer != nullptr; }
+    bool is_q7() { return model_is_q7; }
+    bool is_zero_copy() { return weights_in_place; }
 };
 
 uint8_t DynamicModel::arena[MAX_ARENA_SIZE];
+size_t DynamicModel::arena_high_water = 0;
 
 #endif // SPRITE_DYNAMIC_H
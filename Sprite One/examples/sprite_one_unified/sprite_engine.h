@@ -13,6 +13,7 @@
 #define SPRITE_FLAG_VISIBLE  0x01
 #define SPRITE_FLAG_FLIP_H   0x02
 #define SPRITE_FLAG_FLIP_V   0x04
+#define SPRITE_FLAG_OPAQUE   0x08  // Overwrite background (0-bits clear) instead of OR-transparent
 
 // Sprite structure
 struct Sprite {
@@ -25,11 +26,22 @@ struct Sprite {
 };
 
 // Sprite Engine
+// Dirty rectangle (inclusive bounds)
+struct SpriteDirtyRect {
+  int16_t x1, y1, x2, y2;
+};
+
 class SpriteEngine {
 private:
   Sprite sprites[MAX_SPRITES];
   uint8_t sprite_count;
-  
+
+  // Dirty span list: previous + current bounding boxes of changed sprites,
+  // merged when they overlap. Overflow degrades to a full redraw.
+  SpriteDirtyRect dirty[MAX_SPRITES * 2];
+  uint8_t dirty_count;
+  bool full_redraw;
+
   // Find sprite by ID
   int8_t findSprite(uint8_t id) {
     for (uint8_t i = 0; i < sprite_count; i++) {
@@ -37,21 +49,143 @@ private:
     }
     return -1;
   }
+
+  // Record a sprite bounding box as dirty, merging overlapping spans
+  void markRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (w <= 0 || h <= 0) return;
+    int16_t x2 = x + w - 1;
+    int16_t y2 = y + h - 1;
+    for (uint8_t i = 0; i < dirty_count; i++) {
+      // Overlapping or touching -> grow the existing span
+      if (x <= dirty[i].x2 + 1 && x2 >= dirty[i].x1 - 1 &&
+          y <= dirty[i].y2 + 1 && y2 >= dirty[i].y1 - 1) {
+        if (x < dirty[i].x1) dirty[i].x1 = x;
+        if (y < dirty[i].y1) dirty[i].y1 = y;
+        if (x2 > dirty[i].x2) dirty[i].x2 = x2;
+        if (y2 > dirty[i].y2) dirty[i].y2 = y2;
+        return;
+      }
+    }
+    if (dirty_count >= MAX_SPRITES * 2) {
+      full_redraw = true;
+      return;
+    }
+    dirty[dirty_count].x1 = x;
+    dirty[dirty_count].y1 = y;
+    dirty[dirty_count].x2 = x2;
+    dirty[dirty_count].y2 = y2;
+    dirty_count++;
+  }
+
+  void markSprite(const Sprite& s) {
+    markRect(s.x, s.y, s.w, s.h);
+  }
+
+  // Clear a framebuffer region (inclusive bounds, assumed pre-clamped)
+  static void clearRegion(uint8_t* fb, uint16_t fb_width, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    uint16_t row_bits = x2 - x1 + 1;
+    for (int16_t y = y1; y <= y2; y++) {
+      uint32_t bit = (uint32_t)y * fb_width + x1;
+      uint16_t n = row_bits;
+      while (n) {
+        uint8_t chunk = n < 32 ? (uint8_t)n : 32;
+        storeBits(fb, bit, 0, chunk, true);
+        bit += chunk;
+        n -= chunk;
+      }
+    }
+  }
   
+  // Load `count` (1..32) bits starting at absolute bit offset, MSB-first.
+  // Result is left-aligned in the returned word. Never reads past the last
+  // byte that actually contains a requested bit.
+  static uint32_t loadBits(const uint8_t* buf, uint32_t bit, uint8_t count) {
+    uint32_t byte_idx = bit >> 3;
+    uint8_t shift = bit & 7;
+    uint8_t need = (shift + count + 7) >> 3;  // 1..5 source bytes
+    uint64_t acc = 0;
+    for (uint8_t i = 0; i < need; i++) {
+      acc = (acc << 8) | buf[byte_idx + i];
+    }
+    // Left-align the requested bits in a 64-bit window, keep the top 32
+    acc <<= (64 - 8 * (uint32_t)need) + shift;
+    uint32_t bits = (uint32_t)(acc >> 32);
+    if (count < 32) bits &= 0xFFFFFFFFu << (32 - count);
+    return bits;
+  }
+
+  // Merge `count` (1..32) left-aligned bits into the destination bit stream.
+  // OR mode leaves 0-bits untouched (transparent); opaque mode overwrites.
+  static void storeBits(uint8_t* buf, uint32_t bit, uint32_t bits, uint8_t count, bool opaque) {
+    uint32_t byte_idx = bit >> 3;
+    uint8_t shift = bit & 7;
+    uint8_t need = (shift + count + 7) >> 3;  // 1..5 destination bytes
+    uint64_t v = ((uint64_t)bits << 32) >> shift;
+    if (opaque) {
+      uint32_t m = (count < 32) ? (0xFFFFFFFFu << (32 - count)) : 0xFFFFFFFFu;
+      uint64_t mask = ((uint64_t)m << 32) >> shift;
+      for (uint8_t i = 0; i < need; i++) {
+        uint8_t b = (uint8_t)(v >> (56 - 8 * i));
+        uint8_t msk = (uint8_t)(mask >> (56 - 8 * i));
+        buf[byte_idx + i] = (buf[byte_idx + i] & ~msk) | b;
+      }
+    } else {
+      for (uint8_t i = 0; i < need; i++) {
+        buf[byte_idx + i] |= (uint8_t)(v >> (56 - 8 * i));
+      }
+    }
+  }
+
   // Render single sprite to framebuffer
   void renderSprite(const Sprite& sprite, uint8_t* framebuffer, uint16_t fb_width, uint16_t fb_height) {
+    renderSpriteClipped(sprite, framebuffer, fb_width, 0, 0, fb_width - 1, fb_height - 1);
+  }
+
+  // Render single sprite, clipped to a region (inclusive bounds)
+  void renderSpriteClipped(const Sprite& sprite, uint8_t* framebuffer, uint16_t fb_width,
+                           int16_t cx1, int16_t cy1, int16_t cx2, int16_t cy2) {
     if (!(sprite.flags & SPRITE_FLAG_VISIBLE)) return;
     if (!sprite.data) return;
-    
-    // Clip to screen bounds
-    int16_t start_x = max(0, sprite.x);
-    int16_t start_y = max(0, sprite.y);
-    int16_t end_x = min((int16_t)fb_width, (int16_t)(sprite.x + sprite.w));
-    int16_t end_y = min((int16_t)fb_height, (int16_t)(sprite.y + sprite.h));
-    
+
+    // Clip to the region
+    int16_t start_x = max(cx1, sprite.x);
+    int16_t start_y = max(cy1, sprite.y);
+    int16_t end_x = min((int16_t)(cx2 + 1), (int16_t)(sprite.x + sprite.w));
+    int16_t end_y = min((int16_t)(cy2 + 1), (int16_t)(sprite.y + sprite.h));
+
     if (start_x >= end_x || start_y >= end_y) return; // Fully clipped
-    
-    // Render each pixel
+
+    // Flipped sprites still go through the per-pixel path
+    if (sprite.flags & (SPRITE_FLAG_FLIP_H | SPRITE_FLAG_FLIP_V)) {
+      renderSpriteSlow(sprite, framebuffer, fb_width, start_x, start_y, end_x, end_y);
+      return;
+    }
+
+    // Fast path: blit each sprite row as shifted 32-bit words.
+    // Both sprite data and framebuffer are packed MSB-first, so a row is a
+    // contiguous run of bits on each side — no per-pixel div/mod.
+    bool opaque = sprite.flags & SPRITE_FLAG_OPAQUE;
+    uint16_t row_bits = end_x - start_x;
+    uint16_t local_x0 = start_x - sprite.x;
+    for (int16_t sy = start_y; sy < end_y; sy++) {
+      uint32_t src_bit = (uint32_t)(sy - sprite.y) * sprite.w + local_x0;
+      uint32_t dst_bit = (uint32_t)sy * fb_width + start_x;
+      uint16_t n = row_bits;
+      while (n) {
+        uint8_t chunk = n < 32 ? (uint8_t)n : 32;
+        uint32_t bits = loadBits(sprite.data, src_bit, chunk);
+        storeBits(framebuffer, dst_bit, bits, chunk, opaque);
+        src_bit += chunk;
+        dst_bit += chunk;
+        n -= chunk;
+      }
+    }
+  }
+
+  // Per-pixel fallback (handles FLIP_H / FLIP_V)
+  void renderSpriteSlow(const Sprite& sprite, uint8_t* framebuffer, uint16_t fb_width,
+                        int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y) {
+    bool opaque = sprite.flags & SPRITE_FLAG_OPAQUE;
     for (int16_t sy = start_y; sy < end_y; sy++) {
       for (int16_t sx = start_x; sx < end_x; sx++) {
         // Calculate sprite-local coordinates
@@ -72,9 +206,11 @@ private:
         uint8_t sprite_bit = sprite_byte & (1 << (7 - (sprite_idx % 8)));
         
         // If pixel is set, draw to framebuffer
+        uint16_t fb_idx = sy * fb_width + sx;
         if (sprite_bit) {
-          uint16_t fb_idx = sy * fb_width + sx;
           framebuffer[fb_idx / 8] |= (1 << (7 - (fb_idx % 8)));
+        } else if (opaque) {
+          framebuffer[fb_idx / 8] &= ~(1 << (7 - (fb_idx % 8)));
         }
       }
     }
@@ -95,15 +231,17 @@ private:
   }
   
 public:
-  SpriteEngine() : sprite_count(0) {}
-  
+  SpriteEngine() : sprite_count(0), dirty_count(0), full_redraw(true) {}
+
   // Add or update sprite
-  bool add(uint8_t id, int16_t x, int16_t y, uint8_t w, uint8_t h, 
+  bool add(uint8_t id, int16_t x, int16_t y, uint8_t w, uint8_t h,
            const uint8_t* data, uint8_t flags = SPRITE_FLAG_VISIBLE, uint8_t layer = 0) {
     int8_t idx = findSprite(id);
-    
+
     if (idx >= 0) {
       // Update existing
+      markSprite(sprites[idx]);  // Old bounding box
+      markRect(x, y, w, h);      // New bounding box
       sprites[idx].x = x;
       sprites[idx].y = y;
       sprites[idx].w = w;
@@ -114,7 +252,8 @@ public:
     } else {
       // Add new
       if (sprite_count >= MAX_SPRITES) return false;
-      
+
+      markRect(x, y, w, h);
       sprites[sprite_count].id = id;
       sprites[sprite_count].x = x;
       sprites[sprite_count].y = y;
@@ -134,17 +273,20 @@ public:
   bool move(uint8_t id, int16_t x, int16_t y) {
     int8_t idx = findSprite(id);
     if (idx < 0) return false;
-    
+
+    markSprite(sprites[idx]);  // Old position
     sprites[idx].x = x;
     sprites[idx].y = y;
+    markSprite(sprites[idx]);  // New position
     return true;
   }
-  
+
   // Remove sprite
   bool remove(uint8_t id) {
     int8_t idx = findSprite(id);
     if (idx < 0) return false;
-    
+
+    markSprite(sprites[idx]);
     // Shift remaining sprites down
     for (uint8_t i = idx; i < sprite_count - 1; i++) {
       sprites[i] = sprites[i + 1];
@@ -163,6 +305,7 @@ public:
     } else {
       sprites[idx].flags &= ~SPRITE_FLAG_VISIBLE;
     }
+    markSprite(sprites[idx]);
     return true;
   }
   
@@ -189,17 +332,71 @@ public:
     for (uint8_t i = 0; i < sprite_count; i++) {
       renderSprite(sprites[i], framebuffer, fb_width, fb_height);
     }
+    clearDirty();
   }
-  
+
+  // Recomposite only the dirty spans: clear each region, then re-render
+  // every sprite clipped against it. Returns the number of spans processed.
+  uint8_t renderDirty(uint8_t* framebuffer, uint16_t fb_width, uint16_t fb_height) {
+    if (full_redraw) {
+      clearRegion(framebuffer, fb_width, 0, 0, fb_width - 1, fb_height - 1);
+      render(framebuffer, fb_width, fb_height);
+      // Report a single full-screen span so the caller can flush it
+      dirty[0].x1 = 0; dirty[0].y1 = 0;
+      dirty[0].x2 = fb_width - 1; dirty[0].y2 = fb_height - 1;
+      dirty_count = 1;
+      full_redraw = false;
+      return 1;
+    }
+    for (uint8_t i = 0; i < dirty_count; i++) {
+      // Clamp to screen (sprites can sit partly off-screen)
+      if (dirty[i].x1 < 0) dirty[i].x1 = 0;
+      if (dirty[i].y1 < 0) dirty[i].y1 = 0;
+      if (dirty[i].x2 >= (int16_t)fb_width) dirty[i].x2 = fb_width - 1;
+      if (dirty[i].y2 >= (int16_t)fb_height) dirty[i].y2 = fb_height - 1;
+      if (dirty[i].x1 > dirty[i].x2 || dirty[i].y1 > dirty[i].y2) continue;
+
+      clearRegion(framebuffer, fb_width, dirty[i].x1, dirty[i].y1, dirty[i].x2, dirty[i].y2);
+      for (uint8_t s = 0; s < sprite_count; s++) {
+        renderSpriteClipped(sprites[s], framebuffer, fb_width,
+                            dirty[i].x1, dirty[i].y1, dirty[i].x2, dirty[i].y2);
+      }
+    }
+    return dirty_count;
+  }
+
+  // Dirty span accessors (valid until the next clearDirty/render)
+  uint8_t dirtyCount() const { return dirty_count; }
+  bool getDirty(uint8_t i, SpriteDirtyRect* out) const {
+    if (i >= dirty_count) return false;
+    *out = dirty[i];
+    return true;
+  }
+  void clearDirty() {
+    dirty_count = 0;
+    full_redraw = false;
+  }
+
   // Clear all sprites
   void clear() {
     sprite_count = 0;
+    dirty_count = 0;
+    full_redraw = true;  // Whole screen needs recompositing
   }
   
   // Get sprite count
   uint8_t count() const {
     return sprite_count;
   }
+
+  // Is any sprite still compositing from this bitmap? The asset cache
+  // uses this to avoid evicting a slot out from under a live sprite.
+  bool usesData(const uint8_t* p) const {
+    for (uint8_t i = 0; i < sprite_count; i++) {
+      if (sprites[i].data == p) return true;
+    }
+    return false;
+  }
 };
 
 #endif // SPRITE_ENGINE_H
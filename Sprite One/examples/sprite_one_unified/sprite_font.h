@@ -0,0 +1,167 @@
+/*
+ * sprite_font.h
+ * Flash-resident 5x7 monospace font + page-aligned glyph blitter
+ * Glyphs are stored as column bitmaps (bit 0 = top row), which is the
+ * same orientation as the SSD1306 page-packed framebuffer - a glyph
+ * column lands with one shift and at most two byte-wide ORs instead of
+ * 35 per-pixel read-modify-writes. One CMD_TEXT packet replaces the
+ * pixel flood a host would otherwise stream for a status line.
+ */
+
+#ifndef SPRITE_FONT_H
+#define SPRITE_FONT_H
+
+#include <Arduino.h>
+
+#define FONT_W        5
+#define FONT_H        7
+#define FONT_ADVANCE  6   // 5 columns + 1 blank, monospace
+#define FONT_FIRST    0x20
+#define FONT_LAST     0x7E
+
+// Classic 5x7 ASCII font, one column byte per entry, LSB = top.
+// Lives in flash (XIP) - 475 bytes, never copied to SRAM.
+static const uint8_t font5x7[][FONT_W] = {
+  {0x00,0x00,0x00,0x00,0x00}, // ' '
+  {0x00,0x00,0x5F,0x00,0x00}, // '!'
+  {0x00,0x07,0x00,0x07,0x00}, // '"'
+  {0x14,0x7F,0x14,0x7F,0x14}, // '#'
+  {0x24,0x2A,0x7F,0x2A,0x12}, // '$'
+  {0x23,0x13,0x08,0x64,0x62}, // '%'
+  {0x36,0x49,0x55,0x22,0x50}, // '&'
+  {0x00,0x05,0x03,0x00,0x00}, // '\''
+  {0x00,0x1C,0x22,0x41,0x00}, // '('
+  {0x00,0x41,0x22,0x1C,0x00}, // ')'
+  {0x08,0x2A,0x1C,0x2A,0x08}, // '*'
+  {0x08,0x08,0x3E,0x08,0x08}, // '+'
+  {0x00,0x50,0x30,0x00,0x00}, // ','
+  {0x08,0x08,0x08,0x08,0x08}, // '-'
+  {0x00,0x60,0x60,0x00,0x00}, // '.'
+  {0x20,0x10,0x08,0x04,0x02}, // '/'
+  {0x3E,0x51,0x49,0x45,0x3E}, // '0'
+  {0x00,0x42,0x7F,0x40,0x00}, // '1'
+  {0x42,0x61,0x51,0x49,0x46}, // '2'
+  {0x21,0x41,0x45,0x4B,0x31}, // '3'
+  {0x18,0x14,0x12,0x7F,0x10}, // '4'
+  {0x27,0x45,0x45,0x45,0x39}, // '5'
+  {0x3C,0x4A,0x49,0x49,0x30}, // '6'
+  {0x01,0x71,0x09,0x05,0x03}, // '7'
+  {0x36,0x49,0x49,0x49,0x36}, // '8'
+  {0x06,0x49,0x49,0x29,0x1E}, // '9'
+  {0x00,0x36,0x36,0x00,0x00}, // ':'
+  {0x00,0x56,0x36,0x00,0x00}, // ';'
+  {0x00,0x08,0x14,0x22,0x41}, // '<'
+  {0x14,0x14,0x14,0x14,0x14}, // '='
+  {0x41,0x22,0x14,0x08,0x00}, // '>'
+  {0x02,0x01,0x51,0x09,0x06}, // '?'
+  {0x32,0x49,0x79,0x41,0x3E}, // '@'
+  {0x7E,0x11,0x11,0x11,0x7E}, // 'A'
+  {0x7F,0x49,0x49,0x49,0x36}, // 'B'
+  {0x3E,0x41,0x41,0x41,0x22}, // 'C'
+  {0x7F,0x41,0x41,0x22,0x1C}, // 'D'
+  {0x7F,0x49,0x49,0x49,0x41}, // 'E'
+  {0x7F,0x09,0x09,0x01,0x01}, // 'F'
+  {0x3E,0x41,0x41,0x51,0x32}, // 'G'
+  {0x7F,0x08,0x08,0x08,0x7F}, // 'H'
+  {0x00,0x41,0x7F,0x41,0x00}, // 'I'
+  {0x20,0x40,0x41,0x3F,0x01}, // 'J'
+  {0x7F,0x08,0x14,0x22,0x41}, // 'K'
+  {0x7F,0x40,0x40,0x40,0x40}, // 'L'
+  {0x7F,0x02,0x04,0x02,0x7F}, // 'M'
+  {0x7F,0x04,0x08,0x10,0x7F}, // 'N'
+  {0x3E,0x41,0x41,0x41,0x3E}, // 'O'
+  {0x7F,0x09,0x09,0x09,0x06}, // 'P'
+  {0x3E,0x41,0x51,0x21,0x5E}, // 'Q'
+  {0x7F,0x09,0x19,0x29,0x46}, // 'R'
+  {0x46,0x49,0x49,0x49,0x31}, // 'S'
+  {0x01,0x01,0x7F,0x01,0x01}, // 'T'
+  {0x3F,0x40,0x40,0x40,0x3F}, // 'U'
+  {0x1F,0x20,0x40,0x20,0x1F}, // 'V'
+  {0x7F,0x20,0x18,0x20,0x7F}, // 'W'
+  {0x63,0x14,0x08,0x14,0x63}, // 'X'
+  {0x03,0x04,0x78,0x04,0x03}, // 'Y'
+  {0x61,0x51,0x49,0x45,0x43}, // 'Z'
+  {0x00,0x00,0x7F,0x41,0x41}, // '['
+  {0x02,0x04,0x08,0x10,0x20}, // '\'
+  {0x41,0x41,0x7F,0x00,0x00}, // ']'
+  {0x04,0x02,0x01,0x02,0x04}, // '^'
+  {0x40,0x40,0x40,0x40,0x40}, // '_'
+  {0x00,0x01,0x02,0x04,0x00}, // '`'
+  {0x20,0x54,0x54,0x54,0x78}, // 'a'
+  {0x7F,0x48,0x44,0x44,0x38}, // 'b'
+  {0x38,0x44,0x44,0x44,0x20}, // 'c'
+  {0x38,0x44,0x44,0x48,0x7F}, // 'd'
+  {0x38,0x54,0x54,0x54,0x18}, // 'e'
+  {0x08,0x7E,0x09,0x01,0x02}, // 'f'
+  {0x08,0x14,0x54,0x54,0x3C}, // 'g'
+  {0x7F,0x08,0x04,0x04,0x78}, // 'h'
+  {0x00,0x44,0x7D,0x40,0x00}, // 'i'
+  {0x20,0x40,0x44,0x3D,0x00}, // 'j'
+  {0x00,0x7F,0x10,0x28,0x44}, // 'k'
+  {0x00,0x41,0x7F,0x40,0x00}, // 'l'
+  {0x7C,0x04,0x18,0x04,0x78}, // 'm'
+  {0x7C,0x08,0x04,0x04,0x78}, // 'n'
+  {0x38,0x44,0x44,0x44,0x38}, // 'o'
+  {0x7C,0x14,0x14,0x14,0x08}, // 'p'
+  {0x08,0x14,0x14,0x18,0x7C}, // 'q'
+  {0x7C,0x08,0x04,0x04,0x08}, // 'r'
+  {0x48,0x54,0x54,0x54,0x20}, // 's'
+  {0x04,0x3F,0x44,0x40,0x20}, // 't'
+  {0x3C,0x40,0x40,0x20,0x7C}, // 'u'
+  {0x1C,0x20,0x40,0x20,0x1C}, // 'v'
+  {0x3C,0x40,0x30,0x40,0x3C}, // 'w'
+  {0x44,0x28,0x10,0x28,0x44}, // 'x'
+  {0x0C,0x50,0x50,0x50,0x3C}, // 'y'
+  {0x44,0x64,0x54,0x4C,0x44}, // 'z'
+  {0x00,0x08,0x36,0x41,0x00}, // '{'
+  {0x00,0x00,0x7F,0x00,0x00}, // '|'
+  {0x00,0x41,0x36,0x08,0x00}, // '}'
+  {0x08,0x08,0x2A,0x1C,0x08}, // '~'
+};
+
+// Blit one glyph into a page-packed 1bpp framebuffer
+// (byte = x + (y/8)*w, bit = y%8). A column byte straddles at most two
+// pages, so each column is one shift plus one or two byte ORs; color 0
+// clears the same bits instead (erase/inverse text).
+static inline void font_blit_glyph(uint8_t* fb, uint16_t fb_w, uint16_t fb_h,
+                                   int16_t x, int16_t y, char ch, uint8_t color) {
+  if (ch < FONT_FIRST || ch > FONT_LAST) ch = '?';
+  const uint8_t* glyph = font5x7[ch - FONT_FIRST];
+
+  int16_t page0 = y >> 3;          // Arithmetic shift: correct for y < 0
+  uint8_t shift = (uint8_t)(y & 7);
+  int16_t pages = fb_h / 8;
+
+  for (uint8_t cx = 0; cx < FONT_W; cx++) {
+    int16_t px = x + cx;
+    if (px < 0 || px >= (int16_t)fb_w) continue;
+    uint16_t col = (uint16_t)glyph[cx] << shift;
+
+    if (page0 >= 0 && page0 < pages) {
+      uint8_t* dst = &fb[px + page0 * fb_w];
+      if (color) *dst |= (uint8_t)col;
+      else       *dst &= (uint8_t)~col;
+    }
+    if (shift && page0 + 1 >= 0 && page0 + 1 < pages) {
+      uint8_t* dst = &fb[px + (page0 + 1) * fb_w];
+      if (color) *dst |= (uint8_t)(col >> 8);
+      else       *dst &= (uint8_t)~(col >> 8);
+    }
+  }
+}
+
+// Kerning-free monospace layout. Returns the width drawn in pixels.
+static inline uint16_t font_draw_text(uint8_t* fb, uint16_t fb_w, uint16_t fb_h,
+                                      int16_t x, int16_t y,
+                                      const char* text, uint8_t len, uint8_t color) {
+  uint16_t drawn = 0;
+  for (uint8_t i = 0; i < len; i++) {
+    if (x >= (int16_t)fb_w) break;  // Off the right edge, nothing more lands
+    font_blit_glyph(fb, fb_w, fb_h, x, y, text[i], color);
+    x += FONT_ADVANCE;
+    drawn += FONT_ADVANCE;
+  }
+  return drawn;
+}
+
+#endif // SPRITE_FONT_H
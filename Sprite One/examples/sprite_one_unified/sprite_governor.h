@@ -0,0 +1,123 @@
+/*
+ * sprite_governor.h
+ * Closed-loop DVFS governor for Sprite One
+ * Steps clk_sys between 50/133/250MHz from queue depth, the training
+ * flag, and die temperature: turbo when work backs up, undervolted
+ * sleep when the device just sits waiting for UART bytes. The caller
+ * must re-tune every divider derived from clk_sys after a change -
+ * UART baud (clk_peri moves with clk_sys) and the display bus clocks
+ * (SpriteDisplay::reclock()) - update() returns true when needed.
+ */
+
+#ifndef SPRITE_GOVERNOR_H
+#define SPRITE_GOVERNOR_H
+
+#include <Arduino.h>
+
+#ifdef ARDUINO_ARCH_RP2040
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/vreg.h"
+
+#define GOV_ADC_TEMP_CHANNEL 4
+#endif
+
+// Performance states (MHz)
+#define GOV_SLEEP_MHZ    50   // Undervolted idle
+#define GOV_NOMINAL_MHZ  133  // Stock
+#define GOV_TURBO_MHZ    250  // Training / backlogged queue
+
+// Policy knobs
+#define GOV_EVAL_INTERVAL_MS  250   // How often the loop re-evaluates
+#define GOV_TURBO_DEPTH       10    // Queue depth that triggers turbo
+#define GOV_TURBO_HOLD_MS     1000  // Keep turbo briefly after triggers clear
+#define GOV_SLEEP_AFTER_MS    2000  // Idle time before dropping to sleep
+#define GOV_TEMP_MAX          65.0f // No turbo above this (matches sentinel)
+
+class SpriteGovernor {
+private:
+  uint16_t current_mhz;
+  uint32_t last_eval_ms;
+  uint32_t turbo_until_ms;
+  float last_temp;
+
+  // Same datasheet formula as the sentinel's PicoPerf
+  float readTemperature() {
+    #ifdef ARDUINO_ARCH_RP2040
+    adc_select_input(GOV_ADC_TEMP_CHANNEL);
+    const float conversion_factor = 3.3f / (1 << 12);
+    float voltage = adc_read() * conversion_factor;
+    last_temp = 27.0f - (voltage - 0.706f) / 0.001721f;
+    #else
+    last_temp = 35.0f;
+    #endif
+    return last_temp;
+  }
+
+  // Reclock with matching core voltage. Deliberately does NOT restart
+  // the serial ports (unlike the sentinel's setPerformanceState) - the
+  // unified firmware re-tunes the UART divisor via
+  // TransportManager::reapplyBaud() so the DMA RX ring stays armed.
+  bool setFrequency(uint16_t freq_mhz) {
+    #ifdef ARDUINO_ARCH_RP2040
+    vreg_voltage voltage = VREG_VOLTAGE_1_10;
+    if (freq_mhz > 200) voltage = VREG_VOLTAGE_1_20;
+    else if (freq_mhz > 150) voltage = VREG_VOLTAGE_1_15;
+    else if (freq_mhz < 100) voltage = VREG_VOLTAGE_0_95; // Undervolt
+
+    if (freq_mhz > current_mhz) {
+      vreg_set_voltage(voltage);  // Raise voltage before frequency
+      delay(1);
+    }
+    if (!set_sys_clock_khz(freq_mhz * 1000, false)) return false;
+    if (freq_mhz < current_mhz) {
+      vreg_set_voltage(voltage);  // Lower voltage after frequency
+    }
+    #endif
+    current_mhz = freq_mhz;
+    return true;
+  }
+
+public:
+  SpriteGovernor() : current_mhz(GOV_NOMINAL_MHZ), last_eval_ms(0),
+                     turbo_until_ms(0), last_temp(25.0f) {}
+
+  void begin() {
+    #ifdef ARDUINO_ARCH_RP2040
+    adc_init();
+    adc_set_temp_sensor_enabled(true);
+    current_mhz = (uint16_t)(clock_get_hz(clk_sys) / 1000000);
+    #endif
+  }
+
+  // Evaluate the policy. Returns true when clk_sys changed and the
+  // caller must re-apply the UART baud.
+  bool update(uint16_t queue_depth, bool training, uint32_t idle_ms) {
+    uint32_t now = millis();
+    if ((uint32_t)(now - last_eval_ms) < GOV_EVAL_INTERVAL_MS) return false;
+    last_eval_ms = now;
+
+    float temp = readTemperature();
+    uint16_t target = GOV_NOMINAL_MHZ;
+
+    if ((training || queue_depth >= GOV_TURBO_DEPTH) && temp < GOV_TEMP_MAX) {
+      target = GOV_TURBO_MHZ;
+      turbo_until_ms = now + GOV_TURBO_HOLD_MS;
+    } else if (current_mhz == GOV_TURBO_MHZ &&
+               (int32_t)(turbo_until_ms - now) > 0 && temp < GOV_TEMP_MAX) {
+      target = GOV_TURBO_MHZ;  // Hold: avoid thrash on bursty queues
+    } else if (queue_depth == 0 && !training && idle_ms > GOV_SLEEP_AFTER_MS) {
+      target = GOV_SLEEP_MHZ;
+    }
+
+    if (target == current_mhz) return false;
+    return setFrequency(target);
+  }
+
+  uint16_t getFrequencyMhz() const { return current_mhz; }
+  float getTemperature() const { return last_temp; }
+};
+
+static SpriteGovernor governor;
+
+#endif // SPRITE_GOVERNOR_H
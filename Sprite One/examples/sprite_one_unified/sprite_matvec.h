@@ -0,0 +1,174 @@
+/*
+ * sprite_matvec.h
+ * Fork/join dense-layer math across both cores
+ * AIfES dispatches dense forward passes through the layer's `linear`
+ * function pointer (the same hook its CMSIS backend uses). We swap in
+ * a kernel that splits the output columns of result = A*B + bias
+ * between the calling core and whichever core is idle: the caller
+ * posts half the columns to a mailbox, computes its own half, then
+ * spin-joins. If nobody claims the posted half in time (the other
+ * core is deep in LittleFS or a flush), the caller steals it back -
+ * correctness never depends on the helper showing up.
+ */
+
+#ifndef SPRITE_MATVEC_H
+#define SPRITE_MATVEC_H
+
+#include <Arduino.h>
+#include <aifes.h>
+
+#ifdef ARDUINO_ARCH_RP2040
+#include "hardware/sync.h"
+#define MATVEC_DMB() __dmb()
+#define MATVEC_SEV() __sev()
+#define MATVEC_WFE() __wfe()
+#else
+#define MATVEC_DMB() do {} while (0)
+#define MATVEC_SEV() do {} while (0)
+#define MATVEC_WFE() do {} while (0)
+#endif
+
+// Below this many MACs (M*K*N) the fork overhead exceeds the work -
+// the XOR demo layers (2x3) stay single-core, the sentinel's 128x128
+// embedding layer (16384 MACs, several ms in software float) forks.
+#define MATVEC_FORK_MIN_MACS 4096
+
+class SpriteMatvec {
+private:
+  enum JobState : uint8_t { JOB_POSTED = 0, JOB_CLAIMED, JOB_STOLEN };
+
+  struct Job {
+    const float* A;     // [M x K] input activations
+    const float* B;     // [K x N] weights
+    const float* bias;  // [N] or nullptr
+    float* R;           // [M x N] result
+    uint16_t M, K, N;
+    uint16_t split;     // Helper computes columns [0, split)
+    volatile uint8_t state;
+    volatile uint8_t done;
+  };
+
+  static Job job;
+  static volatile uint32_t mailbox;  // Nonzero while a job is posted
+  #ifdef ARDUINO_ARCH_RP2040
+  static spin_lock_t* lock;          // Guards claim/steal transitions
+  #endif
+
+  // Column-range slice of result = A*B + bias (B in row-major [K x N],
+  // so a column walks with stride N)
+  static void linear_cols(const float* A, const float* B, const float* bias,
+                          float* R, uint16_t M, uint16_t K, uint16_t N,
+                          uint16_t n0, uint16_t n1) {
+    for (uint16_t m = 0; m < M; m++) {
+      const float* arow = A + (uint32_t)m * K;
+      float* rrow = R + (uint32_t)m * N;
+      for (uint16_t n = n0; n < n1; n++) {
+        float sum = bias ? bias[n] : 0.0f;
+        const float* bp = B + n;
+        for (uint16_t k = 0; k < K; k++) sum += arow[k] * bp[(uint32_t)k * N];
+        rrow[n] = sum;
+      }
+    }
+  }
+
+public:
+  static void begin() {
+    #ifdef ARDUINO_ARCH_RP2040
+    lock = spin_lock_instance(spin_lock_claim_unused(true));
+    #endif
+  }
+
+  // Idle-core service: claim a posted job and compute the helper half.
+  // Called from loop() on Core 0 and the Core 1 idle branch; returns
+  // true when work was done.
+  static bool poll() {
+    #ifdef ARDUINO_ARCH_RP2040
+    if (!mailbox || !lock) return false;
+    uint32_t irq = spin_lock_blocking(lock);
+    bool mine = (mailbox != 0 && job.state == JOB_POSTED);
+    if (mine) { job.state = JOB_CLAIMED; mailbox = 0; }
+    spin_unlock(lock, irq);
+    if (!mine) return false;
+
+    linear_cols(job.A, job.B, job.bias, job.R, job.M, job.K, job.N,
+                0, job.split);
+    MATVEC_DMB();
+    job.done = 1;
+    MATVEC_SEV();
+    return true;
+    #else
+    return false;
+    #endif
+  }
+
+  // Drop-in for aimath_f32_default_linear: a [M x K], b [K x N],
+  // c bias or nullptr, result [M x N]. Assign to ailayer_dense_f32_t
+  // .linear after ailayer_dense_f32_default().
+  static void linear_f32(const aitensor_t* a, const aitensor_t* b,
+                         const aitensor_t* c, aitensor_t* result) {
+    uint16_t M = a->shape[0];
+    uint16_t K = a->shape[1];
+    uint16_t N = b->shape[1];
+    const float* A = (const float*)a->data;
+    const float* B = (const float*)b->data;
+    const float* bias = c ? (const float*)c->data : nullptr;
+    float* R = (float*)result->data;
+
+    #ifdef ARDUINO_ARCH_RP2040
+    uint32_t macs = (uint32_t)M * K * N;
+    bool forked = false;
+    uint16_t split = N / 2;
+
+    if (lock && split > 0 && macs >= MATVEC_FORK_MIN_MACS) {
+      // Post the lower columns for the idle core - unless a job is
+      // already in flight (e.g. batch inference on Core 0 overlapping
+      // training on Core 1), in which case we just compute inline
+      uint32_t irq = spin_lock_blocking(lock);
+      if (mailbox == 0) {
+        job.A = A; job.B = B; job.bias = bias; job.R = R;
+        job.M = M; job.K = K; job.N = N;
+        job.split = split;
+        job.done = 0;
+        job.state = JOB_POSTED;
+        MATVEC_DMB();
+        mailbox = (uint32_t)&job;
+        forked = true;
+      }
+      spin_unlock(lock, irq);
+      if (forked) MATVEC_SEV();  // Wake a core parked in WFE
+    }
+
+    if (!forked) {
+      linear_cols(A, B, bias, R, M, K, N, 0, N);
+      return;
+    }
+
+    // Our half while the helper (hopefully) takes the other
+    linear_cols(A, B, bias, R, M, K, N, split, N);
+
+    // Join. If the job is still unclaimed the other core never got to
+    // a poll() - take it back and finish single-core.
+    uint32_t irq = spin_lock_blocking(lock);
+    uint8_t st = job.state;
+    if (st == JOB_POSTED) { job.state = JOB_STOLEN; mailbox = 0; }
+    spin_unlock(lock, irq);
+
+    if (st == JOB_POSTED) {
+      linear_cols(A, B, bias, R, M, K, N, 0, split);
+      return;
+    }
+    while (!job.done) { MATVEC_WFE(); }  // SEV from the helper wakes us
+    MATVEC_DMB();
+    #else
+    linear_cols(A, B, bias, R, M, K, N, 0, N);
+    #endif
+  }
+};
+
+SpriteMatvec::Job SpriteMatvec::job;
+volatile uint32_t SpriteMatvec::mailbox = 0;
+#ifdef ARDUINO_ARCH_RP2040
+spin_lock_t* SpriteMatvec::lock = nullptr;
+#endif
+
+#endif // SPRITE_MATVEC_H
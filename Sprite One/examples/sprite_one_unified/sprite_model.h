@@ -8,6 +8,7 @@
 
 #include <Arduino.h>
 #include <LittleFS.h>
+#include "sprite_crc.h"
 
 // Model header format (32 bytes, aligned)
 #define MODEL_MAGIC 0x54525053  // "SPRT"
@@ -37,16 +38,29 @@ private:
   bool has_active_model;
   
   // Calculate CRC32 (simple implementation)
-  uint32_t crc32(const uint8_t* data, size_t len) {
-    uint32_t crc = 0xFFFFFFFF;
+  uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t len) {
     for (size_t i = 0; i < len; i++) {
       crc ^= data[i];
       for (int j = 0; j < 8; j++) {
         crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
       }
     }
-    return ~crc;
+    return crc;
   }
+
+  // Full-buffer CRC32 rides the DMA sniffer; the incremental
+  // crc32_update above stays in software for the small streamed chunks
+  uint32_t crc32(const uint8_t* data, size_t len) {
+    return crc32_hw(data, len);
+  }
+
+  // Streaming upload state (see beginUpload)
+  File upload_file;
+  char upload_temp_path[48];
+  char upload_final_path[48];
+  uint32_t upload_crc;
+  size_t upload_written;
+  bool upload_active;
   
   // Validate model header
   bool validateHeader(const ModelHeader& hdr) {
@@ -58,7 +72,7 @@ private:
   }
   
 public:
-  ModelManager() : has_active_model(false) {
+  ModelManager() : has_active_model(false), upload_active(false) {
     active_model_path[0] = '\0';
   }
   
@@ -144,47 +158,87 @@ public:
     return LittleFS.remove(path);
   }
   
-  // Upload model (write in chunks)
-  bool uploadModel(const char* filename, const uint8_t* data, size_t len) {
-    // Write to temporary file first
-    char temp_path[48];
-    snprintf(temp_path, sizeof(temp_path), "/models/%s.tmp", filename);
-    
-    File f = LittleFS.open(temp_path, "w");
-    if (!f) return false;
-    
-    size_t written = f.write(data, len);
-    f.close();
-    
-    if (written != len) {
-      LittleFS.remove(temp_path);
-      return false;
-    }
-    
-    // Validate header
-    ModelHeader hdr;
-    File validate = LittleFS.open(temp_path, "r");
-    if (!validate || validate.read((uint8_t*)&hdr, sizeof(ModelHeader)) != sizeof(ModelHeader)) {
-      if (validate) validate.close();
-      LittleFS.remove(temp_path);
+  // --- Streaming upload ---
+  // Chunks go straight to a temp file next to the destination and the
+  // CRC32 accumulates as they arrive, so upload size is bounded by flash,
+  // not RAM. The final rename is still atomic: a torn upload never
+  // replaces the old model.
+  //
+  // `path` is taken verbatim (the protocol handler passes the filename
+  // the host sent), so this works for both /models/* and root paths.
+  bool beginUpload(const char* path) {
+    if (upload_active) abortUpload();
+    snprintf(upload_final_path, sizeof(upload_final_path), "%s", path);
+    snprintf(upload_temp_path, sizeof(upload_temp_path), "%s.tmp", path);
+    upload_file = LittleFS.open(upload_temp_path, "w");
+    if (!upload_file) return false;
+    upload_crc = 0xFFFFFFFF;
+    upload_written = 0;
+    upload_active = true;
+    return true;
+  }
+  
+  bool writeChunk(const uint8_t* data, size_t len) {
+    if (!upload_active || !upload_file) return false;
+    if (len == 0) return true;
+    if (upload_file.write(data, len) != len) {
+      abortUpload();
       return false;
     }
-    validate.close();
-    
-    if (!validateHeader(hdr)) {
-      LittleFS.remove(temp_path);
+    upload_crc = crc32_update(upload_crc, data, len);
+    upload_written += len;
+    return true;
+  }
+  
+  // CRC32 of everything streamed so far
+  uint32_t uploadCrc() {
+    return ~upload_crc;
+  }
+  
+  bool isUploading() const {
+    return upload_active;
+  }
+  
+  // Close the temp file, sanity-check the magic, and atomically rename
+  // into place. Only the magic is checked here - legacy V1 and dynamic
+  // V3/V4 images share it but not the header layout, and full validation
+  // happens when the model is loaded.
+  bool finishUpload() {
+    if (!upload_active || !upload_file) return false;
+    upload_file.close();
+    upload_active = false;
+    
+    uint32_t magic = 0;
+    File f = LittleFS.open(upload_temp_path, "r");
+    if (!f || f.read((uint8_t*)&magic, sizeof(magic)) != sizeof(magic) || magic != MODEL_MAGIC) {
+      if (f) f.close();
+      LittleFS.remove(upload_temp_path);
       return false;
     }
+    f.close();
     
-    // Atomic rename
-    char final_path[48];
-    snprintf(final_path, sizeof(final_path), "/models/%s", filename);
-    LittleFS.remove(final_path);  // Remove old if exists
-    LittleFS.rename(temp_path, final_path);
-    
+    LittleFS.remove(upload_final_path);  // Remove old if exists
+    LittleFS.rename(upload_temp_path, upload_final_path);
     return true;
   }
   
+  void abortUpload() {
+    if (upload_file) upload_file.close();
+    if (upload_active) LittleFS.remove(upload_temp_path);
+    upload_active = false;
+  }
+  
+  // Upload model from a complete in-RAM buffer. Wrapper over the
+  // streaming API - prefer beginUpload/writeChunk/finishUpload for
+  // anything bigger than a few hundred bytes.
+  bool uploadModel(const char* filename, const uint8_t* data, size_t len) {
+    char path[48];
+    snprintf(path, sizeof(path), "/models/%s", filename);
+    if (!beginUpload(path)) return false;
+    if (!writeChunk(data, len)) return false;
+    return finishUpload();
+  }
+  
   // Check if has active model
   bool hasActive() const {
     return has_active_model;
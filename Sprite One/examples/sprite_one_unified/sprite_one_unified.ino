@@ -17,7 +17,13 @@
 #include <LittleFS.h>
 #include "sprite_transport.h"
 #include "sprite_display.h"
+#include "sprite_font.h"
 #include "sprite_engine.h"
+#include "sprite_assets.h"
+#include "sprite_crc.h"
+#include "sprite_stats.h"
+#include "sprite_governor.h"
+#include "sprite_matvec.h"
 #include "sprite_model.h"
 #include "sprite_inference.h"
 #include "pico/unique_id.h"
@@ -31,12 +37,19 @@
 // Display configuration
 // 0 = Simulated (serial output only)
 // 1 = SSD1306 (128x64 OLED via I2C)
+// 2 = ST7789/ILI9341 (240x240 TFT via PIO SPI + DMA; the 1bpp frame is
+//     expanded to RGB565 during scan-out - see sprite_display.h for the
+//     native RGB565 path)
 #define SPRITE_DISPLAY_TYPE 1
 
 // Protocol
 #define SPRITE_HEADER       0xAA
+#define SPRITE_MAX_RESPONSE 255   // Response LEN field is a single byte
 #define CMD_VERSION         0x0F
 #define CMD_BUFFER_STATUS   0x0E
+#define CMD_SET_BAUD        0x0D
+#define CMD_STATS           0x0C
+#define CMD_MEM_STATS       0x0B
 #define CMD_CLEAR           0x10
 #define CMD_PIXEL           0x11
 #define CMD_RECT            0x12
@@ -52,6 +65,10 @@
 #define CMD_SPRITE_RENDER   0x35
 #define CMD_SPRITE_CLEAR    0x36
 
+// Asset commands (0x40 - 0x4F, opcodes reserved in sprite_core.h)
+#define CMD_LOAD_SPRITE     0x40  // Bind a flash asset to a sprite slot
+#define CMD_STORE_FLASH     0x42  // Persist sprite art to LittleFS
+
 #define CMD_AI_INFER        0x50
 #define CMD_AI_TRAIN        0x51
 #define CMD_AI_STATUS       0x52
@@ -59,6 +76,7 @@
 #define CMD_AI_LOAD         0x54
 #define CMD_AI_LIST         0x55
 #define CMD_AI_DELETE       0x56
+#define CMD_AI_INFER_BATCH  0x5A
 
 // Model management commands
 #define CMD_MODEL_INFO      0x60
@@ -69,7 +87,19 @@
 #define CMD_FINETUNE_START  0x65
 #define CMD_FINETUNE_DATA   0x66
 #define CMD_FINETUNE_STOP   0x67
+#define CMD_FINETUNE_TRAIN  0x73  // Internal: Core0 hands a full pool half to Core1
+                                  // (not 0x68 - that's the host-facing CMD_UPLOAD_CHUNK)
 #define CMD_BATCH           0x70  // Batch command execution
+#define CMD_PIPELINE        0x71  // Fire-and-forget mode + credit window
+#define CMD_EVENTS          0x72  // Subscribe to unsolicited event frames
+#define CMD_EVENT           0xFF  // SPRITE_DATA: device->host push frame
+
+// Event types - ride in the status byte of a CMD_EVENT frame. Opt-in
+// via CMD_EVENTS so hosts with older parsers never see them.
+#define EVT_TRAIN_DONE      0x01  // Payload: float32 loss of the batch
+#define EVT_FLUSH_DONE      0x02  // Payload: none
+#define EVT_QUEUE_CREDIT    0x03  // Payload: u8 free queue slots
+#define EVT_REFLEX          0x04  // Reserved for sentinel-class builds
 
 // Industrial API Primitives (0xA0 - 0xA7)
 #define CMD_WHO_IS_THERE    0xA0
@@ -88,35 +118,127 @@
 // Display (simulated)
 #define DISPLAY_W 128
 #define DISPLAY_H 64
-uint8_t framebuffer[DISPLAY_W * DISPLAY_H / 8];
-
-// Dirty rectangle tracking for optimized updates  
-struct {
+#define FB_SIZE (DISPLAY_W * DISPLAY_H / 8)
+
+// Double-buffered framebuffer: draw commands always target the back
+// buffer (`framebuffer`) while the display path owns the front one, so
+// composition and scan-out overlap instead of serializing. CMD_FLUSH
+// flips the pointers for large updates; the stale back buffer is
+// reconciled lazily (dirty-copy from the front) before the next draw.
+static uint8_t fb_pool[2][FB_SIZE];
+uint8_t* framebuffer = fb_pool[0];      // Back buffer - drawing target
+static uint8_t* fb_front = fb_pool[1];  // Front buffer - display-owned
+
+// Dirty region tracking for optimized updates.
+// A short list of spans instead of one union box, so two small updates in
+// opposite screen corners don't force a near-full-frame I2C push.
+#define MAX_DIRTY_SPANS 4
+struct DirtySpan {
   uint16_t x1, y1, x2, y2;
-  bool is_dirty;
-} dirty_rect = {0, 0, 0, 0, false};
-
-void fb_mark_dirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
-  if (!dirty_rect.is_dirty) {
-    dirty_rect.x1 = x;
-    dirty_rect.y1 = y;
-    dirty_rect.x2 = x + w - 1;
-    dirty_rect.y2 = y + h - 1;
-    dirty_rect.is_dirty = true;
+};
+static DirtySpan dirty_spans[MAX_DIRTY_SPANS];
+static uint8_t dirty_span_count = 0;
+
+// Front/back divergence since the last reconcile - the regions where
+// the two buffers differ (tracked with the same merge/fold rules as the
+// flush spans)
+static DirtySpan diverge_spans[MAX_DIRTY_SPANS];
+static uint8_t diverge_span_count = 0;
+static bool fb_reconcile_pending = false;
+
+// Merge a rect into a span list (overlapping/touching spans grow;
+// overflow folds into the first span, degrading toward a union box)
+static void span_mark(DirtySpan* list, uint8_t* count,
+                      uint16_t x, uint16_t y, uint16_t x2, uint16_t y2) {
+  for (uint8_t i = 0; i < *count; i++) {
+    if (x <= list[i].x2 + 1 && x2 + 1 >= list[i].x1 &&
+        y <= list[i].y2 + 1 && y2 + 1 >= list[i].y1) {
+      if (x < list[i].x1) list[i].x1 = x;
+      if (y < list[i].y1) list[i].y1 = y;
+      if (x2 > list[i].x2) list[i].x2 = x2;
+      if (y2 > list[i].y2) list[i].y2 = y2;
+      return;
+    }
+  }
+
+  if (*count < MAX_DIRTY_SPANS) {
+    list[(*count)++] = {x, y, x2, y2};
   } else {
-    // Expand dirty region
-    if (x < dirty_rect.x1) dirty_rect.x1 = x;
-    if (y < dirty_rect.y1) dirty_rect.y1 = y;
-    if (x + w - 1 > dirty_rect.x2) dirty_rect.x2 = x + w - 1;
-    if (y + h - 1 > dirty_rect.y2) dirty_rect.y2 = y + h - 1;
+    if (x < list[0].x1) list[0].x1 = x;
+    if (y < list[0].y1) list[0].y1 = y;
+    if (x2 > list[0].x2) list[0].x2 = x2;
+    if (y2 > list[0].y2) list[0].y2 = y2;
+  }
+}
+
+// Clamps to the panel here so every caller is covered: updateRegion
+// trusts the span bounds, and an unclamped x2/y2 (CMD_RECT hands u8
+// coords straight through) would walk it past the framebuffer.
+void fb_mark_dirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return;
+  int16_t x2 = x + w - 1;
+  int16_t y2 = y + h - 1;
+  if (x2 < 0 || y2 < 0 || x >= DISPLAY_W || y >= DISPLAY_H) return;
+  if (x < 0) x = 0;
+  if (y < 0) y = 0;
+  if (x2 >= DISPLAY_W) x2 = DISPLAY_W - 1;
+  if (y2 >= DISPLAY_H) y2 = DISPLAY_H - 1;
+  span_mark(dirty_spans, &dirty_span_count, x, y, x2, y2);
+  span_mark(diverge_spans, &diverge_span_count, x, y, x2, y2);
+}
+
+// Lazy dirty-copy reconcile. After a flip the back buffer is one frame
+// stale in the regions the flipped frame touched; copy those back from
+// the front buffer before the next draw mutates anything. Page-packed
+// layout makes each span row a contiguous memcpy.
+void fb_reconcile() {
+  if (!fb_reconcile_pending) return;
+  fb_reconcile_pending = false;
+  for (uint8_t i = 0; i < diverge_span_count; i++) {
+    uint8_t p0 = diverge_spans[i].y1 / 8;
+    uint8_t p1 = diverge_spans[i].y2 / 8;
+    uint16_t x1 = diverge_spans[i].x1;
+    uint16_t w = diverge_spans[i].x2 - x1 + 1;
+    for (uint8_t p = p0; p <= p1; p++) {
+      uint16_t off = (uint16_t)p * DISPLAY_W + x1;
+      memcpy(framebuffer + off, fb_front + off, w);
+    }
+  }
+  diverge_span_count = 0;
+}
+
+// Swap front/back. The divergence list (everything drawn since the
+// last reconcile) now describes where the *front* is newer; flag it for
+// the lazy copy.
+void fb_flip() {
+  uint8_t* t = fb_front;
+  fb_front = framebuffer;
+  framebuffer = t;
+  fb_reconcile_pending = (diverge_span_count > 0);
+  dirty_span_count = 0;
+}
+
+// Above this much dirty area a blocking partial page push costs more
+// than flipping and letting DMA scan the whole frame out
+#define FB_FLIP_AREA ((uint32_t)DISPLAY_W * DISPLAY_H / 4)
+
+static uint32_t fb_dirty_area() {
+  uint32_t a = 0;
+  for (uint8_t i = 0; i < dirty_span_count; i++) {
+    a += (uint32_t)(dirty_spans[i].x2 - dirty_spans[i].x1 + 1) *
+         (dirty_spans[i].y2 - dirty_spans[i].y1 + 1);
   }
+  return a;
 }
 
-void fb_clear() { 
-  memset(framebuffer, 0, sizeof(framebuffer)); 
-  dirty_rect = {0, 0, DISPLAY_W - 1, DISPLAY_H - 1, true};
+void fb_clear() {
+  fb_reconcile_pending = false;  // The clear overwrites the whole frame
+  memset(framebuffer, 0, FB_SIZE);
+  dirty_span_count = 0;
+  fb_mark_dirty(0, 0, DISPLAY_W, DISPLAY_H);
 }
 void fb_pixel(int16_t x, int16_t y, uint8_t color) {
+  fb_reconcile();
   if (x < 0 || x >= DISPLAY_W || y < 0 || y >= DISPLAY_H) return;
   uint16_t byte_idx = x + (y / 8) * DISPLAY_W;
   uint8_t bit = y % 8;
@@ -125,6 +247,7 @@ void fb_pixel(int16_t x, int16_t y, uint8_t color) {
   fb_mark_dirty(x, y, 1, 1);
 }
 void fb_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
+  fb_reconcile();
   fb_mark_dirty(x, y, w, h);  // mark once for the whole rect
   for (int16_t i = x; i < x + w; i++)
     for (int16_t j = y; j < y + h; j++) {
@@ -145,21 +268,10 @@ typedef struct {
   uint8_t reserved[8];
 } AIModelHeader;
 
-static const uint32_t crc32_table[16] = {
-  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
-  0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
-  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
-  0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
-};
-
+// Full-buffer checksums ride the DMA sniffer (sprite_crc.h) - validating
+// an 80KB model no longer burns CPU next to the protocol handler
 uint32_t ai_crc32(const void* data, size_t len) {
-  uint32_t crc = 0xFFFFFFFF;
-  const uint8_t* p = (const uint8_t*)data;
-  for (size_t i = 0; i < len; i++) {
-    crc = crc32_table[(crc ^ p[i]) & 0x0F] ^ (crc >> 4);
-    crc = crc32_table[(crc ^ (p[i] >> 4)) & 0x0F] ^ (crc >> 4);
-  }
-  return ~crc;
+  return crc32_hw(data, len);
 }
 
 static bool fs_init = false;
@@ -199,65 +311,112 @@ void debug_println(const char* msg) {
 
 #if SPRITE_DISPLAY_TYPE == 1
 SSD1306Display sprite_display;
+#elif SPRITE_DISPLAY_TYPE == 2
+ST7789Display sprite_display;
 #else
 SimulatedDisplay sprite_display;
 #endif
 
+// Push all pending dirty spans to the display and reset the list
+void fb_flush_dirty() {
+  for (uint8_t i = 0; i < dirty_span_count; i++) {
+    sprite_display.updateRegion(framebuffer,
+                                dirty_spans[i].x1, dirty_spans[i].y1,
+                                dirty_spans[i].x2, dirty_spans[i].y2);
+  }
+  dirty_span_count = 0;
+}
+
 // ===== Dual-Core Command Queue =====
 
 struct CommandQueueEntry {
   uint8_t cmd;
   uint8_t len;
-  uint8_t payload[64];
+  uint8_t payload[255];
+  uint64_t enq_us;  // Enqueue timestamp (sprite_stats latency tracking)
 };
 
 #if ENABLE_DUAL_CORE
 #include "pico/multicore.h"
 #include "pico/mutex.h"
-
-static mutex_t sprite_lock; // Global lock for queues and state
-
-template<int SIZE>
+#include "hardware/sync.h"
+
+static mutex_t sprite_lock; // Global lock for model/state flags
+
+// Real data barrier + SEV/WFE doorbell between the cores. A compiler
+// fence only orders the instruction stream; DMB orders the actual
+// stores so Core 1 never sees an index move before the payload bytes.
+#define QUEUE_DMB()  __dmb()
+#define QUEUE_SEV()  __sev()
+#define QUEUE_WFE()  __wfe()
+
+// Lock-free SPSC byte ring (Core 0 pushes, Core 1 pops). Records are
+// length-prefixed - [cmd][len][payload][enq_us] - so a 5-byte
+// CMD_PIXEL costs 15 ring bytes instead of a fixed 64-byte slot, and
+// a full 255-byte payload (which the old slots silently truncated)
+// fits the same structure. Indices free-run and are masked on access;
+// SIZE_BYTES must be a power of two. No mutex on this path: the
+// sprite_lock round trip cost more than the copy for small draws.
+template<uint32_t SIZE_BYTES>
 class CommandQueue {
 private:
-  volatile uint8_t q_cmd[SIZE];
-  volatile uint8_t q_len[SIZE];
-  uint8_t q_payload[SIZE][64];
-  volatile uint32_t head;
-  volatile uint32_t tail;
+  uint8_t buf[SIZE_BYTES];
+  volatile uint32_t head;    // Write index (Core 0), free-running
+  volatile uint32_t tail;    // Read index (Core 1), free-running
+  volatile uint32_t pushed;  // Record counters: count() = pushed - popped
+  volatile uint32_t popped;
+
+  static inline uint32_t wrap(uint32_t i) { return i & (SIZE_BYTES - 1); }
+
 public:
-  CommandQueue() : head(0), tail(0) {}
-  
+  CommandQueue() : head(0), tail(0), pushed(0), popped(0) {}
+
   bool push(uint8_t cmd, const uint8_t* payload, uint8_t len) {
-    mutex_enter_blocking(&sprite_lock);
-    uint32_t next = (head + 1) % SIZE;
-    if (next == tail) {
-        mutex_exit(&sprite_lock);
-        return false;
+    uint32_t h = head;
+    uint32_t used = h - tail;
+    if (SIZE_BYTES - used < (uint32_t)(2 + len + 8)) {
+      sprite_stats.noteReject();
+      return false;
     }
-    q_cmd[head] = cmd;
-    q_len[head] = len;
-    if (len > 0 && payload) memcpy(q_payload[head], payload, min((int)len, 64));
-    head = next;
-    mutex_exit(&sprite_lock);
+    uint64_t ts = SpriteStats::now_us();
+    buf[wrap(h++)] = cmd;
+    buf[wrap(h++)] = len;
+    for (uint8_t i = 0; i < len; i++) buf[wrap(h++)] = payload[i];
+    for (uint8_t i = 0; i < 8; i++) buf[wrap(h++)] = (uint8_t)(ts >> (8 * i));
+    QUEUE_DMB();   // Record bytes land before the index moves
+    head = h;
+    pushed = pushed + 1;
+    QUEUE_SEV();   // Doorbell: wake Core 1 out of WFE
+    sprite_stats.noteDepth(count());
     return true;
   }
-  
+
   bool pop(CommandQueueEntry* out) {
-    mutex_enter_blocking(&sprite_lock);
-    if (tail == head) {
-        mutex_exit(&sprite_lock);
-        return false;
-    }
-    out->cmd = q_cmd[tail];
-    out->len = q_len[tail];
-    memcpy(out->payload, q_payload[tail], q_len[tail]);
-    tail = (tail + 1) % SIZE;
-    mutex_exit(&sprite_lock);
+    if (tail == head) return false;
+    QUEUE_DMB();   // Index observed before the record bytes are read
+    uint32_t t = tail;
+    out->cmd = buf[wrap(t++)];
+    uint8_t len = buf[wrap(t++)];
+    out->len = len;
+    for (uint8_t i = 0; i < len; i++) out->payload[i] = buf[wrap(t++)];
+    uint64_t ts = 0;
+    for (uint8_t i = 0; i < 8; i++) ts |= (uint64_t)buf[wrap(t++)] << (8 * i);
+    out->enq_us = ts;
+    QUEUE_DMB();   // Fully consumed before the space is recycled
+    tail = t;
+    popped = popped + 1;
     return true;
   }
-  bool isEmpty() const { return head == tail; } // Reader warning: unprotected
-  bool isFull() const { return ((head + 1) % SIZE) == tail; }
+
+  bool isEmpty() const { return head == tail; } // Reader warning: racy
+  bool isFull() const {
+    return SIZE_BYTES - (head - tail) < (uint32_t)(2 + 255 + 8);
+  }
+  // Advisory depth (records in flight) for the DVFS governor and the
+  // queue-credit event - same racy-reader caveat as before
+  uint16_t count() const { return (uint16_t)(pushed - popped); }
+  uint32_t bytesFree() const { return SIZE_BYTES - (head - tail); }
+  uint32_t pushedCount() const { return pushed; }
 };
 
 struct ResponseEntry {
@@ -267,6 +426,8 @@ struct ResponseEntry {
   uint8_t data[64];
 };
 
+// Response ring (Core 1 pushes, Core 0 pops) - fixed slots, same
+// barrier scheme as the command ring instead of the sprite_lock.
 template<int SIZE>
 class ResponseQueue {
 private:
@@ -279,41 +440,43 @@ private:
 public:
   ResponseQueue() : head(0), tail(0) {}
   bool push(uint8_t cmd, uint8_t status, const uint8_t* data, uint8_t len) {
-    mutex_enter_blocking(&sprite_lock);
-    uint32_t next = (head + 1) % SIZE;
-    if (next == tail) {
-        mutex_exit(&sprite_lock);
-        return false;
-    }
-    r_cmd[head] = cmd;
-    r_status[head] = status;
-    r_len[head] = min((int)len, 64);
-    if (len > 0 && data) memcpy(r_data[head], data, r_len[head]);
+    uint32_t h = head;
+    uint32_t next = (h + 1) % SIZE;
+    if (next == tail) return false;
+    r_cmd[h] = cmd;
+    r_status[h] = status;
+    r_len[h] = min((int)len, 64);
+    if (len > 0 && data) memcpy(r_data[h], data, r_len[h]);
+    QUEUE_DMB();   // Slot contents land before the index moves
     head = next;
-    mutex_exit(&sprite_lock);
     return true;
   }
-  
+
   bool pop(ResponseEntry* out) {
-    mutex_enter_blocking(&sprite_lock);
-    if (tail == head) {
-        mutex_exit(&sprite_lock);
-        return false;
-    }
-    out->cmd = r_cmd[tail];
-    out->status = r_status[tail];
-    out->len = r_len[tail];
-    memcpy(out->data, r_data[tail], r_len[tail]);
-    tail = (tail + 1) % SIZE;
-    mutex_exit(&sprite_lock);
+    uint32_t t = tail;
+    if (t == head) return false;
+    QUEUE_DMB();   // Index observed before the slot is read
+    out->cmd = r_cmd[t];
+    out->status = r_status[t];
+    out->len = r_len[t];
+    memcpy(out->data, r_data[t], out->len);
+    QUEUE_DMB();   // Fully consumed before the slot is recycled
+    tail = (t + 1) % SIZE;
     return true;
   }
   bool isEmpty() const { return head == tail; }
 };
 
-static CommandQueue<16> cmd_queue;
+// 1KB command ring - roughly the SRAM of the old 16 fixed 64-byte
+// slots, but it holds hundreds of small drawing commands
+static CommandQueue<1024> cmd_queue;
 static ResponseQueue<8> response_queue;
 
+// Commands Core 1 has fully executed. Equal to cmd_queue.pushedCount()
+// exactly when the inter-core path is quiescent - a popped-but-still-
+// executing op makes the queue look empty while work is in flight.
+static volatile uint32_t core1_completed = 0;
+
 struct Core1State {
   bool ai_training;
   bool ai_model_ready;
@@ -349,6 +512,9 @@ SpriteEngine sprite_engine;
 static uint8_t sprite_data_pool[MAX_SPRITE_DATA_SIZE];
 static uint16_t sprite_data_used = 0;
 
+// Flash-resident sprite assets (CMD_STORE_FLASH / CMD_LOAD_SPRITE)
+SpriteAssetStore asset_store;
+
 // ===== Model Manager =====
 
 ModelManager model_manager;
@@ -400,6 +566,12 @@ static uint32_t fs_bytes_processed = 0;
 static uint32_t fs_total_bytes = 0;
 static uint32_t fs_crc_accum = 0;
 
+// Streaming load: file is pulled into the image buffer one chunk per
+// fs_task tick instead of one blocking read, so the protocol keeps
+// draining while an 80KB model comes off flash
+#define FS_LOAD_CHUNK 4096
+static uint8_t* fs_load_buf = nullptr;
+
 void fs_task() {
   if (fs_state == FS_IDLE) return;
   
@@ -442,22 +614,71 @@ void fs_task() {
   }
   
   if (fs_state == FS_LOAD_PENDING) {
-    if (load_model(fs_filename)) {
-      log_success("Async Load: Success");
-    } else {
-      log_error("Async Load: Failed");
+    if (!init_fs() || !LittleFS.exists(fs_filename)) {
+      log_error("Async Load: Model file not found");
+      fs_state = FS_IDLE;
+      return;
+    }
+    fs_file = LittleFS.open(fs_filename, "r");
+    if (!fs_file) {
+      log_error("Async Load: Failed to open file");
+      fs_state = FS_IDLE;
+      return;
+    }
+    fs_total_bytes = fs_file.size();
+    fs_load_buf = new uint8_t[fs_total_bytes];
+    if (!fs_load_buf) {
+      log_error("Async Load: OOM");
+      fs_file.close();
+      fs_state = FS_IDLE;
+      return;
+    }
+
+    // First chunk now - enough to validate the header before we commit
+    // to streaming the rest of the file
+    uint32_t chunk = min((uint32_t)FS_LOAD_CHUNK, fs_total_bytes);
+    fs_file.read(fs_load_buf, chunk);
+    fs_bytes_processed = chunk;
+
+    uint32_t file_magic = 0;
+    if (chunk >= 8) memcpy(&file_magic, fs_load_buf, 4);
+    if (file_magic != 0x54525053 /* "SPRT" */) {
+      log_error("Async Load: Bad magic, aborting early");
+      delete[] fs_load_buf;
+      fs_load_buf = nullptr;
+      fs_file.close();
+      fs_state = FS_IDLE;
+      return;
     }
-    fs_state = FS_IDLE;
+
+    log_info("Async Load: Header OK, streaming...");
+    fs_state = FS_LOADING;
     return;
   }
-  
-  if (fs_state == FS_SAVE_PENDING) {
-    if (save_model(fs_filename)) {
-      log_success("Async Save: Success");
-    } else {
-      log_error("Async Save: Failed");
+
+  if (fs_state == FS_LOADING) {
+    // One chunk per tick - command processing runs between chunks
+    uint32_t remaining = fs_total_bytes - fs_bytes_processed;
+    uint32_t chunk = min((uint32_t)FS_LOAD_CHUNK, remaining);
+
+    if (chunk > 0) {
+      fs_file.read(fs_load_buf + fs_bytes_processed, chunk);
+      fs_bytes_processed += chunk;
+    }
+
+    if (fs_bytes_processed >= fs_total_bytes) {
+      fs_file.close();
+      // Whole image in RAM: descriptor walk + zero-copy weight mapping
+      // is the cheap part and runs in one tick
+      uint8_t* buffer = fs_load_buf;
+      fs_load_buf = nullptr;
+      if (adopt_model_image(buffer, fs_total_bytes)) {
+        log_success("Async Load: Success");
+      } else {
+        log_error("Async Load: Failed");
+      }
+      fs_state = FS_IDLE;
     }
-    fs_state = FS_IDLE;
     return;
   }
 }
@@ -505,6 +726,7 @@ void print_memory_status() {
   Serial1.print("KB free / 256KB total");
   if (free < 10000) Serial1.print(" ⚠️");
   debug_println("");
+  print_arena_status(); // Defined after the model - prototype is hoisted
 }
 
 // ===== Filesystem =====
@@ -543,6 +765,41 @@ bool init_fs() {
 static DynamicModel dynamic_model;
 static bool use_dynamic_model = false;
 
+// Persistent model image backing the zero-copy load mode: the dynamic
+// model's weight tensors point into this buffer, so it lives until the
+// next successful load replaces it.
+static uint8_t* model_image = nullptr;
+static size_t model_image_size = 0;
+
+// Per-tag arena breakdown for the boot banner and CMD_MEM_STATS - the
+// answer to "why did prepare_training() return false" in the field.
+void print_arena_status() {
+  static const char* tag_names[ARENA_TAG_COUNT] = {
+    "weights", "layers", "training", "scratch"
+  };
+  Serial1.print("Arena: ");
+  Serial1.print(dynamic_model.arena_used() / 1024);
+  Serial1.print("KB / ");
+  Serial1.print(dynamic_model.arena_capacity() / 1024);
+  Serial1.print("KB (high water ");
+  Serial1.print(dynamic_model.arena_high_water_mark() / 1024);
+  Serial1.print("KB)");
+  for (uint8_t t = 0; t < ARENA_TAG_COUNT; t++) {
+    Serial1.print(t == 0 ? " - " : ", ");
+    Serial1.print(tag_names[t]);
+    Serial1.print(" ");
+    Serial1.print((unsigned long)dynamic_model.arena_tag_used(t));
+  }
+  Serial1.println();
+  if (dynamic_model.arena_last_fail_tag() != 0xFF) {
+    Serial1.print("  Last failed alloc: ");
+    Serial1.print((unsigned long)dynamic_model.arena_last_fail_size());
+    Serial1.print(" bytes (");
+    Serial1.print(tag_names[dynamic_model.arena_last_fail_tag()]);
+    Serial1.println(")");
+  }
+}
+
 // Legacy Static Model (Keep for fallback/training demo)
 static aimodel_t model;
 static ailayer_input_f32_t input_layer;
@@ -554,6 +811,56 @@ static byte param_mem[4096], train_mem[2048], infer_mem[1024];
 float x_train[] = {0, 0, 0, 1, 1, 0, 1, 1};
 float y_train[] = {0, 1, 1, 0};
 
+// ===== Fine-tune sample pool =====
+// Double-buffered: Core0 ingests CMD_FINETUNE_DATA samples into one
+// half while Core1 trains mini-batches out of the other, swapping when
+// the fill side runs out of room - UART arrival and gradient work
+// overlap instead of serializing per sample. 8KB per half.
+#define FT_HALF_FLOATS 2048
+static float ft_pool[2][FT_HALF_FLOATS];
+static volatile uint16_t ft_count[2] = {0, 0};  // samples per half
+static uint16_t ft_used[2] = {0, 0};            // floats used per half
+static volatile uint8_t ft_fill = 0;            // half Core0 writes into
+static volatile bool ft_train_busy = false;     // Core1 owns the other half
+static uint16_t ft_in_floats = 0, ft_out_floats = 0;
+
+// Train every sample in one half, then release it for refilling.
+// Caller holds sprite_lock (dual-core) or is the only core.
+void ft_train_half(uint8_t half) {
+  const float* p = ft_pool[half];
+  uint16_t n = ft_count[half];
+  for (uint16_t s = 0; s < n; s++) {
+    last_loss = dynamic_model.train_step(p, p + ft_in_floats);
+    p += ft_in_floats + ft_out_floats;
+    train_epochs++;
+  }
+  ft_count[half] = 0;
+  ft_used[half] = 0;
+}
+
+// Hand the current fill half to Core1 and flip to the other one.
+// Returns false when Core1 is still training the previous half - the
+// caller surfaces that as busy and the host retries the sample.
+bool ft_dispatch_half() {
+  if (ft_count[ft_fill] == 0) return true;  // Nothing to train
+  #if ENABLE_DUAL_CORE
+  if (ft_train_busy) return false;
+  uint8_t half = ft_fill;
+  ft_train_busy = true;
+  ft_fill = half ^ 1;
+  if (!cmd_queue.push(CMD_FINETUNE_TRAIN, &half, 1)) {
+    ft_train_busy = false;
+    ft_fill = half;
+    return false;
+  }
+  return true;
+  #else
+  // Single-core: no overlap to be had, train inline
+  ft_train_half(ft_fill);
+  return true;
+  #endif
+}
+
 // ===== AI Model =====
 
 void build_model() {
@@ -571,6 +878,10 @@ void build_model() {
   x = ailayer_sigmoid_f32_default(&sigmoid_1, x);
   x = ailayer_dense_f32_default(&dense_2, x);
   model.output_layer = ailayer_sigmoid_f32_default(&sigmoid_2, x);
+  // Fork/join dense forward (tiny XOR layers stay below the fork
+  // threshold, but the hook keeps every model on the same path)
+  dense_1.linear = SpriteMatvec::linear_f32;
+  dense_2.linear = SpriteMatvec::linear_f32;
   model.loss = ailoss_mse_f32_default(&mse_loss, model.output_layer);
   
   aialgo_compile_model(&model);
@@ -735,30 +1046,42 @@ bool load_model(const char* filename) {
   }
   
   size_t size = f.size();
-  uint8_t* buffer = new uint8_t[size]; // Allocate temp buffer
+  uint8_t* buffer = new uint8_t[size]; // Allocate model image buffer
   if (!buffer) {
      log_error("OOM: Cannot allocate model buffer");
      f.close();
      return false;
   }
-  
+
   f.read(buffer, size);
   f.close();
-  
-  // Try to load as Dynamic Model
-  // Try to load as Dynamic Model
+
+  return adopt_model_image(buffer, size);
+}
+
+// Hand a complete in-RAM model image to the loaders. Takes ownership
+// of `buffer`: on success it becomes (or replaces) model_image, on
+// failure it is freed. Shared by the blocking load_model() and the
+// chunked fs_task load path.
+bool adopt_model_image(uint8_t* buffer, size_t size) {
+  // Try to load as Dynamic Model (zero-copy: weights are referenced
+  // straight out of this buffer instead of duplicated into the arena,
+  // so the buffer must outlive the model - see model_image below)
   #if ENABLE_DUAL_CORE
   mutex_enter_blocking(&sprite_lock);
   #endif
-  bool ok = dynamic_model.load(buffer, size);
+  bool ok = dynamic_model.load(buffer, size, false);
   #if ENABLE_DUAL_CORE
   mutex_exit(&sprite_lock);
   #endif
-  
+
   if (ok) {
       log_success("Dynamic Model Loaded Successfully!");
       use_dynamic_model = true;
-      delete[] buffer; 
+      // Keep the image alive for in-place weights; free the previous one
+      if (model_image) delete[] model_image;
+      model_image = buffer;
+      model_image_size = size;
       return true;
   }
   
@@ -805,17 +1128,64 @@ bool load_model(const char* filename) {
 static uint8_t rx_state = 0, rx_cmd, rx_len, rx_pos;
 static uint8_t rx_buf[300]; // Increased for full packets
 
-// Upload State
-static File upload_file;
-static bool is_uploading = false;
-static uint32_t upload_expected_crc = 0;
-static uint32_t upload_recv_crc = 0;
+// Upload state lives in ModelManager now (streaming beginUpload /
+// writeChunk / finishUpload with incremental CRC)
+
+// Pipelined mode (CMD_PIPELINE): plain ACKs for streamed drawing/sprite
+// commands are coalesced into periodic credit-refill frames instead of
+// one response per command. Errors always go out immediately.
+static bool pipeline_mode = false;
+static uint8_t pipeline_window = 16;   // Credit window the host declared
+static uint16_t pipeline_done = 0;     // Completed-but-unacked commands
+
+// Event push channel (CMD_EVENT frames): bitmask of subscribed event
+// types, bit (type-1). Zero = silent, the pre-event default.
+static uint8_t events_mask = 0;
+static volatile bool cmd_queue_was_full = false;
+
+bool event_enabled(uint8_t type) {
+  return (events_mask & (1u << (type - 1))) != 0;
+}
+
+// Push one unsolicited frame. Core0 only - Core1 goes through the
+// response queue (core1_send_event) so transport writes stay serialized.
+void send_event(uint8_t type, const uint8_t* data, uint8_t len) {
+  if (!event_enabled(type)) return;
+  send_response(CMD_EVENT, type, data, len);
+}
+
+// Graphics/sprite/batch traffic is safe to coalesce; anything that
+// returns data keeps its individual response (the len==0 check in
+// send_response covers queries inside the range, e.g. SPRITE_COLLISION)
+bool pipeline_cmd(uint8_t cmd) {
+  return (cmd >= CMD_CLEAR && cmd <= CMD_SPRITE_CLEAR) || cmd == CMD_BATCH;
+}
+
+void pipeline_flush_credits() {
+  if (pipeline_done == 0) return;
+  uint8_t body[2];
+  body[0] = (uint8_t)(pipeline_done & 0xFF);
+  body[1] = (uint8_t)(pipeline_done >> 8);
+  pipeline_done = 0;
+  // CMD_PIPELINE is not a coalescable command, so this passes straight
+  // through send_response
+  send_response(CMD_PIPELINE, RESP_OK, body, 2);
+}
 
 // Forward decl
 uint32_t crc32_byte(uint32_t crc, uint8_t data); 
 
 void send_response(uint8_t cmd, uint8_t status, const uint8_t* data, uint8_t len) {
   if (!active_transport) return;
+
+  if (pipeline_mode && status == RESP_OK && len == 0 && pipeline_cmd(cmd)) {
+    // Coalesce: count the completion, refill once half the window is used
+    pipeline_done++;
+    if (pipeline_done >= (uint16_t)((pipeline_window + 1) / 2)) {
+      pipeline_flush_credits();
+    }
+    return;
+  }
   
   active_transport->write(SPRITE_HEADER);
   
@@ -844,7 +1214,14 @@ void send_response(uint8_t cmd, uint8_t status, const uint8_t* data, uint8_t len
   active_transport->write((uint8_t)((final_crc >> 24) & 0xFF));
 }
 
+static uint32_t last_cmd_ms = 0;  // Idle tracking for the DVFS governor
+
 void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
+  // Core0-direct commands are timed here; queued commands get stamped
+  // at push and recorded when Core 1 completes them
+  uint64_t stats_t0 = SpriteStats::now_us();
+  last_cmd_ms = millis();
+
   #if ENABLE_DUAL_CORE
   // Commands that run on Core1 (AI/Display)
   if (cmd >= CMD_CLEAR && cmd <= CMD_SPRITE_CLEAR) {
@@ -853,14 +1230,20 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       // Will be processed asynchronously, check response queue later
       return;
     } else {
+      cmd_queue_was_full = true;  // Credit event fires once it drains
       send_response(cmd, RESP_ERROR, nullptr, 0);  // Queue full
       return;
     }
   }
   if (cmd >= CMD_AI_INFER && cmd <= CMD_FINETUNE_STOP) {
 
-    if (cmd == CMD_AI_SAVE || cmd == CMD_AI_LOAD) {
-      // Handled on Core0 (fall through)
+    if (cmd == CMD_AI_SAVE || cmd == CMD_AI_LOAD || cmd == CMD_AI_INFER_BATCH ||
+        cmd == CMD_FINETUNE_START || cmd == CMD_FINETUNE_DATA ||
+        cmd == CMD_FINETUNE_STOP) {
+      // Handled on Core0 (fall through) - batch payloads exceed the
+      // 64-byte queue slot, so batching runs where the full rx_buf lives.
+      // Fine-tune ingestion also stays here: Core0 fills one pool half
+      // while Core1 trains the other, which is the whole overlap.
     } else {
       // Check for conflicts
       if (fs_state != FS_IDLE) {
@@ -871,6 +1254,7 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       if (cmd_queue.push(cmd, payload, len)) {
         return;
       } else {
+        cmd_queue_was_full = true;
         send_response(cmd, RESP_ERROR, nullptr, 0);
         return;
       }
@@ -886,6 +1270,60 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       break;
     }
     
+    case CMD_PIPELINE: { // 0x71: enter/leave fire-and-forget mode
+      // Payload: [enable u8][credit_window u8 (optional, default 16)]
+      if (len < 1) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+      if (payload[0]) {
+        pipeline_window = (len >= 2 && payload[1] > 0) ? payload[1] : 16;
+        pipeline_done = 0;
+        pipeline_mode = true;
+        uint8_t resp[1] = { pipeline_window };
+        send_response(cmd, RESP_OK, resp, 1);
+      } else {
+        #if ENABLE_DUAL_CORE
+        // Drain Core 1 before acking: an op still executing there (a
+        // queued CMD_FLUSH is ~15ms) would otherwise complete after
+        // pipeline_mode clears and go out as a lone response frame
+        // *behind* the disable ACK - the host's next command would
+        // consume it as its own response and the link desyncs. Pump
+        // the response queue while waiting so completions are counted
+        // as credits, not stranded. Bounded like the FINETUNE_STOP
+        // flush in case Core 1 is wedged in something long.
+        uint32_t drain_start = millis();
+        for (;;) {
+          // Sample quiescence *before* pumping: Core 1 pushes the
+          // response first and bumps core1_completed after, so a true
+          // sample means every response is already queued and the pump
+          // below gets it. Checking after the pump would let a final
+          // response land between pump and check and leak past the ACK.
+          bool quiet = cmd_queue.isEmpty() &&
+                       core1_completed == cmd_queue.pushedCount();
+          ResponseEntry done;
+          while (response_queue.pop(&done)) {
+            send_response(done.cmd, done.status, done.data, done.len);
+          }
+          if (quiet) break;
+          if (millis() - drain_start > 500) break;
+        }
+        #endif
+        pipeline_flush_credits(); // Outstanding credits first, then the ack
+        pipeline_mode = false;
+        send_response(cmd, RESP_OK, nullptr, 0);
+      }
+      break;
+    }
+
+    case CMD_EVENTS: { // 0x72: subscribe/unsubscribe push events
+      // Payload: [mask u8] - bit (type-1) per event type, 0 = silent.
+      // Response: the mask now in effect.
+      if (len >= 1) events_mask = payload[0];
+      send_response(cmd, RESP_OK, &events_mask, 1);
+      break;
+    }
+
     case CMD_BATCH: {
       // Execute multiple commands in a single packet
       // Payload format: [CMD1, LEN1, DATA1...], [CMD2, LEN2, DATA2...]
@@ -909,6 +1347,61 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       break;
     }
     
+    case CMD_STATS: { // 0x0C: performance counters
+      // Payload: optional [reset u8] - nonzero clears all counters.
+      // Response: see SpriteStats::serialize for the wire format.
+      if (len >= 1 && payload[0]) {
+        sprite_stats.reset();
+        send_response(cmd, RESP_OK, nullptr, 0);
+        break;
+      }
+      static uint8_t stats_buf[192];
+      uint8_t n = sprite_stats.serialize(stats_buf, sizeof(stats_buf));
+      send_response(cmd, n ? RESP_OK : RESP_ERROR, stats_buf, n);
+      break;
+    }
+
+    case CMD_MEM_STATS: { // 0x0B: arena + heap breakdown
+      // Response: free_heap(4) arena_cap(4) arena_used(4) high_water(4)
+      //           tag_used[4x4] (weights/layers/training/scratch)
+      //           last_fail_size(4) last_fail_tag(1) - all u32 LE
+      uint8_t resp[37];
+      uint32_t v;
+      v = get_free_ram();                                memcpy(resp, &v, 4);
+      v = (uint32_t)dynamic_model.arena_capacity();      memcpy(resp + 4, &v, 4);
+      v = (uint32_t)dynamic_model.arena_used();          memcpy(resp + 8, &v, 4);
+      v = (uint32_t)dynamic_model.arena_high_water_mark(); memcpy(resp + 12, &v, 4);
+      for (uint8_t t = 0; t < ARENA_TAG_COUNT; t++) {
+        v = (uint32_t)dynamic_model.arena_tag_used(t);
+        memcpy(resp + 16 + 4 * t, &v, 4);
+      }
+      v = (uint32_t)dynamic_model.arena_last_fail_size(); memcpy(resp + 32, &v, 4);
+      resp[36] = dynamic_model.arena_last_fail_tag();
+      send_response(cmd, RESP_OK, resp, sizeof(resp));
+      break;
+    }
+
+    case CMD_SET_BAUD: { // 0x0D: negotiate UART baud
+      // Payload: new baud rate (u32 LE). ACK goes out at the old baud,
+      // then the UART divisor is re-programmed - the host switches after
+      // it sees the OK. Only touches the hardware UART; harmless on USB.
+      if (len < 4) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+      uint32_t baud;
+      memcpy(&baud, payload, 4);
+      if (baud < 9600 || baud > 3000000) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+      send_response(cmd, RESP_OK, (uint8_t*)&baud, 4);
+      if (active_transport) active_transport->flush();
+      delay(2); // Let the last stop bit leave the shifter
+      transport.setBaud(baud);
+      break;
+    }
+
     case CMD_BUFFER_STATUS: {
       // Report available RX buffer space for flow control
       uint16_t free_space = sizeof(rx_buf);  // Full buffer size available
@@ -923,6 +1416,27 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       send_response(cmd, RESP_OK, nullptr, 0);
       break;
 
+    case CMD_TEXT: {
+      // Payload: x(2) y(2) color(1) text(...) - matches the host libs.
+      // One packet instead of a per-pixel flood for a status line.
+      if (len < 6) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+      int16_t x, y;
+      memcpy(&x, payload, 2);
+      memcpy(&y, payload + 2, 2);
+      fb_reconcile();
+      uint16_t w = font_draw_text(framebuffer, DISPLAY_W, DISPLAY_H,
+                                  x, y, (const char*)payload + 5,
+                                  len - 5, payload[4]);
+      // The advance covers clipped glyphs too; fb_mark_dirty trims the
+      // box to what actually landed on screen
+      if (w > 0) fb_mark_dirty(x, y, w, 8);
+      send_response(cmd, RESP_OK, nullptr, 0);
+      break;
+    }
+
     case CMD_AI_SAVE:
       if (len > 0) {
         if (fs_state != FS_IDLE || is_training()) {
@@ -970,23 +1484,18 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       
     case CMD_FLUSH:
       // Update physical display
-      if (dirty_rect.is_dirty) {
-        // Use dirty rectangle for partial update
-        sprite_display.updateRegion(framebuffer, 
-                                    dirty_rect.x1, dirty_rect.y1,
-                                    dirty_rect.x2, dirty_rect.y2);
-        
-        uint16_t area = (dirty_rect.x2 - dirty_rect.x1 + 1) * 
-                        (dirty_rect.y2 - dirty_rect.y1 + 1);
-        #if SPRITE_VERBOSE
-        Serial1.print("[FLUSH] Updated ");
-        Serial1.print(area);
-        Serial1.println(" pixels on display");
-        #endif
-        dirty_rect.is_dirty = false;  // Reset
+      if (dirty_span_count > 0 && fb_dirty_area() <= FB_FLIP_AREA) {
+        // Small deltas: blocking partial page pushes beat a full frame
+        fb_flush_dirty();
+      } else if (dirty_span_count > 0) {
+        // Big update: flip and hand the front buffer to the DMA path -
+        // the next frame composes into the back buffer during scan-out
+        fb_flip();
+        sprite_display.flushAsync(fb_front);
       } else {
-        // Full refresh if no dirty tracking
-        sprite_display.update(framebuffer);
+        // Nothing drawn since the last flush: re-send the newest frame
+        sprite_display.flushAsync(fb_reconcile_pending ? fb_front
+                                                       : framebuffer);
       }
       send_response(cmd, RESP_OK, nullptr, 0);
       break;
@@ -1088,8 +1597,16 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
     }
     
     case CMD_SPRITE_RENDER: {
-      // Render all sprites to framebuffer
-      sprite_engine.render(framebuffer, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+      // Recomposite only the regions touched since the last render
+      fb_reconcile();
+      uint8_t n = sprite_engine.renderDirty(framebuffer, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+      SpriteDirtyRect r;
+      for (uint8_t i = 0; i < n; i++) {
+        if (sprite_engine.getDirty(i, &r)) {
+          fb_mark_dirty(r.x1, r.y1, r.x2 - r.x1 + 1, r.y2 - r.y1 + 1);
+        }
+      }
+      sprite_engine.clearDirty();
       send_response(cmd, RESP_OK, nullptr, 0);
       break;
     }
@@ -1101,7 +1618,49 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       send_response(cmd, RESP_OK, nullptr, 0);
       break;
     }
-      
+
+    // ===== Asset Commands =====
+
+    case CMD_STORE_FLASH: {
+      // Payload: asset_id(1) w(1) h(1) fmt(1) data(...)
+      // fmt 0 = raw 1bpp, fmt 1 = RLE [count][value] pairs
+      if (len < 5) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+      if (fs_state != FS_IDLE) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);  // FS busy
+        break;
+      }
+      bool ok = asset_store.store(payload[0], payload[1], payload[2],
+                                  payload[3], payload + 4, len - 4);
+      send_response(cmd, ok ? RESP_OK : RESP_ERROR, nullptr, 0);
+      break;
+    }
+
+    case CMD_LOAD_SPRITE: {
+      // Payload: asset_id(1) sprite_id(1) x(2) y(2) layer(1) flags(1)
+      // Binds a flash asset to a sprite slot - hot assets come from the
+      // LRU cache, cold ones fault in from LittleFS
+      if (len < 8) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+      uint8_t w, h;
+      const uint8_t* data = asset_store.get(payload[0], &w, &h);
+      if (!data) {
+        send_response(cmd, RESP_NOT_FOUND, nullptr, 0);
+        break;
+      }
+      int16_t x, y;
+      memcpy(&x, payload + 2, 2);
+      memcpy(&y, payload + 4, 2);
+      bool ok = sprite_engine.add(payload[1], x, y, w, h, data,
+                                  payload[7], payload[6]);
+      send_response(cmd, ok ? RESP_OK : RESP_ERROR, nullptr, 0);
+      break;
+    }
+
     case CMD_AI_INFER: {
       if (len >= 8 && model_ready) {
         float in0, in1;
@@ -1115,6 +1674,78 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       break;
     }
     
+    case CMD_AI_INFER_BATCH: { // 0x5A: N samples in, N results out
+      // Payload: [count u8][row0][row1]... where each row is
+      // input_count floats. Response: [count u8][out0][out1]... with
+      // output_count floats per row. One packet each way - per-sample
+      // protocol overhead becomes per-batch overhead.
+      if (len < 1 || !model_ready) {
+        send_response(cmd, model_ready ? RESP_ERROR : RESP_NOT_FOUND, nullptr, 0);
+        break;
+      }
+
+      uint8_t count = payload[0];
+      uint16_t in_c = use_dynamic_model ? dynamic_model.get_input_count() : 2;
+      uint16_t out_c = use_dynamic_model ? dynamic_model.get_output_count() : 1;
+      uint32_t row_bytes = (uint32_t)in_c * sizeof(float);
+      uint32_t out_bytes = (uint32_t)out_c * sizeof(float);
+
+      // Rows must all be present, all outputs must fit one response,
+      // and a row must fit the stack buffer below. 32-bit math - at
+      // in_c = 128 the products overflow a u16 and the checks pass on
+      // garbage.
+      if (count == 0 || in_c > 128 ||
+          1 + (uint32_t)count * row_bytes > (uint32_t)len ||
+          1 + (uint32_t)count * out_bytes > SPRITE_MAX_RESPONSE) {
+        send_response(cmd, RESP_ERROR, nullptr, 0);
+        break;
+      }
+
+      static uint8_t batch_out[SPRITE_MAX_RESPONSE];
+      batch_out[0] = count;
+      uint8_t* out_ptr = batch_out + 1;
+
+      if (use_dynamic_model && dynamic_model.is_loaded()) {
+        // Tight loop over the persistent inference plan; the input rows
+        // are fed in place from the request payload
+        #if ENABLE_DUAL_CORE
+        mutex_enter_blocking(&sprite_lock);
+        #endif
+        bool ok = true;
+        for (uint8_t i = 0; i < count && ok; i++) {
+          float row[128]; // in_c capped at 128 above - infer() reads all of it
+          memcpy(row, payload + 1 + i * row_bytes, row_bytes);
+          float* results = dynamic_model.infer(row);
+          if (results) {
+            memcpy(out_ptr, results, out_bytes);
+            out_ptr += out_bytes;
+          } else {
+            ok = false;
+          }
+        }
+        #if ENABLE_DUAL_CORE
+        mutex_exit(&sprite_lock);
+        #endif
+        if (!ok) {
+          send_response(cmd, RESP_ERROR, nullptr, 0);
+          break;
+        }
+      } else {
+        // Legacy static model: 2 inputs -> 1 output per row
+        for (uint8_t i = 0; i < count; i++) {
+          float in0, in1;
+          memcpy(&in0, payload + 1 + i * row_bytes, 4);
+          memcpy(&in1, payload + 5 + i * row_bytes, 4);
+          float result = do_inference_int8(in0, in1);
+          memcpy(out_ptr, &result, 4);
+          out_ptr += 4;
+        }
+      }
+
+      send_response(cmd, RESP_OK, batch_out, (uint8_t)(1 + count * out_bytes));
+      break;
+    }
+
     case CMD_AI_TRAIN: {
       uint8_t epochs = len > 0 ? payload[0] : 100;
       do_train(epochs);
@@ -1206,80 +1837,69 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       memcpy(filename, payload, len);
       filename[len] = '\0';
       
-      if (is_uploading && upload_file) upload_file.close();
-      
       // Ensure we are not training
-      if (is_training()) { 
-          send_response(cmd, RESP_ERROR, nullptr, 0); 
-          break; 
+      if (is_training()) {
+          send_response(cmd, RESP_ERROR, nullptr, 0);
+          break;
       }
-      
-      upload_file = LittleFS.open(filename, "w");
-      if (!upload_file) {
+
+      // Streaming upload: chunks go straight to a temp file, the old
+      // model is only replaced on a verified finishUpload()
+      if (!model_manager.beginUpload(filename)) {
           send_response(cmd, RESP_ERROR, nullptr, 0);
           break;
       }
-      
-      is_uploading = true;
-      upload_recv_crc = 0xFFFFFFFF; // Init CRC for full file
+
       send_response(cmd, RESP_OK, nullptr, 0);
       break;
     }
 
     case 0x68: { // CMD_UPLOAD_CHUNK
-        if (!is_uploading || !upload_file) {
+        if (!model_manager.isUploading()) {
             send_response(cmd, RESP_ERROR, nullptr, 0);
             break;
         }
-        
-        // Write chunk
-        if (len > 0) {
-            size_t written = upload_file.write(payload, len);
-            if (written != len) {
-                upload_file.close();
-                is_uploading = false;
-                send_response(cmd, RESP_ERROR, nullptr, 0); // Write failed
-                break;
-            }
-            // Update full file CRC
-            for(int i=0; i<len; i++) {
-                upload_recv_crc = crc32_byte(upload_recv_crc, payload[i]);
-            }
+
+        // Write chunk (CRC accumulates incrementally in the manager)
+        if (!model_manager.writeChunk(payload, len)) {
+            send_response(cmd, RESP_ERROR, nullptr, 0); // Write failed
+            break;
         }
         send_response(cmd, RESP_OK, nullptr, 0);
         break;
     }
 
     case 0x69: { // CMD_UPLOAD_END
-        if (!is_uploading || !upload_file) {
+        if (!model_manager.isUploading()) {
              send_response(cmd, RESP_ERROR, nullptr, 0);
              break;
         }
-        
-        upload_file.close();
-        is_uploading = false;
-        
+
         // Verify CRC if provided?
         // Payload: Expected CRC32 (4 bytes)
         if (len >= 4) {
              uint32_t expected_crc;
              memcpy(&expected_crc, payload, 4);
-             uint32_t final_crc = ~upload_recv_crc;
-             
-             if (final_crc != expected_crc) {
+
+             if (model_manager.uploadCrc() != expected_crc) {
                  log_error("Upload CRC Mismatch!");
-                 // Delete broken file?
-                 // LittleFS.remove(filename?); // Don't have filename here easily 
+                 model_manager.abortUpload(); // Temp file dropped, old model untouched
                  send_response(cmd, RESP_ERROR, nullptr, 0); // CRC Fail
                  break;
              }
         }
-        
+
+        if (!model_manager.finishUpload()) {
+             log_error("Upload finalize failed");
+             send_response(cmd, RESP_ERROR, nullptr, 0);
+             break;
+        }
+
         log_success("Upload Complete & Verified");
-        
+
         // Auto-select if it was model.aif32?
         // Let user select manually or reload.
-        
+
         send_response(cmd, RESP_OK, nullptr, 0);
         break;
     }
@@ -1313,6 +1933,14 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
         #if ENABLE_DUAL_CORE
         mutex_exit(&sprite_lock);
         #endif
+        if (ok) {
+          // Arm the double-buffered sample pool
+          ft_in_floats = dynamic_model.get_input_count();
+          ft_out_floats = dynamic_model.get_output_count();
+          ft_count[0] = ft_count[1] = 0;
+          ft_used[0] = ft_used[1] = 0;
+          ft_fill = 0;
+        }
       } else if (model_ready) {
         // Prepare legacy model for training
         aiopti_adam_f32_t adam = AIOPTI_ADAM_F32(lr, 0.9f, 0.999f, 1e-7);
@@ -1329,21 +1957,23 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       if (len == 0) { send_response(cmd, RESP_ERROR, nullptr, 0); break; }
       
       bool ok = false;
-      if (use_dynamic_model && dynamic_model.is_loaded()) {
-        uint16_t in_c = dynamic_model.get_input_count();
-        uint16_t out_c = dynamic_model.get_output_count();
-        if (len >= (in_c + out_c) * 4) {
-          float* sample_in = (float*)payload;
-          float* sample_tar = (float*)(payload + in_c * 4);
-          
-          #if ENABLE_DUAL_CORE
-          mutex_enter_blocking(&sprite_lock);
-          #endif
-          last_loss = dynamic_model.train_step(sample_in, sample_tar);
-          #if ENABLE_DUAL_CORE
-          mutex_exit(&sprite_lock);
-          #endif
-          train_epochs++;
+      if (use_dynamic_model && dynamic_model.is_loaded() && ft_in_floats > 0) {
+        // Ingest into the fill half - the copy is microseconds, so the
+        // ACK goes out while Core1 grinds batches from the other half
+        uint16_t sample_floats = ft_in_floats + ft_out_floats;
+        if (len >= sample_floats * 4) {
+          if (ft_used[ft_fill] + sample_floats > FT_HALF_FLOATS) {
+            // Fill side full: swap halves and post the full one to Core1
+            if (!ft_dispatch_half()) {
+              // Both halves occupied - trainer is behind, host retries
+              send_response(cmd, RESP_ERROR, nullptr, 0);
+              break;
+            }
+          }
+          memcpy(&ft_pool[ft_fill][ft_used[ft_fill]], payload,
+                 sample_floats * 4);
+          ft_used[ft_fill] += sample_floats;
+          ft_count[ft_fill] = ft_count[ft_fill] + 1;
           ok = true;
         }
       } else if (model_ready) {
@@ -1370,11 +2000,16 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
     }
     
     case CMD_FINETUNE_STOP: {
-      if (use_dynamic_model) {
-        // Dynamic model training state clean up? 
-        // AIfES doesn't strictly need it, but we can reset the flag.
+      // Flush the partial fill half. If Core1 is mid-batch on the other
+      // one, wait for it to free up (bounded - a half is a few dozen
+      // samples at most) before posting the last batch.
+      uint32_t ft_t0 = millis();
+      while (!ft_dispatch_half() && millis() - ft_t0 < 500) {
+        delayMicroseconds(100);
       }
-      send_response(cmd, RESP_OK, nullptr, 0);
+      // last_loss covers the most recent COMPLETED batch; the final one
+      // may still be training - hosts poll CMD_AI_STATUS for the tail
+      send_response(cmd, RESP_OK, (uint8_t*)&last_loss, 4);
       break;
     }
 
@@ -1475,6 +2110,8 @@ void handle_command(uint8_t cmd, const uint8_t* payload, uint8_t len) {
       send_response(cmd, RESP_ERROR, nullptr, 0);
       break;
   }
+
+  sprite_stats.record(cmd, stats_t0, SpriteStats::now_us());
 }
 
 // ===== Main =====
@@ -1506,12 +2143,29 @@ void core1_handle_command(const void* entry_ptr) {
       if (len >= 5) { fb_rect(payload[0], payload[1], payload[2], payload[3], payload[4]); core1_send_response(cmd, RESP_OK, nullptr, 0); }
       else core1_send_response(cmd, RESP_ERROR, nullptr, 0);
       break;
+    case CMD_TEXT:
+      // Payload: x(2) y(2) color(1) text(...)
+      if (len >= 6) {
+        int16_t tx, ty;
+        memcpy(&tx, payload, 2);
+        memcpy(&ty, payload + 2, 2);
+        fb_reconcile();
+        uint16_t tw = font_draw_text(framebuffer, DISPLAY_W, DISPLAY_H,
+                                     tx, ty, (const char*)payload + 5,
+                                     len - 5, payload[4]);
+        if (tw > 0) fb_mark_dirty(tx, ty, tw, 8);  // clamped to screen
+        core1_send_response(cmd, RESP_OK, nullptr, 0);
+      } else core1_send_response(cmd, RESP_ERROR, nullptr, 0);
+      break;
     case CMD_FLUSH:
-      if (dirty_rect.is_dirty) {
-        sprite_display.updateRegion(framebuffer, dirty_rect.x1, dirty_rect.y1, dirty_rect.x2, dirty_rect.y2);
-        dirty_rect.is_dirty = false;
+      if (dirty_span_count > 0 && fb_dirty_area() <= FB_FLIP_AREA) {
+        fb_flush_dirty();
+      } else if (dirty_span_count > 0) {
+        fb_flip();
+        sprite_display.flushAsync(fb_front);
       } else {
-        sprite_display.update(framebuffer);
+        sprite_display.flushAsync(fb_reconcile_pending ? fb_front
+                                                       : framebuffer);
       }
       core1_send_response(cmd, RESP_OK, nullptr, 0);
       break;
@@ -1551,6 +2205,22 @@ void core1_handle_command(const void* entry_ptr) {
         memcpy(resp + 4, &last_loss, 4);
         core1_send_response(cmd, RESP_OK, resp, 8);
       } break;
+    case CMD_FINETUNE_TRAIN: {
+        // Internal job from ft_dispatch_half(): train one pool half.
+        // No host response - every sample was already ACKed at ingest.
+        uint8_t half = payload[0];
+        set_training(true);
+        mutex_enter_blocking(&sprite_lock);
+        ft_train_half(half);
+        mutex_exit(&sprite_lock);
+        set_training(false);
+        ft_train_busy = false;  // Half is empty, Core0 may swap into it
+        if (event_enabled(EVT_TRAIN_DONE)) {
+          // Rides the response queue - Core0 serializes transport writes
+          core1_send_response(CMD_EVENT, EVT_TRAIN_DONE,
+                              (uint8_t*)&last_loss, 4);
+        }
+      } break;
     case CMD_AI_SAVE:
     case CMD_AI_LOAD:
     case CMD_MODEL_INFO:
@@ -1558,9 +2228,6 @@ void core1_handle_command(const void* entry_ptr) {
     case CMD_MODEL_SELECT:
     case CMD_MODEL_UPLOAD:
     case CMD_MODEL_DELETE:
-    case CMD_FINETUNE_START:
-    case CMD_FINETUNE_DATA:
-    case CMD_FINETUNE_STOP:
       core1_send_response(cmd, RESP_OK, nullptr, 0);
       break;
     default:
@@ -1574,10 +2241,18 @@ void core1_loop() {
   while (true) {
     if (cmd_queue.pop(&cmd)) {
       core1_handle_command(&cmd);
-    } else {
-      // core1_state.free_cycles++;
+      // Queue wait + execution, measured from the enqueue stamp
+      sprite_stats.record(cmd.cmd, cmd.enq_us, SpriteStats::now_us());
+      core1_completed = core1_completed + 1;  // After the response push
+    } else if (!SpriteMatvec::poll()) {
+      // Nothing queued and no posted dense-layer half: park until a
+      // doorbell. Both cmd_queue.push and SpriteMatvec's job post issue
+      // SEV after their barriers, and WFE falls straight through when
+      // the event register is already set, so a push racing this spot
+      // is not lost - wakeup is a few cycles instead of the old 10us
+      // poll tick.
+      QUEUE_WFE();
     }
-    delayMicroseconds(10);
   }
 }
 
@@ -1606,9 +2281,13 @@ void setup() {
   memcpy(device_id, id.id, 8);
   
   randomSeed(analogRead(A0));
-  
+
   init_fs();
-  
+  SpriteCRC::begin(); // Claim the checksum DMA channel up front
+  asset_store.begin(&sprite_engine); // Flash sprite assets + LRU cache
+  governor.begin();   // DVFS: temp sensor + current clock snapshot
+  SpriteMatvec::begin(); // Claim the fork/join spinlock
+
   // Prepare Models (F32 & INT8)
   build_model();
   build_model_int8();
@@ -1734,6 +2413,9 @@ void setup() {
 }
 
 void loop() {
+  // Help Core 1 with a posted dense-layer half (training/inference)
+  SpriteMatvec::poll();
+
   // Run FS background task
   fs_task();
   
@@ -1746,22 +2428,29 @@ void loop() {
     }
   }
   
-  // Process data from active transport
-  if (active_transport && active_transport->available()) {
-    uint8_t b = active_transport->read();
-    
-    switch (rx_state) {
-      case 0: if (b == SPRITE_HEADER) rx_state = 1; break;
-      case 1: rx_cmd = b; rx_state = 2; break;
-      case 2: rx_len = b; rx_pos = 0; rx_state = rx_len > 0 ? 3 : 4; break;
-      case 3: 
-        if (rx_pos < sizeof(rx_buf)) rx_buf[rx_pos++] = b;
-        if (rx_pos >= rx_len) rx_state = 4;
-        break;
-      case 4:
-        handle_command(rx_cmd, rx_buf, rx_len);
-        rx_state = 0;
-        break;
+  // Process data from active transport - drained in bulk, not a byte
+  // per loop() pass (the UART side is fed by a DMA ring, see
+  // sprite_transport.h, so at 921600+ baud a burst of drawing commands
+  // lands here as one chunk)
+  if (active_transport) {
+    uint8_t chunk[64];
+    int n = active_transport->readBytes(chunk, sizeof(chunk));
+    for (int i = 0; i < n; i++) {
+      uint8_t b = chunk[i];
+
+      switch (rx_state) {
+        case 0: if (b == SPRITE_HEADER) rx_state = 1; break;
+        case 1: rx_cmd = b; rx_state = 2; break;
+        case 2: rx_len = b; rx_pos = 0; rx_state = rx_len > 0 ? 3 : 4; break;
+        case 3:
+          if (rx_pos < sizeof(rx_buf)) rx_buf[rx_pos++] = b;
+          if (rx_pos >= rx_len) rx_state = 4;
+          break;
+        case 4:
+          handle_command(rx_cmd, rx_buf, rx_len);
+          rx_state = 0;
+          break;
+      }
     }
   }
   
@@ -1772,7 +2461,52 @@ void loop() {
     send_response(resp.cmd, resp.status, resp.data, resp.len);
   }
   #endif
-  
+
+  // Event push channel: completion and flow-control notifications the
+  // host subscribed to via CMD_EVENTS, replacing status polling
+  if (events_mask) {
+    if (event_enabled(EVT_FLUSH_DONE) && sprite_display.flushTakeDone()) {
+      send_event(EVT_FLUSH_DONE, nullptr, 0);
+    }
+    #if ENABLE_DUAL_CORE
+    if (cmd_queue_was_full && event_enabled(EVT_QUEUE_CREDIT) &&
+        cmd_queue.bytesFree() >= 512) {
+      cmd_queue_was_full = false;
+      // Conservative slot estimate: small draw records are ~16 ring bytes
+      uint32_t est = cmd_queue.bytesFree() / 16;
+      uint8_t free_slots = est > 255 ? 255 : (uint8_t)est;
+      send_event(EVT_QUEUE_CREDIT, &free_slots, 1);
+    }
+    #endif
+  }
+
+  // Pipelined mode: once the wire is quiet and the queue has drained,
+  // flush any remaining coalesced ACKs as a credit frame so the host is
+  // never left waiting on a partial window
+  if (pipeline_mode && pipeline_done > 0) {
+    bool drained = !(active_transport && active_transport->available());
+    #if ENABLE_DUAL_CORE
+    drained = drained && cmd_queue.isEmpty();
+    #endif
+    if (drained) pipeline_flush_credits();
+  }
+
+  // DVFS governor: turbo while training or the queue backs up, drop to
+  // an undervolted 50MHz when the device has just been waiting on the
+  // wire. Every reclock re-tunes the dividers derived from clk_sys:
+  // the UART (clk_peri follows clk_sys) and the display bus.
+  {
+    uint16_t gov_depth = 0;
+    #if ENABLE_DUAL_CORE
+    gov_depth = cmd_queue.count();
+    #endif
+    uint32_t idle_ms = millis() - last_cmd_ms;
+    if (governor.update(gov_depth, is_training(), idle_ms)) {
+      transport.reapplyBaud();
+      sprite_display.reclock(); // I2C / PIO SPI dividers track clk_sys too
+    }
+  }
+
   delay(1);
 }
 
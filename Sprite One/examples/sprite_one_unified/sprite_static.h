@@ -0,0 +1,113 @@
+/*
+ * sprite_static.h
+ * Compile-time specialized inference for fixed deployments.
+ *
+ * DynamicModel (sprite_dynamic.h) pays for generality on every call:
+ * descriptor parsing, arena bookkeeping, and AIfES dispatch with
+ * runtime shapes. When the topology never changes, none of that buys
+ * anything - so StaticModel bakes the layer sizes into the types.
+ * Loop bounds are template constants the compiler fully unrolls or
+ * vectorizes as it sees fit, activations are fused into the layer's
+ * output pass instead of being separate AIfES layers, and the
+ * inter-layer buffers are fixed-size arrays - no arena, no scheduler.
+ *
+ * Instantiations are not written by hand: tools/gen_static_model.py
+ * emits a header from an .aif32 file (weights as flash-resident
+ * arrays, the StaticModel typedef, and an infer() wrapper). Dense
+ * chains only - models with conv layers keep using DynamicModel.
+ */
+
+#ifndef SPRITE_STATIC_H
+#define SPRITE_STATIC_H
+
+#include <stdint.h>
+#include <math.h>
+
+// Activation fused into the dense output pass (one loop over OUT,
+// not a separate layer walking the tensor a second time)
+enum StaticAct : uint8_t {
+    STATIC_ACT_NONE = 0,
+    STATIC_ACT_RELU,
+    STATIC_ACT_SIGMOID,
+    STATIC_ACT_SOFTMAX,
+};
+
+// One dense layer with compile-time dimensions.
+// Weights are [IN x OUT] row-major - the same layout the .aif32 blob
+// and AIfES use - so the inner loop streams them sequentially.
+template <uint16_t IN, uint16_t OUT, StaticAct ACT = STATIC_ACT_NONE>
+struct StaticDense {
+    static constexpr uint16_t in_dim = IN;
+    static constexpr uint16_t out_dim = OUT;
+
+    const float* weights; // IN * OUT floats, typically XIP flash
+    const float* bias;    // OUT floats
+
+    void forward(const float* __restrict in, float* __restrict out) const {
+        for (uint16_t j = 0; j < OUT; j++) out[j] = bias[j];
+        for (uint16_t i = 0; i < IN; i++) {
+            const float a = in[i];
+            const float* __restrict w = &weights[(uint32_t)i * OUT];
+            for (uint16_t j = 0; j < OUT; j++) out[j] += a * w[j];
+        }
+
+        // Fused activation - OUT is a constant, so these unroll too
+        if (ACT == STATIC_ACT_RELU) {
+            for (uint16_t j = 0; j < OUT; j++) {
+                if (out[j] < 0.0f) out[j] = 0.0f;
+            }
+        } else if (ACT == STATIC_ACT_SIGMOID) {
+            for (uint16_t j = 0; j < OUT; j++) {
+                out[j] = 1.0f / (1.0f + expf(-out[j]));
+            }
+        } else if (ACT == STATIC_ACT_SOFTMAX) {
+            float max_v = out[0];
+            for (uint16_t j = 1; j < OUT; j++) {
+                if (out[j] > max_v) max_v = out[j];
+            }
+            float sum = 0.0f;
+            for (uint16_t j = 0; j < OUT; j++) {
+                out[j] = expf(out[j] - max_v);
+                sum += out[j];
+            }
+            const float inv = 1.0f / sum;
+            for (uint16_t j = 0; j < OUT; j++) out[j] *= inv;
+        }
+    }
+};
+
+// A chain of layers. forward() threads fixed-size buffers through the
+// chain - every size is known here, so there is nothing to schedule.
+template <typename... Layers>
+struct StaticModel;
+
+template <typename Last>
+struct StaticModel<Last> {
+    Last layer;
+
+    static constexpr uint16_t in_dim = Last::in_dim;
+    static constexpr uint16_t out_dim = Last::out_dim;
+
+    void forward(const float* __restrict in, float* __restrict out) const {
+        layer.forward(in, out);
+    }
+};
+
+template <typename First, typename... Rest>
+struct StaticModel<First, Rest...> {
+    First layer;
+    StaticModel<Rest...> rest;
+
+    static constexpr uint16_t in_dim = First::in_dim;
+    static constexpr uint16_t out_dim = StaticModel<Rest...>::out_dim;
+    static_assert(First::out_dim == StaticModel<Rest...>::in_dim,
+                  "StaticModel: adjacent layer dimensions must match");
+
+    void forward(const float* __restrict in, float* __restrict out) const {
+        float buf[First::out_dim]; // Compile-time size, lives on the stack
+        layer.forward(in, buf);
+        rest.forward(buf, out);
+    }
+};
+
+#endif // SPRITE_STATIC_H
@@ -0,0 +1,130 @@
+/*
+ * sprite_stats.h
+ * Lightweight performance counters for Sprite One
+ * Commands are stamped at enqueue and completion (RP2040 64-bit timer),
+ * bucketed into per-command-class latency histograms, and read out over
+ * CMD_STATS (0x0C). Answers "what is starving the queue" in the field:
+ * flushes, inference, or filesystem work.
+ */
+
+#ifndef SPRITE_STATS_H
+#define SPRITE_STATS_H
+
+#include <Arduino.h>
+
+#ifdef ARDUINO_ARCH_RP2040
+#include "pico/time.h"
+#endif
+
+// Command classes tracked separately
+enum SpriteStatClass : uint8_t {
+  STAT_CLASS_GFX = 0,   // 0x10-0x2F drawing + flush
+  STAT_CLASS_SPRITE,    // 0x30-0x3F sprite engine
+  STAT_CLASS_AI,        // 0x50-0x5F inference / training
+  STAT_CLASS_MODEL,     // 0x60-0x6F model management / filesystem
+  STAT_CLASS_SYSTEM,    // everything else
+  STAT_CLASS_COUNT
+};
+
+// Histogram bucket upper edges in microseconds (last bucket is open)
+#define STAT_BUCKETS 8
+
+struct SpriteClassStats {
+  uint32_t count;
+  uint64_t total_us;
+  uint32_t max_us;
+  uint16_t buckets[STAT_BUCKETS];  // Saturating
+};
+
+// Counters are written by whichever core completes the command and read
+// by Core 0 in CMD_STATS without a lock - they are advisory telemetry,
+// and a torn read costs one odd sample, not correctness.
+class SpriteStats {
+private:
+  static uint32_t bucketEdge(uint8_t i) {
+    static const uint32_t edges[STAT_BUCKETS - 1] =
+        { 50, 200, 1000, 5000, 20000, 100000, 500000 };
+    return edges[i];
+  }
+
+public:
+  SpriteClassStats cls[STAT_CLASS_COUNT];
+  uint16_t queue_highwater;  // Worst command-queue depth observed
+  uint32_t queue_rejects;    // Pushes refused because the queue was full
+
+  SpriteStats() { reset(); }
+
+  static uint64_t now_us() {
+    #ifdef ARDUINO_ARCH_RP2040
+    return time_us_64();
+    #else
+    return micros();
+    #endif
+  }
+
+  static uint8_t classify(uint8_t cmd) {
+    if (cmd >= 0x10 && cmd <= 0x2F) return STAT_CLASS_GFX;
+    if (cmd >= 0x30 && cmd <= 0x3F) return STAT_CLASS_SPRITE;
+    if (cmd >= 0x50 && cmd <= 0x5F) return STAT_CLASS_AI;
+    if (cmd >= 0x60 && cmd <= 0x6F) return STAT_CLASS_MODEL;
+    return STAT_CLASS_SYSTEM;
+  }
+
+  // Record one completed command: enqueue timestamp -> completion
+  void record(uint8_t cmd, uint64_t enq_us, uint64_t done_us) {
+    SpriteClassStats* c = &cls[classify(cmd)];
+    uint64_t dt64 = done_us - enq_us;
+    uint32_t dt = dt64 > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)dt64;
+
+    c->count++;
+    c->total_us += dt;
+    if (dt > c->max_us) c->max_us = dt;
+
+    uint8_t b = STAT_BUCKETS - 1;
+    for (uint8_t i = 0; i < STAT_BUCKETS - 1; i++) {
+      if (dt < bucketEdge(i)) { b = i; break; }
+    }
+    if (c->buckets[b] < 0xFFFF) c->buckets[b]++;
+  }
+
+  void noteDepth(uint16_t depth) {
+    if (depth > queue_highwater) queue_highwater = depth;
+  }
+
+  void noteReject() {
+    queue_rejects++;
+  }
+
+  void reset() {
+    memset(cls, 0, sizeof(cls));
+    queue_highwater = 0;
+    queue_rejects = 0;
+  }
+
+  // CMD_STATS wire format:
+  //   [version u8][queue_highwater u16][queue_rejects u32]
+  //   then per class: [count u32][avg_us u32][max_us u32][buckets u16 x8]
+  uint8_t serialize(uint8_t* out, uint8_t max_len) {
+    uint8_t need = 7 + STAT_CLASS_COUNT * (12 + STAT_BUCKETS * 2);
+    if (max_len < need) return 0;
+
+    uint8_t* p = out;
+    *p++ = 1;  // Format version
+    memcpy(p, &queue_highwater, 2); p += 2;
+    memcpy(p, &queue_rejects, 4);   p += 4;
+
+    for (uint8_t i = 0; i < STAT_CLASS_COUNT; i++) {
+      SpriteClassStats* c = &cls[i];
+      uint32_t avg = c->count ? (uint32_t)(c->total_us / c->count) : 0;
+      memcpy(p, &c->count, 4);  p += 4;
+      memcpy(p, &avg, 4);       p += 4;
+      memcpy(p, &c->max_us, 4); p += 4;
+      memcpy(p, c->buckets, STAT_BUCKETS * 2); p += STAT_BUCKETS * 2;
+    }
+    return (uint8_t)(p - out);
+  }
+};
+
+static SpriteStats sprite_stats;
+
+#endif // SPRITE_STATS_H
@@ -8,6 +8,12 @@
 
 #include <Arduino.h>
 
+#ifdef ARDUINO_ARCH_RP2040
+#include "hardware/dma.h"
+#include "hardware/uart.h"
+#include "hardware/irq.h"
+#endif
+
 // Abstract transport interface
 class SpriteTransport {
 public:
@@ -18,23 +24,143 @@ public:
   virtual void flush() = 0;
   virtual const char* name() = 0;
   virtual bool isConnected() = 0;
+
+  // Bulk drain into dst; default loops read(), DMA-backed transports
+  // override with a straight copy out of their ring
+  virtual int readBytes(uint8_t* dst, int maxlen) {
+    int n = 0;
+    while (n < maxlen && available() > 0) dst[n++] = read();
+    return n;
+  }
+
+  // Reconfigure the wire speed; no-op for transports with no baud (USB)
+  virtual void setBaud(uint32_t baud) { (void)baud; }
+};
+
+#ifdef ARDUINO_ARCH_RP2040
+// DMA-fed circular RX buffer for the hardware UART.
+// A DMA channel paced by the UART RX DREQ writes incoming bytes into a
+// power-of-two ring (address wrap done in hardware), so reception costs
+// zero CPU even while loop() is stuck inside a long command handler.
+// If the parser falls a full ring behind, the oldest bytes are silently
+// overwritten - the framing layer resyncs on the next 0xAA header.
+class UartDmaRx {
+private:
+  static const uint32_t RING_BITS = 10;  // 1KB ring
+  static const uint32_t RING_SIZE = 1u << RING_BITS;
+  uint8_t ring[RING_SIZE] __attribute__((aligned(1u << RING_BITS)));
+  int chan;
+  uint32_t rd;
+
+  uint32_t writeIndex() {
+    return (uint32_t)(dma_hw->ch[chan].write_addr - (uintptr_t)ring) & (RING_SIZE - 1);
+  }
+
+public:
+  UartDmaRx() : chan(-1), rd(0) {}
+
+  bool begin(uart_inst_t* u) {
+    chan = dma_claim_unused_channel(false);
+    if (chan < 0) return false;
+
+    dma_channel_config c = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, RING_BITS);  // wrap the write address
+    channel_config_set_dreq(&c, uart_get_dreq(u, false));
+
+    // The Arduino core's RX interrupt would race the DMA for bytes
+    irq_set_enabled(u == uart0 ? UART0_IRQ : UART1_IRQ, false);
+    uart_set_fifo_enabled(u, true);
+
+    rd = 0;
+    // 4G-byte transfer count = effectively endless; re-armed if it ever runs out
+    dma_channel_configure(chan, &c, ring, &uart_get_hw(u)->dr, 0xFFFFFFFF, true);
+    return true;
+  }
+
+  bool active() const { return chan >= 0; }
+
+  int available() {
+    if (chan < 0) return 0;
+    if (!dma_channel_is_busy(chan)) {
+      dma_channel_set_trans_count(chan, 0xFFFFFFFF, true);
+    }
+    return (int)((writeIndex() - rd) & (RING_SIZE - 1));
+  }
+
+  uint8_t read() {
+    uint8_t b = ring[rd];
+    rd = (rd + 1) & (RING_SIZE - 1);
+    return b;
+  }
+
+  int readBytes(uint8_t* dst, int maxlen) {
+    int n = available();
+    if (n > maxlen) n = maxlen;
+    for (int i = 0; i < n; i++) dst[i] = read();
+    return n;
+  }
 };
+#endif // ARDUINO_ARCH_RP2040
 
 // UART Transport (Serial1, hardware UART)
 class UARTTransport : public SpriteTransport {
 private:
   HardwareSerial& serial;
+  #ifdef ARDUINO_ARCH_RP2040
+  UartDmaRx dma_rx;
+  bool dma_active;
+  #endif
   
 public:
-  UARTTransport(HardwareSerial& s) : serial(s) {}
+  UARTTransport(HardwareSerial& s) : serial(s) {
+    #ifdef ARDUINO_ARCH_RP2040
+    dma_active = false;
+    #endif
+  }
+  
+  // Hand RX over to the DMA ring (call after serial.begin())
+  void enableDmaRx() {
+    #ifdef ARDUINO_ARCH_RP2040
+    dma_active = dma_rx.begin(uart0);  // Serial1 is UART0 on this board
+    #endif
+  }
   
-  int available() override { return serial.available(); }
-  uint8_t read() override { return serial.read(); }
+  int available() override {
+    #ifdef ARDUINO_ARCH_RP2040
+    if (dma_active) return dma_rx.available();
+    #endif
+    return serial.available();
+  }
+  uint8_t read() override {
+    #ifdef ARDUINO_ARCH_RP2040
+    if (dma_active) return dma_rx.read();
+    #endif
+    return serial.read();
+  }
+  int readBytes(uint8_t* dst, int maxlen) override {
+    #ifdef ARDUINO_ARCH_RP2040
+    if (dma_active) return dma_rx.readBytes(dst, maxlen);
+    #endif
+    return SpriteTransport::readBytes(dst, maxlen);
+  }
   size_t write(uint8_t b) override { return serial.write(b); }
   size_t write(const uint8_t* buffer, size_t size) override { 
     return serial.write(buffer, size); 
   }
   void flush() override { serial.flush(); }
+  void setBaud(uint32_t baud) override {
+    serial.flush();
+    #ifdef ARDUINO_ARCH_RP2040
+    // Re-program the divisor live - keeps the DMA ring and FIFO intact
+    uart_set_baudrate(uart0, baud);
+    #else
+    serial.end();
+    serial.begin(baud);
+    #endif
+  }
   const char* name() override { return "UART"; }
   bool isConnected() override { return true; } // UART always connected
 };
@@ -64,15 +190,32 @@ private:
   UARTTransport uart;
   USBTransport usb;
   SpriteTransport* active;
+  uint32_t current_baud;
   
 public:
   TransportManager() 
-    : uart(Serial1), usb(), active(nullptr) {}
+    : uart(Serial1), usb(), active(nullptr), current_baud(115200) {}
   
   void begin(uint32_t baudrate = 115200) {
+    current_baud = baudrate;
     Serial.begin(baudrate);   // USB-CDC (baud ignored on USB)
     Serial1.begin(baudrate);  // UART
     delay(100); // Stabilization
+    uart.enableDmaRx();       // DMA-fed RX ring on the hardware UART
+  }
+  
+  // CMD_SET_BAUD negotiation target
+  void setBaud(uint32_t baudrate) {
+    current_baud = baudrate;
+    uart.setBaud(baudrate);
+  }
+  
+  uint32_t getBaud() const { return current_baud; }
+  
+  // Re-program the UART divisor after a system reclock (clk_peri moves
+  // with the system clock, which silently detunes the baud)
+  void reapplyBaud() {
+    uart.setBaud(current_baud);
   }
   
   // Auto-detect which interface has data
@@ -85,8 +228,9 @@ public:
       return active;
     }
     
-    // Check UART second
-    if (Serial1.available()) {
+    // Check UART second (through the transport - with the DMA ring
+    // active, bytes bypass Serial1's own buffer entirely)
+    if (uart.available()) {
       active = &uart;
       return active;
     }
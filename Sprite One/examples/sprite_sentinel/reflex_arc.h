@@ -2,16 +2,27 @@
  * reflex_arc.h
  * PIO Program for "Spinal Cord" Reflexes
  * Monitors a pin for rapid changes and triggers IRQ without CPU intervention.
+ *
+ * The IRQ handler timestamps the edge, pushes it into a dedicated
+ * high-priority event lane (a tiny lock-free ring that bypasses every
+ * command queue), and can fire a pre-registered action - a GPIO
+ * actuation or a pre-composed frame flush - directly from interrupt
+ * context. Motion-to-reaction is microseconds; the polling loops only
+ * ever see events that have already been acted on.
  */
 
 #ifndef REFLEX_ARC_H
 #define REFLEX_ARC_H
 
+#include <Arduino.h>
+
 #ifdef ARDUINO_ARCH_RP2040
 #include "hardware/pio.h"
+#include "hardware/irq.h"
+#include "pico/time.h"
 #endif
 
-// Mock PIO program data
+// PIO program: wait for a rising edge, raise PIO IRQ flag 0, wrap
 static const uint16_t reflex_program_instructions[] = {
     // .wrap_target
     0xe000, //  0: set    pins, 0
@@ -21,28 +32,104 @@ static const uint16_t reflex_program_instructions[] = {
     // .wrap
 };
 
+#ifdef ARDUINO_ARCH_RP2040
 static const struct pio_program reflex_program = {
     .instructions = reflex_program_instructions,
     .length = 4,
     .origin = -1,
 };
+#endif
+
+// Runs inside the IRQ handler - keep it to register pokes (GPIO, a DMA
+// trigger); no Serial, no malloc, no filesystem.
+typedef void (*reflex_action_fn)(void);
+
+// One timestamped edge
+struct ReflexEvent {
+    uint64_t t_us;   // 64-bit timer at handler entry
+    uint32_t seq;    // Monotonic event number (detects overruns)
+};
 
 class ReflexArc {
+private:
+    #define REFLEX_LANE_SIZE 8  // Power of two
+    static ReflexEvent lane[REFLEX_LANE_SIZE];
+    static volatile uint8_t lane_head;  // IRQ writes
+    static volatile uint8_t lane_tail;  // Reader owns
+    static volatile uint32_t event_seq;
+    static reflex_action_fn action;
+    #ifdef ARDUINO_ARCH_RP2040
+    static PIO pio_;
+
+    static void irqHandler() {
+        pio_interrupt_clear(pio_, 0);  // Re-arm the state machine flag
+
+        // 1. Act first: the pre-registered reflex runs before anything
+        //    else so the actuation cost is just the IRQ entry latency
+        if (action) action();
+
+        // 2. Then record: timestamp into the high-priority lane. On
+        //    overflow the oldest event is dropped - seq exposes the gap.
+        uint8_t h = lane_head;
+        uint8_t next = (h + 1) & (REFLEX_LANE_SIZE - 1);
+        if (next == lane_tail) lane_tail = (lane_tail + 1) & (REFLEX_LANE_SIZE - 1);
+        lane[h].t_us = time_us_64();
+        lane[h].seq = ++event_seq;
+        lane_head = next;
+    }
+    #endif
+
 public:
-    static void init(uint8_t pin) {
+    // Program the PIO watchdog on `pin` and wire its IRQ straight to
+    // the handler at highest priority. `act` (optional) runs in IRQ
+    // context on every edge.
+    static void init(uint8_t pin, reflex_action_fn act = nullptr) {
+        action = act;
         #ifdef ARDUINO_ARCH_RP2040
         PIO pio = pio0;
+        pio_ = pio;
         uint offset = pio_add_program(pio, &reflex_program);
         uint sm = pio_claim_unused_sm(pio, true);
-        
+
         pio_sm_config c = pio_get_default_sm_config();
         sm_config_set_in_pins(&c, pin);
         sm_config_set_jmp_pin(&c, pin);
-        
+        pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, false);
+        gpio_pull_down(pin);
+
         pio_sm_init(pio, sm, offset, &c);
+
+        // PIO IRQ flag 0 -> PIO0_IRQ_0 -> irqHandler, highest priority
+        pio_set_irq0_source_enabled(pio, pis_interrupt0, true);
+        irq_set_exclusive_handler(PIO0_IRQ_0, irqHandler);
+        irq_set_priority(PIO0_IRQ_0, 0);
+        irq_set_enabled(PIO0_IRQ_0, true);
+
         pio_sm_set_enabled(pio, sm, true);
+        #else
+        (void)pin;
         #endif
     }
+
+    // Drain one event from the lane (called from any loop; never blocks)
+    static bool pop(ReflexEvent* out) {
+        uint8_t t = lane_tail;
+        if (t == lane_head) return false;
+        *out = lane[t];
+        lane_tail = (t + 1) & (REFLEX_LANE_SIZE - 1);
+        return true;
+    }
+
+    static uint32_t eventCount() { return event_seq; }
 };
 
+ReflexEvent ReflexArc::lane[REFLEX_LANE_SIZE];
+volatile uint8_t ReflexArc::lane_head = 0;
+volatile uint8_t ReflexArc::lane_tail = 0;
+volatile uint32_t ReflexArc::event_seq = 0;
+reflex_action_fn ReflexArc::action = nullptr;
+#ifdef ARDUINO_ARCH_RP2040
+PIO ReflexArc::pio_ = nullptr;
+#endif
+
 #endif // REFLEX_ARC_H
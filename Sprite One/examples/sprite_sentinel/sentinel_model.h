@@ -8,12 +8,32 @@
 #define SENTINEL_MODEL_H
 
 #include <stdint.h>
+#include <LittleFS.h>
+#include "sio_acceleration.h"
 
 // Vector Brain Configuration
 #define VECTOR_DIM 128
-#define MAX_VECTORS 16
+#define MAX_VECTORS 100
 #define VECTOR_STORE_MAGIC 0xBEEFCAFE
 
+// Q7 quantization: embeddings are unit-normalized at add time, then
+// scaled to int8. Two unit vectors scaled by 127 dot to ~127*127, so
+// cosine similarity is just the integer dot over this constant - no
+// float math and no sqrt anywhere on the search path.
+#define VECTOR_Q_SCALE   127
+#define VECTOR_Q_DOT_MAX (VECTOR_Q_SCALE * VECTOR_Q_SCALE) // dot of identical vectors
+#define VECTOR_BLOCK     32                                 // early-exit granularity
+#define VECTOR_BLOCKS    (VECTOR_DIM / VECTOR_BLOCK)
+
+// Persistence: append-style journal in LittleFS. Every add/evict
+// appends one 150-byte record instead of rewriting the whole store;
+// boot replays the journal in order so the last write to a slot wins.
+// When the journal grows past the compaction bound it is rewritten as
+// a snapshot (one record per live entry).
+#define VECTOR_JOURNAL_PATH     "/vectors.jnl"
+#define VECTOR_STORE_VERSION    1
+#define VECTOR_COMPACT_RECORDS  (MAX_VECTORS * 4)
+
 // Tensor Types
 typedef struct {
     uint16_t dims[2]; // [Rows, Cols]
@@ -43,74 +63,230 @@ public:
 };
 
 // The "Vector Store" - A simple associative memory
-// Stores "Fingerprints" of known objects
+// Stores "Fingerprints" of known objects.
+// Embeddings live as pre-normalized Q7: 128 bytes instead of 512,
+// which is what lets MAX_VECTORS sit at 100 in the same SRAM budget.
 struct VectorEntry {
     uint8_t id;
     uint8_t confidence; // 0-100
     char    label[16];  // "Cat", "Mailman", etc.
-    float   embedding[VECTOR_DIM]; // 128-float vector
+    int8_t  embedding[VECTOR_DIM] __attribute__((aligned(4))); // Q7, unit-normalized
     uint32_t last_seen;
 };
 
+// One journal record - the on-flash image of a slot write
+struct __attribute__((packed)) VectorRecord {
+    uint8_t  slot;
+    uint8_t  confidence;
+    uint32_t last_seen;
+    char     label[16];
+    int8_t   embedding[VECTOR_DIM];
+};
+
 // Global Vector Memory (SRAM)
 struct VectorSystem {
     uint32_t magic;
     uint8_t count;
+    uint16_t journal_records; // Records on flash since last compaction
     VectorEntry entries[MAX_VECTORS];
-    
+
+    // Mount the filesystem and replay the journal. Call once from setup().
+    // Returns the number of vectors recovered from flash.
+    uint8_t begin() {
+        magic = VECTOR_STORE_MAGIC;
+        count = 0;
+        journal_records = 0;
+        if (!LittleFS.begin()) return 0;
+
+        File f = LittleFS.open(VECTOR_JOURNAL_PATH, "r");
+        if (!f) return 0;
+
+        uint32_t file_magic = 0;
+        uint8_t version = 0;
+        f.read((uint8_t*)&file_magic, 4);
+        f.read(&version, 1);
+        if (file_magic != VECTOR_STORE_MAGIC || version != VECTOR_STORE_VERSION) {
+            f.close();
+            return 0; // Stale/foreign journal - start empty, next add rewrites it
+        }
+
+        VectorRecord rec;
+        while (f.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec)) {
+            if (rec.slot >= MAX_VECTORS) continue;
+            apply_record(rec);
+            journal_records++;
+        }
+        f.close();
+        return count;
+    }
+
+    // Normalize a float embedding and quantize it to Q7.
+    // The one sqrt per vector happens HERE, not per comparison.
+    void quantize(const float* input_vec, int8_t* out) {
+        float mag = magnitude(input_vec);
+        if (mag == 0) mag = 1.0f;
+        for (int i = 0; i < VECTOR_DIM; i++) {
+            float q = (input_vec[i] / mag) * VECTOR_Q_SCALE;
+            if (q > 127.0f) q = 127.0f;
+            if (q < -127.0f) q = -127.0f;
+            out[i] = (int8_t)roundf(q);
+        }
+    }
+
     // Find closest match to an input vector
     // Returns index of match, or -1 if unknown
     int find_match(const float* input_vec, float threshold = 0.8f) {
+        // Quantize the query once (one sqrt per search, zero per candidate)
+        static int8_t query[VECTOR_DIM] __attribute__((aligned(4)));
+        quantize(input_vec, query);
+
+        // Per-query suffix bounds for early exit: the dot product over
+        // elements [b*32, end) can never exceed 127 * sum(|q_i|) there
+        // (Hoelder - every stored byte is at most +/-127). Candidates
+        // whose partial sum plus this bound can't reach the bar are
+        // abandoned mid-vector.
+        int32_t suffix_bound[VECTOR_BLOCKS + 1];
+        suffix_bound[VECTOR_BLOCKS] = 0;
+        for (int b = VECTOR_BLOCKS - 1; b >= 0; b--) {
+            int32_t abs_sum = 0;
+            for (int i = b * VECTOR_BLOCK; i < (b + 1) * VECTOR_BLOCK; i++) {
+                abs_sum += query[i] < 0 ? -query[i] : query[i];
+            }
+            suffix_bound[b] = suffix_bound[b + 1] + abs_sum * VECTOR_Q_SCALE;
+        }
+
+        int32_t threshold_dot = (int32_t)(threshold * VECTOR_Q_DOT_MAX);
+        int32_t best_dot = threshold_dot; // Bar starts at the threshold itself
         int best_idx = -1;
-        float best_score = -1.0f;
-        
-        for(int i=0; i<count; i++) {
-            float score = cosine_similarity(input_vec, entries[i].embedding);
-            if (score > best_score) {
-                best_score = score;
+
+        for (int i = 0; i < count; i++) {
+            const int8_t* e = entries[i].embedding;
+            int32_t acc = 0;
+            for (int b = 0; b < VECTOR_BLOCKS; b++) {
+                acc += SIOAccel::q7_mac_block(&query[b * VECTOR_BLOCK],
+                                              &e[b * VECTOR_BLOCK], VECTOR_BLOCK);
+                if (acc + suffix_bound[b + 1] < best_dot) { acc = INT32_MIN; break; }
+            }
+            if (acc >= best_dot) {
+                best_dot = acc;
                 best_idx = i;
             }
         }
-        
-        if (best_score >= threshold) return best_idx;
-        return -1;
+
+        // Recency bookkeeping for the evictor. RAM-only on purpose -
+        // journaling every sighting would wear flash for nothing; the
+        // timestamp is persisted the next time the slot is written.
+        if (best_idx >= 0) entries[best_idx].last_seen = millis();
+
+        return best_idx;
     }
-    
+
     void add_vector(const float* input_vec, const char* label) {
-        if (count >= MAX_VECTORS) {
-            // "Forgetting" logic: Overwrite oldest or least seen
-            // Simple FIFO for now
-            count = 0; 
+        uint8_t slot;
+        if (count < MAX_VECTORS) {
+            slot = count++;
+        } else {
+            slot = evict_slot(); // Forget the least valuable memory
         }
-        
-        VectorEntry* e = &entries[count];
-        e->id = count;
+
+        VectorEntry* e = &entries[slot];
+        e->id = slot;
         e->confidence = 100;
-        e->last_seen = 0; // millis()
+        e->last_seen = millis();
+        memset(e->label, 0, sizeof(e->label));
         strncpy(e->label, label, 15);
-        memcpy(e->embedding, input_vec, sizeof(float) * VECTOR_DIM);
-        
-        count++;
+        quantize(input_vec, e->embedding);
+
+        journal_write(slot);
     }
-    
-    // SIO-Accelerated Dot Product would go here
+
+    // Eviction policy: least confidence first, oldest sighting breaks
+    // ties - a shaky memory nobody has matched in a while goes before
+    // a confident one that fired yesterday.
+    uint8_t evict_slot() {
+        uint8_t victim = 0;
+        for (uint8_t i = 1; i < count; i++) {
+            if (entries[i].confidence < entries[victim].confidence ||
+                (entries[i].confidence == entries[victim].confidence &&
+                 entries[i].last_seen < entries[victim].last_seen)) {
+                victim = i;
+            }
+        }
+        return victim;
+    }
+
+    // ===== Persistence internals =====
+
+    void apply_record(const VectorRecord& rec) {
+        VectorEntry* e = &entries[rec.slot];
+        e->id = rec.slot;
+        e->confidence = rec.confidence;
+        e->last_seen = rec.last_seen;
+        memcpy(e->label, rec.label, sizeof(e->label));
+        memcpy(e->embedding, rec.embedding, VECTOR_DIM);
+        if (rec.slot >= count) count = rec.slot + 1;
+    }
+
+    // Append one slot's current state to the journal. O(record), not
+    // O(store) - a full rewrite only happens at the compaction bound.
+    void journal_write(uint8_t slot) {
+        if (journal_records >= VECTOR_COMPACT_RECORDS) {
+            compact();
+            return; // compact() already wrote every live slot
+        }
+
+        bool fresh = !LittleFS.exists(VECTOR_JOURNAL_PATH);
+        File f = LittleFS.open(VECTOR_JOURNAL_PATH, fresh ? "w" : "a");
+        if (!f) return; // FS unavailable - store keeps working from RAM
+
+        if (fresh) {
+            uint32_t m = VECTOR_STORE_MAGIC;
+            uint8_t v = VECTOR_STORE_VERSION;
+            f.write((uint8_t*)&m, 4);
+            f.write(&v, 1);
+        }
+        VectorRecord rec;
+        fill_record(slot, rec);
+        f.write((uint8_t*)&rec, sizeof(rec));
+        f.close();
+        journal_records++;
+    }
+
+    // Rewrite the journal as a snapshot: one record per live entry
+    void compact() {
+        File f = LittleFS.open(VECTOR_JOURNAL_PATH, "w");
+        if (!f) return;
+        uint32_t m = VECTOR_STORE_MAGIC;
+        uint8_t v = VECTOR_STORE_VERSION;
+        f.write((uint8_t*)&m, 4);
+        f.write(&v, 1);
+        VectorRecord rec;
+        for (uint8_t i = 0; i < count; i++) {
+            fill_record(i, rec);
+            f.write((uint8_t*)&rec, sizeof(rec));
+        }
+        f.close();
+        journal_records = count;
+    }
+
+    void fill_record(uint8_t slot, VectorRecord& rec) {
+        const VectorEntry* e = &entries[slot];
+        rec.slot = slot;
+        rec.confidence = e->confidence;
+        rec.last_seen = e->last_seen;
+        memcpy(rec.label, e->label, sizeof(rec.label));
+        memcpy(rec.embedding, e->embedding, VECTOR_DIM);
+    }
+
     float dot_product(const float* a, const float* b) {
         float sum = 0;
         for(int i=0; i<VECTOR_DIM; i++) sum += a[i] * b[i];
         return sum;
     }
-    
+
     float magnitude(const float* a) {
         return sqrt(dot_product(a, a));
     }
-    
-    float cosine_similarity(const float* a, const float* b) {
-        float dot = dot_product(a, b);
-        float mag_a = magnitude(a);
-        float mag_b = magnitude(b);
-        if (mag_a == 0 || mag_b == 0) return 0;
-        return dot / (mag_a * mag_b);
-    }
 };
 
 #endif // SENTINEL_MODEL_H
@@ -0,0 +1,2187 @@
+/*
+ * Generated by tools/gen_static_model.py from sentinel_god.aif32
+ * Model: SentinelGod - do not edit, regenerate instead.
+ */
+
+#ifndef SENTINEL_GOD_STATIC_MODEL_H
+#define SENTINEL_GOD_STATIC_MODEL_H
+
+#include "../sprite_one_unified/sprite_static.h"
+
+namespace sentinel_god {
+
+// Dense 0: 128 -> 128 (STATIC_ACT_RELU)
+static const float weights_0[16384] = {
+    0.343561888f, -0.332527995f, -0.449299186f, 0.0226049908f, 0.0923619941f, 0.401200771f, 0.784722805f, 0.188539162f,
+    -0.458536983f, 0.45621863f, 0.00959470682f, 0.214404017f, 0.726158738f, -0.447253138f, 0.710901082f, -0.718852758f,
+    -0.710547686f, 0.988479018f, -0.119411908f, 0.869175315f, 0.592391133f, -0.523344576f, 0.560409844f, 0.21861662f,
+    0.2659491f, -0.849687874f, -0.450441867f, 0.686658859f, -0.926982164f, -0.342143834f, 0.362554193f, -0.373785317f,
+    0.306038857f, 0.543513954f, 0.65113163f, -0.87277931f, 0.064013809f, -0.982427537f, 0.102993183f, -0.876302481f,
+    0.0858651996f, -0.94293046f, -0.0246853083f, -0.149020031f, -0.102177642f, 0.978322089f, 0.953342855f, -0.748007596f,
+    0.787555575f, -0.681689024f, -0.376255065f, 0.150057331f, 0.557787299f, 0.270330757f, 0.650776803f, 0.358222812f,
+    0.811442494f, 0.134752348f, -0.346820831f, -0.616319656f, 0.234032959f, -0.170730919f, 0.740088761f, -0.329645306f,
+    -0.723761559f, 0.971861243f, -0.599936247f, -0.168346033f, 0.401258588f, -0.984870553f, 0.0490337051f, -0.38447237f,
+    0.755916536f, 0.569504499f, -0.906827331f, 0.570953727f, 0.285823166f, -0.993672669f, -0.905471563f, 0.0167630594f,
+    0.72273165f, 0.940366745f, -0.296531856f, -0.200371236f, -0.168085471f, -0.105843186f, -0.295652866f, -0.23905997f,
+    0.816133022f, 0.723872721f, -0.716205001f, -0.743522465f, -0.963562191f, 0.782228649f, 0.00934096426f, 0.193345293f,
+    -0.0951624736f, 0.147823155f, 0.355763972f, 0.0548406132f, -0.273886889f, 0.819864511f, 0.887263715f, -0.967257857f,
+    0.0477749445f, -0.716536999f, -0.666739047f, -0.16250506f, -0.201202542f, -0.289205432f, -0.984206736f, -0.362301052f,
+    0.987509191f, 0.274416298f, 0.195197836f, -0.02169751f, 0.278010875f, -0.694769204f, -0.473055512f, 0.0341748707f,
+    0.0900653973f, 0.163925022f, -0.594837666f, -0.913017929f, -0.434778541f, -0.045293346f, 0.471526206f, 0.25996685f,
+    -0.00639072619f, 0.317289382f, -0.380856812f, 0.967017651f, -0.16691272f, 0.679435015f, 0.6658144f, 0.588810265f,
+    0.288004428f, -0.897657275f, 0.855589688f, -0.703056753f, -0.486786127f, -0.868588269f, 0.419493496f, -0.829643011f,
+    0.595999599f, 0.61942929f, -0.994576097f, -0.548392117f, 0.213257506f, -0.463666528f, -0.0691907927f, 0.517226636f,
+    -0.585241854f, 0.554538071f, 0.564890206f, 0.199209154f, 0.698572457f, 0.74209702f, 0.528273523f, 0.282897532f,
+    0.14894107f, 0.835876763f, -0.52741009f, -0.461896867f, 0.131315559f, 0.98220408f, 0.12429437f, -0.660182953f,
+    -0.639071405f, 0.989486039f, 0.413042158f, 0.498841226f, -0.0721724108f, 0.90429312f, 0.906656086f, -0.963921487f,
+    -0.699102461f, -0.44160521f, -0.910134792f, 0.396631837f, -0.650293708f, 0.73304373f, 0.0963661522f, -0.382629037f,
+    0.0584736094f, 0.518353105f, -0.0918333828f, -0.490614742f, 0.0444314852f, -0.241482362f, -0.471485257f, 0.208046675f,
+    0.191490769f, -0.182269961f, 0.986691356f, 0.510073364f, -0.62303257f, 0.872684479f, -0.41862908f, 0.00343340938f,
+    -0.212024987f, 0.514814317f, -0.877322793f, -0.143407434f, -0.867865026f, 0.0634063259f, 0.528911829f, 0.401974201f,
+    -0.57537961f, 0.167620406f, 0.282848537f, 0.744752109f, -0.868033826f, 0.714373708f, 0.422964722f, -0.686871588f,
+    -0.442814171f, 0.622100174f, -0.625609517f, -0.486521691f, 0.0862508789f, 0.697517157f, -0.350328565f, 0.960027754f,
+    0.886511445f, -0.127232224f, 0.18588762f, 0.57788384f, 0.856966674f, -0.654506505f, 0.646471441f, -0.00249732402f,
+    0.227395639f, 0.65880698f, -0.536309123f, -0.135788456f, 0.957592607f, 0.58676213f, -0.511495054f, 0.408937812f,
+    0.547404766f, 0.839747727f, 0.310492665f, -0.496774018f, -0.826385379f, -0.0527914427f, -0.866098106f, -0.556057155f,
+    0.424370408f, -0.132046238f, -0.46124959f, -0.246711463f, -0.365823269f, -0.463110924f, 0.812503576f, 0.422208846f,
+    -0.271978706f, 0.564738274f, 0.0396024436f, -0.861800909f, -0.500672698f, 0.773374736f, -0.395936519f, -0.739583135f,
+    -0.556531549f, -0.472242415f, -0.00955867488f, 0.71655041f, -0.958399355f, -0.758421779f, -0.478506804f, -0.697970271f,
+    0.499537081f, -0.876698494f, -0.390589237f, 0.212127283f, -0.194496766f, 0.594372153f, 0.846657813f, 0.101256169f,
+    -0.164971441f, -0.843186915f, -0.390657097f, 0.268765748f, -0.679712236f, -0.458733141f, -0.27265054f, -0.646968663f,
+    -0.0718800053f, 0.48243767f, 0.0474976487f, -0.33607468f, -0.0660269782f, 0.0593690425f, -0.118354544f, 0.553335607f,
+    0.949088931f, 0.607931197f, -0.644182444f, 0.265955567f, 0.282230645f, 0.218273178f, 0.464153856f, -0.72408092f,
+    -0.79631424f, -0.164994702f, -0.1990484f, -0.959703863f, 0.0129357129f, 0.778278232f, 0.248994008f, -0.410292745f,
+    -0.192248493f, 0.909735024f, 0.795605779f, 0.696599782f, 0.916989565f, -0.163171604f, -0.272083312f, 0.187459007f,
+    0.0354809873f, 0.590627491f, 0.978073001f, 0.013526503f, 0.747206569f, 0.828932524f, -0.0150938099f, 0.30948016f,
+    0.627198339f, 0.640762269f, -0.0414677523f, -0.0160702579f, -0.818589807f, -0.710461855f, -0.641519904f, 0.647899747f,
+    0.700971127f, -0.103716195f, 0.00231570052f, -0.529829502f, 0.173927993f, 0.726995766f, -0.407126725f, -0.425799489f,
+    -0.91987884f, 0.234539822f, -0.991353333f, -0.271409452f, 0.143165141f, -0.12302804f, -0.626743615f, -0.155348837f,
+    0.42149359f, -0.194518283f, 0.485149026f, -0.539368868f, -0.440907091f, -0.149190545f, -0.0996614397f, -0.488119394f,
+    0.926217139f, 0.291143268f, -0.0940073952f, 0.898985267f, 0.244870067f, 0.503728867f, 0.2864196f, 0.660299242f,
+    -0.165935859f, -0.356756002f, 0.957640886f, 0.91551131f, 0.323854119f, -0.723240435f, 0.0879708827f, 0.414419711f,
+    -0.550068378f, 0.842783451f, -0.689576209f, -0.38832593f, 0.863282859f, 0.699584723f, -0.094722338f, -0.183541685f,
+    -0.343491584f, -0.356930584f, 0.493729502f, -0.905303955f, -0.734476745f, 0.972470224f, 0.249047399f, 0.469304115f,
+    -0.789480269f, 0.66025871f, -0.218595073f, 0.489273757f, 0.680042386f, 0.31693393f, -0.592517018f, 0.462848544f,
+    0.112351663f, 0.887531519f, -0.742720723f, -0.560198426f, -0.830974758f, 0.591280043f, -0.790688634f, -0.631872177f,
+    0.0428637303f, -0.0715812519f, -0.388493776f, 0.190806851f, 0.456782967f, -0.473336607f, 0.612357676f, -0.873524129f,
+    0.626467586f, 0.22498621f, 0.887955964f, 0.01777496f, -0.473938406f, -0.213564456f, -0.84201932f, -0.414640039f,
+    -0.790076256f, -0.254161865f, -0.218076795f, -0.111972548f, -0.260069996f, 0.399170578f, 0.366601586f, 0.531179428f,
+    -0.518547952f, -0.079822436f, 0.77577281f, 0.283352196f, -0.0105293728f, -0.735360622f, -0.830580533f, 0.734377861f,
+    -0.886636734f, -0.22540535f, -0.828021348f, 0.277969748f, 0.967451215f, 0.0376701728f, -0.323571771f, 0.218244419f,
+    -0.839907289f, 0.712311864f, -0.0175362192f, 0.63763392f, 0.38016814f, 0.659172118f, 0.392503321f, 0.85856843f,
+    0.993403971f, -0.182997525f, 0.34529838f, -0.234531328f, 0.0405423194f, -0.898515642f, -0.757288933f, -0.829406321f,
+    0.631628752f, -0.0854702815f, -0.279192716f, 0.143003628f, 0.738573492f, -0.798830152f, -0.146627665f, -0.966806471f,
+    -0.997235239f, 0.567442477f, -0.507477939f, 0.659979522f, -0.355898619f, -0.416092515f, -0.798149526f, 0.800907254f,
+    0.722033441f, -0.359616458f, 0.684930563f, -0.254234463f, -0.107343249f, -0.140721425f, 0.369666457f, -0.637099445f,
+    -0.0441492498f, -0.937319696f, 0.773260772f, -0.165497467f, 0.221232265f, -0.561015904f, -0.475063056f, -0.38869381f,
+    0.99685657f, 0.9566679f, -0.742152095f, 0.419148266f, -0.687161744f, -0.441796541f, -0.769163907f, -0.475651115f,
+    -0.951759815f, 0.0611048266f, 0.930824578f, -0.648086905f, -0.546262085f, -0.633437574f, -0.111844786f, -0.149370581f,
+    -0.197809607f, 0.408336461f, -0.971286237f, 0.911639869f, 0.500006139f, 0.904502451f, -0.776042759f, -0.0280378163f,
+    -0.664398432f, 0.77115792f, -0.108560637f, -0.404280573f, 0.997979641f, -0.856531024f, -0.285491496f, 0.273212582f,
+    -0.58014822f, 0.172021031f, -0.0621942952f, 0.926879466f, 0.829877734f, -0.0870822221f, -0.628905177f, -0.662639678f,
+    0.195735589f, -0.317136139f, 0.767008126f, 0.843706369f, -0.574241519f, 0.561504066f, 0.277537137f, 0.13109073f,
+    -0.376386344f, -0.921938062f, -0.608229637f, 0.994527221f, 0.78017503f, -0.95031476f, -0.650007904f, 0.663617194f,
+    0.219630182f, 0.575811803f, 0.81550914f, -0.20407699f, -0.493431628f, 0.770934045f, -0.0783391967f, -0.0794536248f,
+    0.279083818f, -0.859636307f, 0.499992698f, 0.403036565f, 0.472089112f, -0.774527133f, 0.455846995f, 0.0605499297f,
+    -0.664296091f, 0.435584694f, 0.656472087f, 0.524717569f, 0.373404592f, 0.644712925f, 0.983552217f, -0.237722367f,
+    -0.693519473f, -0.675590873f, 0.290359706f, 0.244789809f, 0.867318869f, -0.783241689f, -0.0590415485f, -0.0218710918f,
+    0.597527683f, 0.198873833f, -0.358621985f, 0.11842633f, 0.600953341f, -0.815915406f, -0.940286696f, -0.168146953f,
+    -0.303232372f, 0.388384759f, -0.180618227f, 0.865483403f, 0.384444326f, -0.872219622f, -0.926912427f, -0.537243068f,
+    -0.569998264f, -0.356703967f, -0.186985061f, -0.503963411f, -0.201981038f, 0.46217981f, -0.869085789f, 0.785955548f,
+    0.234084621f, -0.852129281f, 0.280526817f, -0.259756178f, 0.761754394f, -0.783111334f, -0.625766993f, -0.053001374f,
+    -0.30783549f, 0.639293849f, 0.92943418f, -0.526186168f, 0.47660166f, 0.903870702f, 0.602946281f, 0.963914394f,
+    -0.952747703f, -0.265674353f, 0.2620368f, -0.557220042f, 0.901688993f, 0.417818367f, -0.116264798f, 0.556863129f,
+    0.377038211f, -0.729721427f, 0.171203688f, 0.195692852f, 0.15978308f, -0.684253097f, 0.920353591f, 0.175575033f,
+    -0.251946837f, -0.236028984f, 0.617171049f, 0.441582471f, 0.739754975f, -0.00516414922f, 0.396683604f, -0.967329204f,
+    0.59763521f, 0.461361229f, -0.46787858f, -0.18920283f, 0.579066515f, 0.64748019f, -0.43083933f, 0.429241657f,
+    -0.750889421f, 0.439615071f, 0.21309866f, -0.712293386f, -0.886022449f, -0.383214772f, -0.742757201f, -0.477841407f,
+    -0.596054673f, -0.0979730636f, -0.92294997f, 0.170247376f, 0.319706976f, -0.334101677f, 0.74412787f, 0.623109639f,
+    -0.495741665f, 0.164954811f, -0.385571361f, -0.110714555f, 0.467468739f, 0.750557899f, 0.47533071f, 0.544587314f,
+    -0.625883043f, 0.511401236f, -0.486237824f, -0.0834566578f, -0.624196768f, 0.657378614f, 0.921448886f, -0.537171006f,
+    -0.375693023f, 0.754837573f, 0.682000399f, 0.679966092f, -0.638781726f, -0.91104722f, 0.567269325f, 0.788564742f,
+    0.289404929f, -0.388145f, 0.447656393f, -0.953905046f, 0.406210005f, -0.55634743f, 0.593159616f, 0.570564866f,
+    0.0909160301f, 0.863129795f, 0.570502579f, -0.43107149f, 0.824122965f, 0.846561134f, -0.425660282f, -0.263257384f,
+    0.91248703f, 0.0656177774f, -0.904120743f, 0.47846356f, 0.414331108f, 0.475676328f, -0.82205683f, -0.815917313f,
+    -0.799940526f, -0.527365923f, 0.654676437f, -0.982328773f, 0.460153937f, -0.138325542f, 0.189003199f, 0.939520836f,
+    -0.278479606f, 0.315006495f, 0.507184923f, -0.194692701f, 0.0951553732f, -0.534300745f, -0.752711475f, 0.0803619847f,
+    0.05417265f, -0.820884526f, -0.296206355f, -0.488423079f, 0.135358185f, 0.322118789f, -0.270308644f, -0.59252888f,
+    -0.86017406f, -0.794016242f, -0.569418907f, 0.551972747f, 0.793089092f, -0.574881375f, 0.445015073f, 0.705549777f,
+    0.290328741f, -0.390700608f, -0.914160907f, 0.127072722f, 0.852171421f, 0.497100145f, 0.279600978f, -0.405849963f,
+    0.723035991f, 0.258072257f, -0.564985514f, 0.585378826f, -0.343512416f, 0.468771219f, -0.217760533f, 0.764169395f,
+    -0.368501514f, 0.348433644f, 0.0940350592f, -0.11089167f, -0.977226138f, -0.716240406f, 0.549605489f, -0.938369572f,
+    -0.773170352f, -0.354521126f, 0.938728452f, 0.2456958f, 0.564216197f, -0.0124379378f, -0.0784481689f, 0.493635923f,
+    -0.386518061f, -0.567289114f, -0.188888073f, 0.773960173f, -0.851478517f, -0.532566369f, -0.218673304f, 0.632950902f,
+    -0.940589428f, -0.989397049f, 0.850037336f, -0.363507479f, 0.81584239f, 0.669464529f, -0.533437133f, 0.619119048f,
+    -0.551252604f, -0.685080588f, 0.440081835f, -0.345473945f, -0.165842354f, -0.610196054f, -0.0286367387f, 0.0241112821f,
+    -0.712672532f, 0.252887487f, 0.61212188f, 0.699070811f, -0.93624872f, -0.349002182f, 0.426646352f, -0.245351285f,
+    0.889028847f, -0.348767042f, 0.328622878f, -0.546984375f, 0.965379417f, 0.174406722f, -0.645044029f, 0.0332776271f,
+    0.960392416f, -0.5099383f, 0.252488405f, 0.0333561115f, -0.128617331f, 0.216681123f, -0.50081265f, -0.161893323f,
+    0.925517857f, -0.174574152f, 0.937644422f, 0.822110415f, 0.0166772995f, -0.1520904f, -0.296083242f, -0.0478533916f,
+    0.77606535f, -0.627401292f, 0.666092992f, -0.454001307f, 0.341221452f, 0.236639753f, 0.486879051f, 0.777817488f,
+    0.789526284f, -0.356875271f, 0.973726332f, 0.118589044f, -0.0918281004f, 0.133285955f, 0.280316472f, 0.633821428f,
+    0.593937814f, -0.816894889f, 0.365549326f, 0.519106686f, 0.592874587f, -0.984741449f, 0.2550883f, -0.523197174f,
+    0.648587763f, 0.450215012f, 0.273021132f, 0.911731482f, -0.905807137f, -0.762972057f, 0.928093612f, 0.519138515f,
+    -0.305584639f, -0.779774368f, -0.74611187f, 0.420104414f, -0.715044022f, 0.942969978f, 0.944479764f, 0.8220945f,
+    -0.907645941f, -0.507099032f, 0.15974687f, 0.103320442f, -0.292064995f, -0.959156871f, -0.179008275f, 0.196436107f,
+    -0.276454061f, 0.631647408f, 0.960017145f, -0.060176421f, 0.748142302f, -0.849514484f, -0.152863801f, -0.807114422f,
+    -0.153117433f, 0.637047231f, -0.195515141f, -0.254588276f, -0.506758213f, -0.0878747776f, -0.89137429f, -0.542526305f,
+    -0.116434775f, 0.978197575f, -0.198986083f, 0.0729669407f, -0.223977447f, -0.936690271f, -0.860000193f, -0.873552442f,
+    -0.980601549f, -0.0454794019f, -0.462880045f, 0.555067837f, 0.655139089f, -0.505430222f, 0.759843707f, 0.290724069f,
+    -0.525331557f, 0.243578359f, 0.962955296f, -0.450437635f, 0.995696664f, -0.714372098f, 0.231706172f, -0.728993356f,
+    0.354322821f, -0.50424248f, 0.862717152f, 0.0523323603f, -0.346969515f, 0.693556488f, 0.0590638891f, -0.176415265f,
+    -0.949244618f, -0.866883039f, 0.899236679f, 0.792739391f, 0.84630239f, -0.434401363f, -0.660612226f, 0.256994456f,
+    0.253886014f, 0.112530075f, -0.177669898f, -0.405494153f, -0.624463558f, -0.832220793f, -0.720211804f, 0.404948711f,
+    -0.169484854f, -0.106868483f, 0.0032646379f, 0.332793772f, -0.728639483f, -0.039744135f, 0.367261976f, -0.593783975f,
+    0.790844381f, 0.293814301f, -0.524688423f, -0.11099796f, -0.833869815f, 0.0332283564f, 0.93056953f, 0.718212426f,
+    0.791053474f, -0.364719748f, 0.747066557f, 0.929876268f, -0.715231121f, 0.863892734f, -0.231551185f, -0.288835585f,
+    0.0814265907f, 0.0398191661f, 0.882189333f, 0.170012146f, 0.0922238305f, -0.400390148f, -0.846304417f, 0.837943971f,
+    -0.191244155f, -0.112460904f, -0.0549639426f, -0.323358834f, 0.20757471f, 0.190639913f, 0.93258208f, -0.545633852f,
+    0.522189975f, 0.121304534f, -0.57868439f, 0.785455227f, -0.538928092f, -0.33532536f, 0.0503571257f, 0.0076027778f,
+    0.602380335f, 0.00303795165f, 0.254154444f, 0.816090167f, -0.786804914f, 0.462708563f, -0.568607271f, 0.880353212f,
+    -0.310107619f, -0.96149081f, -0.119329438f, 0.249000549f, -0.654840529f, -0.999336302f, 0.240742475f, 0.704619706f,
+    0.21438466f, -0.0891152546f, 0.459453762f, -0.316812664f, 0.329012483f, -0.547875941f, 0.637863576f, -0.32927531f,
+    0.416073978f, 0.361748874f, 0.279132575f, -0.325023085f, 0.161039904f, -0.848514557f, -0.341159075f, 0.585315883f,
+    -0.017460661f, 0.126990885f, 0.162767932f, -0.571730554f, 0.147116438f, -0.188185841f, -0.967405081f, 0.66466254f,
+    0.325325936f, 0.299054325f, -0.416912138f, 0.466517776f, -0.27845943f, -0.821918845f, 0.587572038f, -0.519576788f,
+    0.21627295f, 0.0682691336f, 0.447322339f, 0.161878094f, -0.750828266f, -0.865851045f, 0.389019787f, -0.709756613f,
+    0.480939418f, -0.322809964f, 0.656342149f, 0.546209693f, -0.350266784f, -0.362626553f, -0.540212989f, 0.549286842f,
+    -0.534296632f, 0.352305472f, -0.865263224f, -0.206767544f, -0.4549101f, -0.713502824f, 0.703892589f, -0.140534014f,
+    -0.388333231f, -0.861658275f, -0.208723187f, 0.0706535652f, 0.186132446f, -0.87363255f, 0.645900309f, -0.656262755f,
+    0.915771306f, -0.980644643f, -0.375700235f, 0.520170331f, -0.507075071f, 0.398095101f, -0.520334125f, -0.731842399f,
+    0.730011523f, -0.425946862f, 0.478926212f, 0.851381719f, -0.174432442f, -0.60029763f, -0.0239991844f, 0.574646354f,
+    -0.467458695f, -0.876715541f, 0.941557646f, -0.280833036f, 0.525496602f, -0.80718416f, 0.134619504f, 0.362400204f,
+    0.505164921f, 0.659831107f, -0.533445716f, 0.515274763f, -0.624233544f, -0.551964343f, 0.393309921f, -0.0950536951f,
+    -0.812744379f, -0.57259196f, -0.897772133f, -0.357042342f, 0.69484657f, 0.211336747f, -0.0688438267f, 0.686783791f,
+    0.916984379f, 0.345240206f, 0.897428334f, 0.505031168f, -0.403549969f, -0.420819014f, 0.453563929f, 0.341149062f,
+    -0.431873411f, 0.704942346f, 0.867900372f, 0.763681591f, 0.628775597f, -0.0725907385f, 0.926616907f, 0.508080423f,
+    -0.0514211431f, -0.974528015f, 0.0211860277f, 0.778079689f, -0.370826036f, -0.804849625f, -0.0211233478f, 0.0443617254f,
+    0.401694685f, 0.153884828f, 0.604774594f, 0.282621324f, -0.383647233f, -0.601061702f, -0.299807489f, -0.0445968769f,
+    0.986853361f, -0.0549424253f, -0.408533722f, 0.597808361f, 0.225824788f, -0.769702017f, 0.354362249f, -0.65884614f,
+    0.594068825f, 0.283728838f, 0.367040396f, -0.922258377f, -0.463753492f, -0.266088545f, -0.743523061f, -0.246750444f,
+    0.834375322f, 0.947649479f, 0.105889641f, -0.153745711f, 0.506597519f, -0.609133422f, -0.462741911f, -0.653856635f,
+    -0.85187161f, -0.21340996f, 0.922003925f, 0.377516687f, 0.930906713f, -0.571428418f, -0.614333928f, -0.272941619f,
+    0.451263666f, -0.0147734871f, -0.857162118f, -0.816029966f, 0.981497049f, 0.675497353f, 0.0747903958f, 0.259352893f,
+    0.810181022f, -0.306309134f, -0.108811088f, 0.643334925f, -0.568512917f, -0.881360114f, 0.189857155f, 0.151422575f,
+    0.192622393f, -0.902474165f, -0.675471663f, 0.887738764f, -0.485578865f, 0.527908862f, -0.795835435f, 0.843157887f,
+    0.812416494f, 0.877373576f, 0.955554187f, 0.2803725f, -0.38041091f, 0.919429898f, -0.241801858f, 0.194205478f,
+    -0.297304839f, 0.755321503f, -0.873664916f, -0.459612757f, -0.406865656f, 0.702955604f, -0.279814929f, -0.571100652f,
+    -0.569452763f, -0.568175673f, -0.917087734f, -0.598793387f, 0.691655219f, 0.92396009f, 0.0278698541f, -0.65492481f,
+    0.74780488f, 0.674827874f, -0.154698446f, -0.502145946f, 0.871662915f, 0.186813906f, -0.201227799f, -0.331352055f,
+    0.428452313f, 0.691690266f, 0.23956652f, -0.679608047f, -0.494673461f, -0.947331071f, -0.276595712f, -0.276369989f,
+    0.0384779535f, -0.0800940543f, 0.569294572f, -0.178682029f, 0.449160904f, -0.0247275997f, -0.849412441f, 0.280657589f,
+    0.384709746f, -0.583176732f, 0.288831472f, 0.921480775f, 0.288746655f, 0.881082594f, 0.509648621f, 0.0713693872f,
+    0.690691292f, -0.13000308f, -0.792026103f, -0.197487086f, 0.981613755f, 0.103220232f, 0.510914922f, 0.18557173f,
+    -0.0104711754f, 0.440100223f, 0.0583700314f, -0.681341588f, 0.176045105f, 0.14826338f, -0.206038311f, 0.44677338f,
+    0.154233307f, 0.643997371f, 0.426420331f, 0.925293922f, 0.0248553511f, 0.116220526f, 0.704832911f, -0.674753249f,
+    0.759106994f, 0.849536419f, 0.825734675f, -0.748338759f, -0.626245797f, -0.457170099f, 0.424973309f, 0.320087224f,
+    0.482295692f, -0.0333974846f, -0.464411676f, 0.374815017f, 0.154749036f, 0.00189368776f, -0.620594978f, 0.875128627f,
+    -0.854088247f, -0.603431225f, 0.235427007f, 0.991071939f, -0.775092244f, -0.898688078f, 0.96773833f, -0.653682292f,
+    -0.962874711f, -0.831404924f, 0.508393824f, -0.497185528f, 0.463570356f, 0.45528394f, 0.355678737f, 0.22619766f,
+    0.337779343f, 0.885125875f, -0.643310845f, -0.517547667f, -0.366196305f, 0.935250461f, -0.754763782f, -0.340674639f,
+    -0.921878755f, -0.312285215f, -0.648270249f, 0.0696512759f, 0.926005363f, -0.792222738f, 0.712261379f, 0.299138904f,
+    0.621002793f, 0.0408333279f, 0.456961215f, 0.583982646f, -0.210893065f, -0.750338197f, -0.323159128f, 0.805969417f,
+    0.891022205f, -0.405259907f, -0.517985761f, -0.539137602f, 0.571504831f, -0.377616405f, -0.393244624f, 0.923230708f,
+    -0.668365479f, -0.722037137f, -0.273844123f, 0.337812126f, 0.201417446f, -0.215471223f, 0.316096246f, 0.495345294f,
+    -0.328336179f, -0.0805377439f, -0.504038513f, 0.713895202f, -0.0840715095f, 0.635384679f, 0.888772607f, -0.12461926f,
+    0.988042653f, -0.347363681f, -0.0895740166f, -0.165766746f, -0.427892834f, -0.142023772f, 0.011821866f, 0.126321033f,
+    -0.526966572f, 0.616757751f, -0.82348448f, 0.221017241f, -0.381542534f, -0.933254838f, 0.346066535f, 0.683403969f,
+    -0.118321657f, -0.279907912f, 0.576178133f, 0.817727983f, -0.402682275f, -0.980888188f, 0.513292909f, 0.843640506f,
+    0.265591383f, 0.266414046f, 0.627673507f, 0.648180068f, 0.172310278f, -0.518456161f, -0.260233343f, 0.848719954f,
+    0.10698723f, -0.818601727f, -0.364516258f, -0.522109985f, 0.035119269f, -0.656772673f, 0.0589118078f, 0.0673385188f,
+    0.366082668f, 0.241709262f, 0.832330704f, 0.101791166f, 0.665953577f, -0.738734603f, 0.746964633f, -0.52215898f,
+    -0.0200768299f, 0.779073298f, 0.610618711f, 0.496847123f, -0.997076035f, -0.144877702f, 0.576377928f, 0.248021364f,
+    0.80670017f, -0.355431616f, 0.876021683f, 0.468548566f, 0.584457636f, 0.208708271f, 0.987918913f, 0.84164083f,
+    -0.612805665f, -0.826629043f, -0.265512079f, -0.536042154f, -0.906452239f, 0.918038249f, 0.607855737f, 0.504094005f,
+    0.436578155f, -0.213867337f, 0.935071588f, -0.661749065f, -0.961754501f, -0.611612797f, 0.376078635f, -0.910421312f,
+    0.599674284f, 0.921334565f, -0.0344248451f, -0.702808142f, -0.0400523469f, 0.137586281f, -0.146853447f, 0.818205237f,
+    -0.619445026f, 0.840470731f, -0.272780627f, -0.777481616f, 0.811502337f, -0.30868119f, -0.269363374f, -0.314740419f,
+    -0.15396966f, -0.321402222f, 0.214254767f, -0.816391587f, -0.38930732f, 0.0653189644f, 0.785159767f, -0.965214431f,
+    0.633446991f, -0.01815545f, -0.727210104f, -0.282841861f, -0.548695385f, 0.991452873f, -0.0773404986f, -0.0787739977f,
+    -0.575149179f, -0.496262461f, 0.47515139f, -0.435432047f, 0.73146522f, -0.632820606f, -0.0323535688f, 0.793788195f,
+    0.660673022f, -0.418095618f, -0.773448825f, -0.156833738f, -0.306688666f, 0.416927665f, -0.846086502f, -0.220745847f,
+    0.476160258f, -0.97798121f, -0.813689232f, 0.604310393f, -0.604672134f, 0.165346637f, -0.0932677835f, -0.796315372f,
+    -0.874855101f, -0.154565528f, -0.158171311f, 0.209168568f, -0.313271165f, 0.896810412f, 0.918776751f, 0.450832397f,
+    -0.887340963f, -0.944353521f, -0.300935715f, -0.96865809f, -0.626178086f, -0.913972199f, -0.460282952f, -0.458431751f,
+    -0.25369969f, 0.605927706f, -0.179692566f, -0.963298857f, -0.401233882f, 0.96930939f, -0.459096104f, 0.730550647f,
+    0.784428179f, -0.434939653f, 0.274849206f, 0.852048159f, -0.88976568f, 0.088260442f, -0.113063969f, 0.114510879f,
+    -0.00639372785f, -0.879190803f, 0.787288129f, -0.284279495f, 0.87099427f, -0.0915728658f, -0.250986069f, -0.664563537f,
+    0.760631263f, -0.463505089f, -0.829684854f, 0.943388402f, -0.76915127f, -0.463177532f, 0.839565158f, -0.36457932f,
+    -0.547888577f, 0.70114553f, 0.35526374f, -0.498776346f, -0.836020648f, 0.196643442f, -0.299163848f, -0.15275152f,
+    -0.374875605f, -0.33269906f, -0.0543736927f, 0.397987008f, 0.998158276f, 0.292563915f, -0.527301908f, 0.550529659f,
+    -0.20664987f, -0.1821758f, 0.26318112f, 0.905126214f, -0.504660666f, 0.714251697f, -0.242400855f, 0.652377665f,
+    -0.0854765102f, 0.931548655f, 0.827524364f, 0.262284189f, -0.275836796f, -0.23158364f, -0.333184958f, 0.0166095998f,
+    0.115599521f, 0.535768032f, -0.103465617f, -0.108673818f, 0.957462609f, -0.983692169f, 0.413978577f, 0.142930225f,
+    -0.578297734f, -0.0217866842f, -0.955261946f, 0.319684267f, 0.713996291f, 0.188792959f, -0.502635717f, 0.605213225f,
+    -0.0461935475f, 0.940789998f, 0.804785252f, -0.059305992f, -0.675825357f, -0.350935072f, -0.884877324f, 0.0560142659f,
+    -0.380143225f, 0.59439224f, 0.118366085f, -0.135409743f, 0.541587234f, -0.860101104f, -0.22942774f, -0.99078393f,
+    0.058266595f, -0.252180487f, -0.304224044f, -0.290069371f, -0.663767397f, 0.945734382f, -0.53411907f, -0.890083134f,
+    -0.239447683f, 0.514397442f, 0.490813941f, -0.0141570764f, 0.531539559f, 0.81396848f, 0.892904401f, -0.347964913f,
+    -0.425448626f, 0.720163703f, 0.150554538f, 0.289833903f, 0.134983405f, 0.20724304f, 0.0126435915f, -0.646212816f,
+    0.734953225f, 0.66669488f, 0.192464724f, 0.861251175f, 0.864875257f, -0.483610392f, -0.925878763f, 0.198952585f,
+    -0.650288403f, 0.927123189f, -0.556117654f, 0.0198302157f, -0.288375705f, 0.884232938f, -0.66894716f, -0.527394414f,
+    0.294287413f, -0.208880067f, -0.6626513f, 0.143680081f, -0.575831175f, 0.0968261138f, -0.0794659629f, -0.325313896f,
+    0.0871466249f, 0.972163081f, 0.64808774f, 0.340739042f, -0.374178886f, -0.624374866f, 0.674844205f, 0.806975842f,
+    -0.621414542f, -0.717069149f, -0.634098053f, 0.298463732f, 0.404578686f, -0.366463423f, 0.591055572f, 0.11242415f,
+    -0.0928265154f, 0.95967257f, 0.767928839f, -0.689664185f, -0.368899435f, 0.858748734f, 0.305917531f, -0.792262733f,
+    -0.431435406f, -0.778922379f, -0.234943241f, 0.657102704f, -0.0469461344f, -0.615369678f, 0.610434651f, 0.544748008f,
+    0.255365759f, 0.201606616f, 0.345044047f, 0.32339552f, 0.762240589f, 0.146661803f, 0.516772032f, 0.766732156f,
+    -0.733677864f, 0.0397748351f, 0.048253648f, 0.0153793124f, -0.171970576f, 0.908773661f, 0.276749611f, -0.805523574f,
+    0.331005782f, -0.0727140158f, -0.322206318f, -0.344275594f, 0.371427953f, -0.989278436f, 0.300375849f, 0.447930068f,
+    0.102724172f, 0.165043175f, 0.176586032f, -0.5256688f, 0.113613345f, -0.12156371f, -0.805613458f, 0.79060775f,
+    -0.2116272f, -0.152005851f, 0.728449106f, -0.769067764f, -0.138368338f, 0.448983669f, 0.685890436f, -0.995916247f,
+    0.799780548f, -0.0465959199f, -0.841359198f, 0.390602976f, 0.199295998f, 0.792499363f, 0.996582866f, -0.12219768f,
+    -0.88493216f, 0.601087868f, 0.639568031f, 0.406812906f, 0.530202091f, -0.388371676f, 0.259918511f, -0.804687202f,
+    0.771772504f, -0.0188137796f, -0.572102308f, -0.601412475f, 0.929644763f, 0.653130352f, 0.914643288f, 0.477921009f,
+    -0.532119632f, -0.496017009f, 0.127322897f, 0.0941460803f, -0.51602155f, -0.20734337f, -0.206855476f, 0.524034798f,
+    -0.536146045f, -0.498942137f, -0.0708940327f, -0.713101745f, -0.635372162f, 0.345639437f, -0.932656765f, -0.616784096f,
+    -0.0771036446f, 0.0914469808f, -0.172530621f, -0.78640759f, -0.8622576f, -0.317715138f, 0.509310544f, -0.54666537f,
+    0.369844198f, -0.89840883f, 0.858887017f, 0.358361214f, -0.753206491f, 0.332585752f, -0.898757219f, -0.766795814f,
+    -0.229007185f, 0.733452857f, 0.712807178f, 0.0632577911f, -0.450712085f, -0.942047119f, -0.13419266f, -0.572472036f,
+    0.157592744f, -0.310949385f, 0.922715843f, 0.69062078f, 0.375174135f, 0.083500959f, 0.268443197f, 0.920740068f,
+    0.443066776f, -0.127676606f, 0.337848246f, 0.29516691f, -0.819602847f, -0.720517695f, 0.543124497f, -0.0383805893f,
+    -0.631479204f, -0.700703263f, -0.376210392f, 0.34450835f, -0.554759741f, -0.787689984f, -0.118564144f, -0.509287477f,
+    -0.680220783f, 0.858111978f, 0.177618712f, -0.873903215f, 0.134528115f, 0.505291402f, 0.0748732388f, 0.364278942f,
+    -0.248583421f, 0.77138716f, 0.124127351f, 0.541435063f, -0.910092235f, 0.82501179f, -0.244474754f, -0.0181061216f,
+    0.80816102f, 0.296939343f, 0.923302889f, 0.736525416f, -0.504889905f, -0.011684007f, -0.290915161f, 0.0112174042f,
+    -0.133263528f, -0.961409211f, 0.50270921f, -0.843236685f, 0.940050542f, -0.582008004f, 0.675551951f, -0.0160823092f,
+    0.939429939f, 0.248500064f, -0.375455141f, 0.0974094421f, -0.742420256f, 0.952340424f, -0.83113271f, -0.613442481f,
+    0.622290194f, 0.178554252f, -0.435788274f, 0.158280849f, -0.541006505f, 0.634753346f, -0.659661651f, -0.820270121f,
+    0.442015141f, 0.235153407f, -0.598004341f, 0.0405088514f, 0.914775491f, -0.485110819f, 0.129605815f, 0.994297564f,
+    -0.355598688f, 0.925387621f, 0.542891383f, 0.463342994f, -0.901338398f, 0.611535728f, 0.805082321f, 0.88227576f,
+    0.662331164f, 0.817651272f, -0.62378031f, 0.575024068f, -0.402885824f, 0.169866055f, -0.782340527f, -0.558759093f,
+    -0.59257561f, 0.794254899f, 0.422571152f, 0.0250316467f, -0.797421575f, -0.647272289f, -0.908253789f, -0.167268917f,
+    0.23575449f, 0.140663192f, -0.515669763f, 0.958042204f, -0.230045259f, 0.766108394f, 0.0819351375f, -0.701347888f,
+    -0.513131738f, -0.148068815f, -0.601741076f, -0.197861925f, -0.0552649833f, 0.82328552f, -0.374949813f, 0.131514102f,
+    0.802745521f, -0.32427749f, -0.446943521f, 0.0817395151f, 0.336422175f, 0.149784833f, -0.440172911f, 0.0880539045f,
+    -0.256703973f, 0.370844603f, 0.267517954f, 0.372539341f, 0.297420561f, -0.418849111f, -0.604255497f, 0.248781756f,
+    -0.267427683f, -0.383270591f, -0.252804428f, 0.208265677f, -0.2881262f, -0.334388465f, 0.771511257f, 0.554098129f,
+    0.797287107f, -0.740786135f, -0.745229363f, -0.338961631f, -0.954359412f, 0.977688372f, 0.507177651f, -0.77618593f,
+    -0.535741985f, 0.330910027f, 0.408157051f, 0.650299728f, 0.159971401f, -0.715685248f, 0.410400987f, -0.776232123f,
+    -0.719299495f, 0.383642286f, 0.935036957f, -0.225155994f, 0.255714297f, -0.921198368f, 0.430934727f, 0.152626961f,
+    -0.0649068952f, -0.91586107f, -0.532579541f, 0.489928514f, -0.832935631f, 0.635292649f, 0.273526788f, 0.881329715f,
+    0.896941781f, -0.53950417f, -0.428931445f, 0.281476408f, -0.228818581f, 0.105746992f, -0.97186321f, 0.0771597773f,
+    0.307660878f, -0.835484207f, 0.858503878f, -0.791464448f, 0.0710975975f, 0.20060271f, -0.930114269f, 0.778945446f,
+    -0.525880635f, -0.502741635f, 0.86505425f, -0.855348647f, -0.584343553f, -0.63402003f, 0.230483517f, -0.0256569758f,
+    -0.269916236f, 0.497950852f, 0.535569549f, 0.560750484f, 0.123649888f, 0.298877656f, -0.176990524f, 0.256549299f,
+    -0.248452753f, 0.969881892f, 0.927787364f, -0.815288782f, -0.00158244162f, 0.180883899f, -0.842105091f, 0.278220773f,
+    0.854633033f, 0.125026703f, -0.297269076f, -0.639993072f, -0.147880703f, 0.261143297f, 0.121266894f, 0.361123294f,
+    -0.161294773f, -0.277398229f, 0.23122938f, -0.445010096f, 0.222118184f, -0.00852499995f, 0.688871443f, -0.894356251f,
+    0.580963135f, -0.682044089f, -0.732796907f, 0.934067965f, 0.453983754f, 0.894962966f, 0.987454653f, 0.244031593f,
+    -0.089127332f, 0.850406706f, 0.173507944f, -0.669538081f, -0.86924082f, -0.804878473f, -0.514963031f, -0.19045043f,
+    -0.616663158f, 0.0107971691f, 0.226123482f, 0.697723448f, 0.720443726f, 0.740149856f, -0.112426072f, -0.456546098f,
+    -0.365140468f, -0.0228908155f, 0.767885506f, -0.605064809f, 0.137744814f, -0.814558148f, 0.320057362f, -0.985108733f,
+    -0.629532814f, 0.219274566f, -0.779576778f, -0.371536672f, -0.348640263f, 0.963259399f, -0.246151835f, -0.854109824f,
+    0.625397027f, 0.0322746336f, 0.827234328f, 0.211059302f, 0.560384095f, 0.221204713f, 0.247568801f, -0.802272081f,
+    -0.805580258f, -0.30057627f, -0.26967451f, 0.407874703f, 0.329356551f, 0.928720474f, -0.0440226756f, 0.245097339f,
+    -0.308426678f, -0.0664581656f, 0.412820846f, 0.658713937f, 0.335351676f, 0.923484564f, 0.679967642f, 0.70125699f,
+    -0.531474829f, -0.435393304f, -0.794112265f, 0.258414209f, 0.656209469f, -0.0971791595f, 0.192835197f, 0.154423773f,
+    -0.0719929263f, -0.679172337f, -0.959237158f, 0.716878772f, -0.165212497f, -0.333801985f, -0.134161696f, -0.294729084f,
+    -0.569427311f, -0.107081711f, 0.749284744f, 0.76697576f, -0.299049348f, -0.58555156f, 0.526031673f, 0.783360839f,
+    0.460075825f, 0.205885008f, -0.24497053f, 0.111681163f, -0.867735147f, -0.0326442681f, -0.278037041f, 0.40696913f,
+    0.0043744687f, 0.351703942f, 0.936692774f, -0.652926922f, -0.0135308923f, 0.49903512f, 0.430130452f, 0.601355314f,
+    0.339792669f, 0.193273738f, 0.0327917896f, -0.389162123f, -0.280779392f, 0.945505977f, 0.378059626f, 0.0387286246f,
+    0.308226168f, 0.132634163f, -0.0667902157f, 0.157525122f, 0.751325071f, 0.930912852f, 0.554147124f, -0.97543925f,
+    0.765689433f, -0.29834035f, -0.630300224f, 0.839850307f, -0.924073756f, 0.809954405f, -0.89608866f, -0.774632871f,
+    0.806594789f, 0.0844207928f, -0.112990305f, 0.878150582f, -0.995218933f, -0.254786402f, -0.504380941f, 0.140274584f,
+    -0.0155193424f, 0.601131022f, 0.993485153f, -0.636050999f, 0.321151376f, -0.78355664f, 0.512506008f, 0.310562164f,
+    -0.587385893f, -0.913000345f, -0.985765576f, 0.199530333f, 0.842695594f, 0.80554539f, 0.603354752f, 0.194638655f,
+    -0.936724782f, -0.915702939f, 0.417299867f, -0.395131052f, -0.921976507f, -0.584275663f, 0.178070515f, -0.181080878f,
+    -0.651881397f, 0.124175161f, 0.171817139f, 0.775627255f, 0.0163522866f, -0.441620559f, -0.289137781f, 0.34709689f,
+    0.635230303f, -0.833050311f, 0.339854091f, -0.0956190974f, -0.941527843f, 0.735968053f, 0.439215422f, 0.763214886f,
+    -0.0435576066f, 0.0208722241f, -0.425048441f, 0.349050581f, 0.733914852f, 0.568998933f, 0.358063072f, -0.310354322f,
+    -0.841751695f, 0.561998129f, 0.151412532f, 0.231591865f, 0.0262475125f, 0.279928744f, -0.376263052f, -0.99595654f,
+    -0.0645653829f, -0.441090435f, 0.837915242f, 0.103841595f, 0.29301393f, -0.481241971f, -0.556814134f, 0.242099524f,
+    -0.933741033f, 0.12510711f, -0.587880254f, -0.114285469f, -0.584169984f, 0.500846565f, -0.767793953f, -0.112780869f,
+    -0.852098048f, -0.704210997f, 0.0356595889f, 0.520720959f, -0.648292065f, 0.601016104f, 0.601460874f, -0.249416783f,
+    0.605112791f, -0.338852495f, 0.313869357f, -0.711665511f, -0.53765291f, -0.276156753f, 0.184904754f, -0.364623278f,
+    -0.926425576f, 0.370406777f, 0.24786751f, -0.86973983f, 0.66256243f, 0.890586913f, 0.108481035f, -0.720674872f,
+    -0.533598959f, 0.577530682f, -0.317792177f, 0.479273081f, -0.929907382f, -0.828421772f, -0.143552274f, 0.442874819f,
+    0.631614387f, 0.210237935f, -0.852663457f, 0.316733241f, 0.11178463f, 0.0763823912f, -0.0537189655f, 0.397458762f,
+    -0.570698023f, 0.623611331f, -0.984216154f, 0.384487331f, 0.175931945f, -0.467799574f, -0.499904603f, -0.941961765f,
+    0.633286417f, 0.496705413f, -0.632349253f, 0.0873774886f, 0.570402086f, 0.426984638f, -0.815259755f, 0.221464798f,
+    -0.715378165f, 0.95674473f, -0.885311306f, -0.923784018f, 0.475529134f, -0.940779328f, 0.450519145f, -0.505888343f,
+    -0.343179673f, -0.772196651f, -0.419198424f, 0.0932436809f, -0.441338152f, -0.573612988f, -0.684087515f, 0.496154279f,
+    0.19298853f, 0.918777943f, -0.738979757f, 0.230137646f, 0.268960118f, 0.503810883f, 0.85491848f, -0.563390791f,
+    0.236334607f, 0.951529324f, -0.493685335f, 0.961274981f, -0.682527006f, -0.912340105f, -0.398648977f, 0.00416015694f,
+    -0.201066226f, 0.852861047f, -0.855409205f, 0.95232904f, 0.553420126f, 0.966359913f, 0.807160676f, -0.78873378f,
+    0.365281343f, 0.463852704f, -0.30919072f, 0.0829493329f, -0.606379032f, -0.76380688f, 0.332456946f, 0.803946853f,
+    0.247798115f, 0.559152782f, 0.0920599699f, -0.232435882f, -0.26531443f, 0.0548866391f, 0.334592909f, 0.208114505f,
+    -0.281935185f, -0.909121394f, -0.879701912f, 0.257672727f, -0.0817540735f, -0.79912132f, -0.216819048f, -0.249725237f,
+    0.0491310433f, -0.353075087f, -0.586936176f, 0.589362085f, -0.700547576f, -0.965730488f, -0.627156794f, 0.179518282f,
+    -0.706437647f, -0.118736409f, -0.439081073f, 0.796420515f, -0.0202415362f, 0.817155957f, 0.704989791f, 0.749454498f,
+    -0.314706385f, 0.354913801f, -0.400293887f, 0.279942572f, -0.0831956565f, -0.743297935f, -0.22358115f, 0.350684077f,
+    0.138014898f, -0.309541881f, -0.813083649f, -0.142943248f, 0.53638202f, 0.980622113f, 0.0965080038f, -0.935841739f,
+    -0.541508198f, -0.880576372f, -0.163317695f, 0.713778317f, -0.698524475f, 0.737525403f, -0.473757058f, 0.910893559f,
+    0.0459494404f, 0.573162675f, 0.696905792f, -0.946420372f, -0.928244114f, 0.0775853395f, -0.115784839f, -0.143498823f,
+    0.602559209f, 0.370284349f, 0.913545668f, -0.893017173f, -0.632302761f, -0.81696099f, 0.221092865f, 0.299567223f,
+    0.851788878f, 0.151817843f, 0.406489938f, -0.0454487577f, 0.595123708f, -0.697180092f, 0.73876363f, 0.235676676f,
+    0.358466446f, -0.408006012f, 0.241271406f, -0.46492061f, -0.716108382f, -0.815035701f, -0.0716952384f, 0.385245085f,
+    0.463369727f, -0.896348953f, -0.413469315f, -0.0938812271f, -0.547727644f, -0.919141114f, 0.950048268f, -0.993621945f,
+    -0.261694521f, 0.867013931f, 0.0942617208f, 0.677260041f, 0.263021559f, -0.0583529994f, -0.926030278f, 0.456023067f,
+    -0.684000671f, -0.297039241f, -0.870845795f, 0.815534055f, 0.539394557f, -0.0123552997f, 0.657495022f, 0.855657101f,
+    0.0552279912f, 0.191246018f, 0.199101627f, 0.743813276f, -0.287664562f, 0.138585627f, 0.154313177f, 0.131300583f,
+    0.565922976f, 0.582219243f, -0.714990139f, -0.598059535f, 0.225246221f, -0.625523388f, -0.78654027f, -0.228498161f,
+    -0.742444158f, -0.806977332f, 0.947296441f, -0.768416345f, 0.0427930132f, -0.622345209f, -0.098686859f, -0.355218887f,
+    0.348020792f, 0.547980487f, 0.28775233f, -0.941126287f, -0.794430315f, -0.899620116f, 0.824687421f, 0.162499398f,
+    -0.281774759f, 0.673520803f, -0.815023363f, 0.393230885f, 0.712086737f, -0.90563637f, -0.130136296f, 0.981730759f,
+    -0.987376094f, 0.376099885f, 0.712402761f, 0.587726891f, 0.534040153f, 0.0834251493f, 0.969442785f, -0.874077618f,
+    -0.462545037f, 0.304187298f, -0.749520481f, 0.84086138f, -0.991000056f, -0.906057954f, 0.847515285f, -0.23405318f,
+    0.527472734f, -0.532163799f, -0.967611432f, -0.352220833f, 0.286157548f, 0.961359084f, 0.38476795f, -0.427870601f,
+    -0.795788705f, -0.931298494f, -0.713430166f, -0.891037464f, -0.715846956f, -0.459073305f, -0.874616325f, 0.715359628f,
+    0.629559696f, 0.428015143f, -0.974614978f, -0.823171198f, -0.666433215f, -0.800963223f, 0.642822266f, -0.528827846f,
+    -0.418447167f, 0.111188985f, 0.921925962f, -0.441582769f, -0.50611949f, 0.836580276f, 0.481177092f, 0.0859559253f,
+    -0.573691368f, -0.598651052f, 0.245106816f, -0.340578198f, 0.91966784f, -0.942019284f, 0.994164169f, 0.848839283f,
+    0.706341207f, -0.542945087f, -0.695605516f, 0.318609893f, 0.386581898f, -0.585227191f, 0.389348865f, -0.64526701f,
+    -0.161553979f, -0.867197394f, 0.876760483f, -0.973661721f, -0.905646384f, -0.976497889f, 0.39961201f, -0.862670064f,
+    0.604684114f, 0.757299364f, 0.276469648f, 0.126349539f, 0.517690003f, -0.878593504f, -0.588013649f, -0.563429773f,
+    0.0584828295f, -0.434516102f, -0.839186668f, 0.741556883f, -0.0800588131f, 0.141856432f, 0.372556955f, -0.562348127f,
+    -0.0154197672f, -0.546925724f, -0.950597823f, -0.660138547f, -0.490839034f, 0.268647403f, -0.918349624f, 0.0767154768f,
+    0.0375166647f, -0.983738482f, -0.691072881f, -0.288965523f, -0.189331412f, 0.212102771f, -0.194171548f, -0.912513614f,
+    -0.645466626f, -0.0102300793f, -0.672924578f, -0.519616783f, 0.16682525f, 0.941701412f, -0.564922392f, -0.401740104f,
+    0.744288623f, -0.801379204f, -0.233822539f, -0.230310753f, 0.994204819f, 0.431695998f, -0.370239228f, -0.0880528018f,
+    -0.449886113f, 0.641572773f, 0.915291905f, -0.589476347f, 0.220465571f, 0.583871603f, -0.465890437f, 0.0496814586f,
+    -0.629028857f, 0.426704288f, 0.670754313f, -0.343333274f, -0.801620543f, -0.419469059f, 0.909362078f, 0.601412892f,
+    0.93579179f, 0.36245504f, 0.183449239f, -0.886044681f, 0.672583699f, 0.546171248f, -0.439782828f, 0.788718164f,
+    -0.488946378f, 0.328555673f, 0.605401754f, -0.0654273331f, -0.0331577696f, -0.139036804f, 0.0679349452f, 0.370963931f,
+    0.52560097f, 0.271430075f, 0.38138926f, 0.605542481f, 0.864082158f, 0.12251576f, 0.626705885f, 0.0506364144f,
+    -0.365711391f, 0.767804921f, 0.137467846f, 0.0540691577f, 0.636867344f, 0.867428184f, 0.757349014f, -0.955900192f,
+    -0.186316922f, -0.922998786f, -0.120619752f, -0.265550256f, -0.739170492f, -0.757351518f, 0.777378917f, -0.312391162f,
+    0.662863255f, -0.718615174f, -0.103431009f, 0.834941804f, 0.56735903f, 0.441838235f, -0.833345413f, 0.241131067f,
+    0.259083271f, -0.424380749f, 0.8317011f, -0.596024632f, 0.433680356f, -0.0465042889f, -0.745878994f, 0.810917974f,
+    -0.510502934f, -0.1718954f, 0.560955167f, -0.754366577f, 0.173918888f, -0.213456944f, 0.698677778f, 0.35807851f,
+    0.261637807f, -0.847853541f, -0.53853935f, 0.592195988f, 0.220238656f, -0.429316491f, 0.428334326f, -0.253692865f,
+    -0.812621295f, 0.746155381f, -0.812248647f, -0.029561488f, -0.0447817855f, -0.898857832f, 0.911204636f, -0.0460103713f,
+    -0.912951112f, -0.125254691f, 0.281524509f, 0.682899535f, 0.263925672f, 0.734242737f, -0.920623839f, -0.572121382f,
+    -0.647625566f, 0.12481425f, 0.357124001f, -0.415569395f, -0.781842053f, 0.876378953f, 0.427067518f, 0.662454486f,
+    -0.583826244f, 0.843653917f, 0.384594053f, -0.969924033f, -0.796889961f, 0.432584196f, -0.608744442f, -0.884684563f,
+    0.505163133f, 0.340736449f, -0.496412128f, 0.575134337f, 0.978264153f, 0.048336409f, -0.297793567f, 0.394208044f,
+    0.814905941f, -0.845069647f, -0.146899939f, 0.00273718894f, 0.456001848f, 0.369903117f, 0.478880167f, -0.392418146f,
+    0.561959982f, 0.874178588f, -0.489647835f, -0.734003246f, 0.518376708f, 0.54230088f, -0.171354517f, 0.402951717f,
+    -0.334792316f, -0.986308694f, -0.760447145f, 0.162459522f, 0.453466892f, 0.610709906f, -0.942668498f, -0.979673445f,
+    0.0680023506f, 0.525976181f, 0.366224319f, 0.935970485f, -0.237277627f, -0.491857588f, 0.709776342f, 0.508047223f,
+    0.0365801826f, -0.837405622f, 0.201783538f, 0.864289522f, -0.942970872f, 0.450240701f, -0.800760627f, 0.805049539f,
+    -0.330335468f, 0.996065736f, -0.104251288f, -0.178932086f, 0.00564786466f, -0.858036816f, -0.459222198f, -0.614569664f,
+    0.867092073f, 0.937952995f, 0.365100741f, -0.330834001f, 0.560735106f, 0.330640018f, -0.570619941f, 0.92951405f,
+    0.931492686f, 0.691491723f, 0.311576366f, -0.273798078f, -0.27550444f, 0.437197566f, 0.753462076f, 0.442872256f,
+    0.0897836238f, -0.183990315f, -0.647983074f, 0.967152774f, -0.390347958f, 0.251522213f, 0.488112479f, 0.906764746f,
+    -0.773694634f, -0.348463893f, -0.577352703f, 0.0776884034f, 0.116373539f, 0.0962819681f, 0.958669722f, -0.498584539f,
+    -0.397247434f, -0.201562524f, -0.463876277f, 0.509580314f, -0.0157218799f, 0.731632292f, 0.425685614f, -0.468328714f,
+    -0.776958466f, -0.439810872f, 0.43341431f, 0.616338253f, -0.8233639f, 0.666349471f, 0.856171012f, 0.667770445f,
+    0.140958637f, -0.420798689f, -0.856451094f, -0.215609848f, -0.0217664819f, 0.939076483f, 0.369976938f, 0.840842366f,
+    0.311656535f, 0.52388531f, 0.0683913752f, -0.391513705f, 0.617495179f, 0.74289304f, 0.12931864f, 0.592249632f,
+    -0.485681117f, -0.700680733f, 0.293726444f, -0.82037127f, -0.377658725f, -0.0677257702f, -0.833433509f, -0.00636797724f,
+    0.949376106f, -0.0151396645f, 0.812173247f, -0.0900870264f, 0.443720073f, 0.837453604f, 0.358604193f, -0.327294499f,
+    -0.865912974f, 0.740651011f, 0.80455482f, -0.262283087f, 0.636245847f, -0.19264777f, 0.597693563f, 0.476380795f,
+    -0.467585772f, -0.356769592f, 0.0812173337f, -0.0830470249f, -0.636270761f, -0.522345126f, 0.204452828f, 0.33429867f,
+    -0.520416796f, 0.0785199776f, -0.998118281f, -0.628649533f, 0.0810506195f, -0.13628979f, 0.145601913f, -0.946076751f,
+    -0.0910997838f, 0.150820419f, 0.742037594f, 0.0604870804f, -0.0953888893f, -0.145302057f, -0.232533246f, 0.777149975f,
+    0.472806811f, 0.301326543f, 0.300355196f, 0.976326227f, 0.730659962f, 0.243885636f, 0.173581734f, -0.630230248f,
+    -0.604980826f, -0.390602052f, 0.628318489f, -0.900308967f, -0.76537925f, 0.939286053f, -0.525649607f, 0.840092123f,
+    0.643134356f, 0.855659962f, 0.313417226f, -0.220306858f, -0.469186753f, 0.219784141f, 0.668330491f, -0.63132143f,
+    -0.234473333f, -0.249123424f, -0.710069418f, -0.286686301f, 0.0588360578f, -0.118793868f, -0.816460311f, 0.167816788f,
+    0.949276865f, -0.5230124f, -0.379234076f, 0.670998693f, 0.954883754f, 0.672456861f, 0.891249716f, 0.354212791f,
+    -0.906845331f, -0.275280893f, -0.123138651f, 0.841981411f, 0.0798251852f, -0.324979037f, -0.438583106f, -0.648861647f,
+    -0.551521599f, 0.811029375f, -0.396443933f, -0.219384849f, -0.327490509f, -0.750235796f, -0.18344216f, -0.732742548f,
+    0.119012631f, -0.813692331f, -0.479905158f, -0.399154007f, -0.241042897f, 0.614055336f, -0.31279555f, -0.593319952f,
+    -0.324828893f, -0.106628224f, 0.276535869f, -0.323693544f, -0.926575303f, -0.314520061f, 0.592252553f, 0.0780626684f,
+    -0.855125487f, -0.833292127f, -0.863992751f, 0.331385404f, 0.254723579f, 0.34752655f, 0.17455633f, 0.648418188f,
+    -0.61803484f, -0.741299629f, -0.85547626f, 0.02219918f, 0.831952274f, 0.119644247f, 0.738140643f, 0.033641912f,
+    0.483151048f, 0.18774417f, -0.0984621271f, 0.72985512f, 0.381892115f, -0.513423979f, -0.254318088f, 0.465641886f,
+    -0.409814835f, 0.912504792f, 0.146194443f, 0.434091181f, -0.699316442f, -0.790639043f, -0.190216631f, 0.540192723f,
+    -0.397950709f, -0.906087756f, 0.873161495f, -0.965962052f, -0.348712206f, -0.859070659f, -0.577055275f, -0.699002683f,
+    0.509170294f, 0.425067157f, -0.853689015f, 0.521475017f, 0.559159875f, 0.11122869f, -0.95551616f, -0.201767832f,
+    0.973289073f, -0.217913121f, 0.104628891f, 0.419646859f, -0.358758479f, 0.917690098f, 0.0386168212f, -0.0284122434f,
+    -0.930939972f, 0.780424953f, 0.298225284f, -0.580450952f, -0.988206029f, -0.67245996f, -0.979381919f, -0.838445008f,
+    0.880685449f, -0.210228056f, 0.0642822832f, 0.0268442538f, 0.81980449f, 0.194506854f, 0.603144526f, 0.817056894f,
+    0.706737876f, 0.266907692f, -0.261001587f, 0.145962909f, -0.860542119f, -0.470608681f, -0.17509535f, -0.668564498f,
+    0.258710146f, -0.411759257f, -0.592957795f, 0.154403895f, -0.378685921f, 0.760745406f, 0.844074011f, -0.932306111f,
+    -0.117476933f, -0.28830412f, 0.806590974f, -0.845063865f, -0.0643802211f, 0.710000992f, 0.584356964f, -0.931299448f,
+    0.00991332438f, -0.804946661f, 0.246894568f, 0.874663413f, 0.105833434f, -0.250647128f, -0.14260155f, 0.978917062f,
+    0.464801997f, 0.673302233f, -0.248192802f, 0.809393525f, -0.448254526f, -0.0697777122f, -0.245389059f, 0.111521326f,
+    0.686469257f, 0.223456085f, 0.332917184f, 0.954364061f, -0.341567546f, -0.121489495f, -0.96744144f, 0.0856240466f,
+    0.349527955f, -0.794186115f, -0.71099627f, -0.432743222f, -0.61813724f, -0.867163599f, -0.595105827f, -0.40467006f,
+    -0.145359114f, 0.290065795f, 0.121063441f, 0.587846279f, 0.140187815f, -0.379144311f, -0.918548107f, -0.270056844f,
+    -0.0358210914f, -0.0776004866f, -0.0512637608f, 0.187086046f, 0.279286116f, -0.71253103f, -0.726517022f, -0.977218509f,
+    -0.972187221f, -0.816254318f, -0.116882019f, 0.298376828f, -0.919135094f, 0.145446464f, 0.726037025f, 0.287383705f,
+    -0.604436517f, 0.263047278f, 0.25536108f, 0.261590064f, 0.238565952f, -0.4637402f, -0.781926811f, 0.876915932f,
+    0.902890623f, 0.619611919f, 0.849235117f, 0.101994291f, 0.0401928462f, 0.147002175f, -0.731480956f, 0.50246495f,
+    0.475336909f, -0.145130903f, -0.277935386f, -0.577877402f, -0.830529749f, 0.411566287f, -0.733199596f, -0.4178482f,
+    0.291303873f, 0.729320765f, 0.108305044f, -0.730015993f, 0.360644966f, 0.279012591f, -0.964382231f, -0.985090554f,
+    0.735944271f, 0.0728130043f, -0.562052369f, -0.0945637152f, 0.136102766f, -0.441532344f, 0.482045382f, 0.502537668f,
+    -0.830880105f, 0.75538069f, -0.0177907832f, 0.879249454f, -0.236338124f, 0.594692349f, 0.201666519f, 0.537457585f,
+    0.233712807f, -0.858070254f, 0.523358166f, 0.897862375f, -0.119205296f, 0.920934796f, -0.95356524f, 0.510137022f,
+    0.531421006f, 0.522567511f, -0.125862643f, -0.424923688f, -0.466127962f, 0.913162589f, 0.861403108f, -0.346670061f,
+    0.254411519f, 0.0267631356f, -0.803153872f, 0.0781211033f, 0.673483014f, 0.451499701f, 0.225430578f, 0.306481898f,
+    0.133561611f, -0.0241507553f, 0.271514863f, 0.619186282f, 0.457453489f, -0.55422157f, 0.899595559f, 0.119847558f,
+    0.160064921f, -0.180403307f, 0.309987336f, -0.977166772f, -0.87180984f, -0.597941101f, 0.670755744f, -0.341558576f,
+    0.901587963f, 0.305369794f, -0.0489007458f, 0.271242052f, 0.248054728f, -0.703566194f, -0.880463898f, 0.738337815f,
+    -0.234294325f, 0.137390584f, 0.047779806f, 0.308370233f, -0.414714068f, -0.662217081f, 0.3605088f, 0.344110459f,
+    0.0636724234f, 0.38079232f, 0.590105355f, 0.232165396f, 0.390841335f, -0.925708294f, -0.155360937f, -0.340850979f,
+    0.0681630522f, 0.841812015f, -0.854850352f, 0.985259473f, 0.202095315f, 0.917811513f, 0.256722212f, -0.357092202f,
+    -0.688674033f, 0.859568954f, -0.637832105f, 0.626456797f, -0.452176511f, -0.472649813f, -0.309316874f, 0.304171979f,
+    -0.124732628f, -0.116215959f, 0.549929798f, 0.0867946222f, -0.115990959f, 0.766058028f, -0.58883214f, 0.0169468392f,
+    0.443326265f, 0.742990017f, -0.300742596f, 0.00799637195f, -0.103135653f, 0.783284366f, 0.532839954f, -0.605833352f,
+    0.841777265f, 0.885423899f, 0.490969151f, 0.523014843f, -0.16834113f, -0.0286985505f, 0.339437783f, -0.839103222f,
+    -0.563628137f, -0.813993752f, -0.926426709f, 0.733522236f, 0.633069396f, -0.469571859f, -0.0925226882f, 0.74773097f,
+    -0.16933468f, 0.372024477f, 0.341097862f, -0.45790872f, 0.0728732497f, -0.905564666f, 0.993649006f, 0.710723519f,
+    0.176966846f, 0.667169034f, 0.52183646f, -0.986214936f, -0.796559334f, 0.660508573f, 0.849273264f, -0.425789803f,
+    -0.818841755f, 0.886558592f, 0.514805079f, 0.308116347f, 0.270332783f, -0.785510182f, 0.0991943926f, -0.559037745f,
+    0.533361316f, 0.993229985f, 0.876911998f, 0.271447539f, 0.086418137f, -0.882098436f, 0.620017588f, -0.515484214f,
+    -0.430406392f, -0.281755f, 0.131262466f, 0.617046595f, 0.0986163691f, -0.574158907f, -0.0431543998f, -0.505931616f,
+    -0.233360246f, 0.343092829f, 0.71485126f, 0.391641617f, -0.164411336f, 0.39644891f, -0.342240393f, -0.827276647f,
+    -0.2375305f, -0.871827006f, 0.621404707f, -0.444972038f, 0.0457068533f, -0.99287045f, 0.369791925f, 0.765932202f,
+    0.173289433f, -0.454103589f, -0.786486328f, 0.628214657f, 0.644419312f, -0.431218266f, -0.391201198f, -0.563873112f,
+    0.588761449f, 0.00712876394f, 0.604020238f, 0.141696319f, 0.255727381f, -0.611780226f, -0.068387419f, -0.475609004f,
+    0.584399819f, 0.508395731f, 0.268524706f, 0.87265873f, -0.404001504f, -0.572960973f, -0.168257013f, -0.382412642f,
+    -0.116214134f, -0.919094741f, -0.671803057f, 0.474694908f, -0.744921863f, 0.444904f, -0.639891744f, -0.495158911f,
+    -0.490414739f, -0.722637296f, 0.878077745f, 0.723148942f, 0.0945204049f, -0.811513543f, 0.0203174688f, 0.0774351656f,
+    -0.217781946f, 0.092577748f, 0.273772776f, -0.259581685f, 0.405657977f, -0.330510437f, -0.411168307f, 0.886156499f,
+    -0.43446812f, 0.653988838f, -0.733187854f, 0.999281049f, 0.375692636f, -0.471527755f, 0.720331788f, 0.44824928f,
+    -0.0226539578f, -0.682913542f, 0.851787865f, -0.101896621f, -0.247236148f, 0.341807514f, -0.687195003f, 0.193434373f,
+    0.391471654f, -0.773478329f, 0.504649937f, -0.417215645f, 0.415108085f, 0.00681412918f, 0.0231402423f, -0.110080786f,
+    0.954421282f, 0.346550763f, -0.814260244f, -0.200487167f, 0.986387968f, 0.685273349f, -0.552292109f, 0.768559992f,
+    0.945521832f, 0.957125962f, 0.623263776f, -0.129395649f, -0.253296137f, 0.143080294f, -0.329871505f, 0.225929305f,
+    0.702869713f, -0.255396247f, -0.857582092f, -0.537996888f, 0.802218735f, 0.536809444f, -0.738372445f, 0.515037656f,
+    -0.0457298979f, 0.192874447f, -0.992015302f, -0.882109463f, -0.0667570382f, -0.459237784f, 0.135384664f, -0.73741734f,
+    -0.901493132f, 0.837155759f, 0.604795814f, -0.0743235722f, 0.159745634f, -0.136781856f, 0.681587815f, 0.727605224f,
+    -0.744104385f, 0.0238711704f, 0.558107674f, 0.616393149f, 0.897323012f, 0.971230149f, -0.916288257f, -0.438399941f,
+    0.742320776f, -0.55599004f, 0.365948707f, 0.564847529f, -0.136864558f, 0.576063514f, -0.980860591f, -0.91981703f,
+    0.0494362935f, -0.513292909f, -0.663506091f, 0.752842724f, 0.638307929f, 0.968371868f, 0.261209339f, -0.874128342f,
+    0.264176607f, -0.553896964f, 0.415481925f, -0.657258809f, -0.505915284f, -0.40344587f, 0.628885686f, 0.534136057f,
+    0.990670085f, 0.272433788f, -0.413920254f, -0.77404964f, 0.78398627f, 0.90552634f, -0.517014503f, 0.359198928f,
+    -0.368730605f, -0.500076175f, 0.790912271f, -0.103092276f, -0.166270584f, 0.543444395f, -0.493939221f, -0.834943295f,
+    0.849300444f, 0.901739776f, 0.326051295f, 0.965553939f, -0.505784035f, 0.253885835f, -0.876064003f, -0.946315408f,
+    -0.674136281f, 0.397573203f, -0.645031691f, 0.979391158f, -0.723722517f, 0.798686624f, 0.0617872253f, 0.730860949f,
+    0.969379127f, -0.276944995f, 0.137199149f, -0.746149361f, 0.0448953696f, -0.148066387f, 0.636312783f, 0.633830428f,
+    0.28120169f, 0.0883241147f, 0.960305214f, -0.227885678f, -0.861462295f, -0.963793039f, -0.717321992f, 0.906730413f,
+    0.740813136f, -0.52875787f, 0.844497144f, 0.776526988f, 0.577953339f, 0.9529199f, -0.525690556f, 0.711407185f,
+    0.820422351f, -0.724690497f, 0.769563079f, -0.00677219732f, -0.826404929f, 0.133089796f, -0.608605981f, 0.628558457f,
+    0.436178476f, -0.452592373f, 0.103225395f, 0.893647552f, 0.695272207f, 0.00960988272f, -0.479426086f, -0.712365627f,
+    0.733151913f, 0.933220804f, 0.69061923f, 0.779374599f, -0.92686516f, 0.97131151f, -0.0515514836f, -0.359478176f,
+    0.170106441f, -0.238761276f, 0.173342362f, -0.126419008f, 0.956361473f, 0.775639534f, -0.331217319f, -0.77248168f,
+    -0.866061568f, -0.156049296f, -0.184988692f, -0.0579135232f, -0.0567421876f, 0.628730118f, 0.17351006f, 0.564783871f,
+    0.804668605f, 0.285869867f, -0.163639277f, 0.788260996f, -0.0772705749f, 0.0604498275f, -0.78025353f, -0.342851937f,
+    -0.12229538f, 0.789713264f, 0.17844969f, 0.53785342f, -0.00783836748f, -0.779911041f, -0.544598877f, 0.739764631f,
+    0.760244966f, -0.0520639755f, -0.468473971f, 0.380244732f, -0.72793144f, 0.462622225f, -0.00204304f, 0.549695671f,
+    -0.0876538008f, 0.0309416633f, -0.458014369f, -0.344576091f, -0.19598332f, -0.767760217f, 0.920774698f, 0.909720242f,
+    -0.401944488f, 0.793824613f, 0.702788711f, 0.0275652669f, 0.233105972f, -0.983366847f, -0.793036461f, 0.53688556f,
+    -0.583019853f, 0.758975267f, 0.399509758f, -0.314740539f, -0.120952755f, -0.520959258f, -0.745182931f, 0.278887898f,
+    -0.358574003f, 0.647549331f, 0.682446539f, -0.292943329f, -0.37827915f, -0.430850208f, 0.408028126f, 0.551849842f,
+    0.138866603f, 0.935214639f, -0.817996204f, -0.75374651f, -0.279662251f, 0.200935438f, -0.630363762f, 0.816165805f,
+    0.231425926f, 0.120438576f, -0.925769389f, -0.0467853844f, -0.957912862f, 0.662881434f, 0.423221797f, -0.8426705f,
+    -0.202049851f, 0.143531397f, 0.0246026777f, -0.799024642f, 0.871917248f, -0.099056907f, 0.435325503f, -0.052338127f,
+    0.507321954f, 0.0646099597f, 0.574851334f, 0.379995137f, -0.13118495f, -0.231169641f, -0.469151437f, -0.642300725f,
+    -0.804803252f, -0.388559282f, 0.833236933f, 0.235048577f, -0.140218481f, 0.305912644f, -0.524420738f, -0.245051071f,
+    0.0692773014f, 0.818937778f, 0.796580017f, -0.457659721f, 0.547392786f, 0.964687645f, 0.927610159f, -0.539368331f,
+    0.42291081f, -0.97872591f, -0.214692503f, -0.453683555f, -0.963499606f, 0.31200093f, -0.313636363f, 0.962658167f,
+    -0.50500071f, -0.652070582f, -0.449094981f, 0.46682018f, -0.961004198f, -0.190585703f, 0.717497647f, 0.134952649f,
+    -0.523518205f, 0.69051522f, -0.618062377f, -0.445508868f, -0.887402952f, -0.167848095f, -0.342431635f, 0.360148549f,
+    0.526521921f, 0.0479813889f, 0.22341077f, 0.709272563f, -0.406678498f, -0.76225692f, -0.368198782f, -0.792212546f,
+    -0.320979387f, 0.328240931f, -0.368913978f, 0.48754549f, -0.272669792f, -0.119039334f, -0.106364027f, -0.641524553f,
+    -0.0742380694f, -0.604122758f, -0.978448153f, -0.371842384f, 0.742773652f, -0.41143924f, -0.602208257f, -0.0721676052f,
+    0.242876887f, -0.515582263f, -0.481676221f, 0.172581866f, 0.160690561f, -0.829854548f, -0.370716095f, -0.596821189f,
+    0.795583546f, -0.184431091f, 0.864884615f, -0.110097364f, -0.939744532f, 0.211624593f, 0.533329427f, -0.348198891f,
+    0.236905515f, -0.30963397f, -0.380393326f, -0.404226601f, -0.870443344f, 0.474631757f, -0.31592533f, -0.961787641f,
+    0.318064809f, -0.898418367f, 0.729984462f, -0.584677279f, 0.058996398f, 0.944705665f, 0.481043726f, 0.609724641f,
+    -0.689571083f, 0.897910237f, 0.061880745f, -0.322749734f, -0.869008839f, 0.135482147f, 0.663898468f, -0.0188563317f,
+    0.706958413f, -0.727744937f, 0.378981352f, 0.031434413f, 0.629910648f, 0.38902846f, 0.975567639f, -0.834746301f,
+    0.243576661f, -0.926611423f, 0.820146263f, -0.604088247f, 0.0388307944f, -0.950983107f, 0.316898197f, 0.610005438f,
+    0.738445878f, -0.218482926f, -0.62723279f, -0.828207433f, -0.791611373f, 0.537774324f, -0.73114419f, -0.963923037f,
+    -0.159212425f, -0.571643114f, 0.594184101f, -0.184362918f, -0.850356698f, 0.792369068f, 0.19296132f, -0.353248119f,
+    0.0901852101f, 0.75418824f, -0.409142166f, 0.395122081f, 0.353487879f, 0.633235991f, 0.954686105f, 0.165273204f,
+    -0.44771418f, -0.908104181f, -0.93629384f, 0.529157341f, -0.481411308f, 0.198663339f, -0.361880302f, 0.588850856f,
+    -0.569198012f, -0.162126675f, -0.607264876f, -0.704186618f, -0.097674422f, 0.046723634f, 0.294070482f, -0.507350147f,
+    -0.72977531f, 0.13255623f, -0.965186477f, -0.0470923483f, -0.20190002f, 0.167722091f, 0.304786563f, -0.51128912f,
+    0.393353343f, -0.244966581f, 0.173912033f, -0.902341604f, -0.294928849f, -0.729226053f, 0.395809203f, -0.337151885f,
+    -0.892585516f, -0.863772154f, 0.953861117f, 0.0180818085f, -0.107529998f, 0.129742786f, -0.515094399f, -0.790097415f,
+    0.529881954f, 0.756784081f, 0.562621295f, 0.708811224f, -0.0403210707f, 0.742703319f, -0.0627764463f, 0.486072451f,
+    0.0725042671f, 0.182144195f, 0.330099344f, -0.854009748f, -0.0751713961f, 0.492610276f, -0.778309464f, -0.843773901f,
+    0.888636351f, 0.308110058f, 0.854011357f, -0.78641516f, -0.937852204f, 0.832072079f, -0.912447929f, 0.463219762f,
+    0.693052351f, 0.413215309f, -0.723158836f, -0.867401898f, -0.554997265f, -0.335089803f, 0.111182421f, -0.690555453f,
+    -0.490390867f, -0.613478303f, -0.223819658f, 0.555480182f, -0.816270232f, -0.175847203f, -0.361416698f, -0.422705591f,
+    0.0182826892f, 0.647481441f, 0.830489337f, 0.883322835f, -0.339756787f, 0.572948515f, 0.52569592f, 0.718373597f,
+    0.961720824f, -0.185937718f, -0.392693043f, 0.127956077f, -0.661383271f, 0.688065588f, -0.347324401f, -0.973416567f,
+    -0.0831752494f, 0.203909427f, 0.20210427f, 0.0383715332f, 0.0181803014f, -0.683364093f, 0.462674588f, -0.988863468f,
+    0.418435127f, -0.105654866f, -0.944986284f, 0.62642163f, -0.621398687f, 0.668504596f, 0.562781751f, 0.165990561f,
+    0.397496045f, -0.684066713f, 0.492598176f, 0.904165387f, -0.388344228f, -0.04901601f, -0.577902436f, 0.685310066f,
+    0.301896572f, 0.390514642f, 0.947501063f, 0.0365339927f, 0.052231241f, -0.751359105f, -0.864192069f, 0.841600657f,
+    0.0145761063f, -0.450681508f, 0.112256654f, 0.0701152012f, 0.438335598f, -0.876692653f, 0.0352489538f, 0.644203842f,
+    0.501667917f, -0.118792132f, 0.816030562f, -0.574044347f, 0.589121521f, 0.528321564f, -0.577948451f, 0.190837801f,
+    -0.290204436f, -0.496764034f, 0.272538871f, 0.391721696f, 0.708164215f, -0.975490391f, -0.583881855f, -0.308382362f,
+    0.332672477f, 0.408333093f, 0.361724108f, 0.480710596f, 0.0497366413f, 0.481326789f, 0.640576363f, 0.662648141f,
+    0.891652584f, -0.93494463f, 0.892588019f, 0.94741267f, 0.00383764575f, -0.0372080058f, 0.427558005f, 0.887285769f,
+    -0.411062419f, 0.218799651f, 0.329127878f, -0.592380643f, 0.538493633f, 0.824456394f, -0.209776551f, -0.778062344f,
+    -0.829524517f, -0.518265903f, 0.67598784f, -0.322860897f, -0.775325537f, -0.520315349f, -0.809429407f, 0.878025591f,
+    -0.302041322f, -0.856258929f, -0.699012458f, -0.0472061634f, 0.320761442f, 0.869651914f, 0.113101192f, 0.531036973f,
+    -0.90731883f, -0.46392101f, 0.129238233f, 0.889660776f, -0.956383884f, -0.432844579f, -0.939518929f, -0.913619578f,
+    -0.533515632f, 0.440634787f, -0.260443479f, 0.748636782f, -0.301034123f, 0.143715322f, 0.554946482f, 0.160407394f,
+    0.508273542f, 0.237669349f, -0.51179105f, -0.296864927f, -0.22325471f, -0.153499469f, -0.772993386f, -0.00552653102f,
+    0.71555841f, 0.0354456976f, -0.240785658f, -0.747694254f, -0.830037475f, -0.517150998f, 0.643567622f, -0.481781214f,
+    -0.59093827f, -0.522542238f, 0.981521368f, 0.75879091f, -0.261262566f, 0.590559483f, -0.959730446f, -0.59480387f,
+    0.0777308494f, -0.208942324f, 0.474718153f, 0.714748204f, -0.0140179405f, -0.628202617f, 0.918856263f, 0.918943346f,
+    -0.669739902f, 0.765721202f, -0.792259157f, -0.216562495f, -0.244447827f, -0.603353083f, -0.397924334f, 0.0563938692f,
+    0.781996965f, -0.465615213f, 0.705145299f, -0.521843553f, -0.313185424f, -0.639759243f, 0.763731897f, -0.237269163f,
+    0.949344754f, 0.477426827f, -0.0227565374f, -0.288157821f, -0.966253877f, 0.230418637f, 0.876510799f, -0.0402908511f,
+    0.0105728544f, 0.298281968f, -0.126351669f, -0.964827478f, 0.429009438f, 0.807483852f, 0.104093447f, 0.605229974f,
+    -0.425374001f, -0.713410318f, 0.863278508f, 0.148881078f, 0.937846899f, -0.290617734f, 0.3189511f, 0.572213709f,
+    0.874651909f, 0.0641301349f, 0.818163633f, 0.470886469f, -0.973579526f, 0.762580395f, 0.357931882f, -0.708501279f,
+    -0.227345496f, -0.174689814f, 0.0225337073f, 0.780803919f, 0.736986816f, -0.930984259f, -0.343175054f, 0.410672456f,
+    0.089764297f, -0.907482147f, 0.0647113621f, 0.0266132597f, 0.922001958f, -0.760204196f, -0.8812536f, -0.196267396f,
+    -0.691447258f, -0.551158309f, 0.0110344309f, -0.528599441f, -0.102128752f, 0.416987747f, 0.892473221f, -0.949648321f,
+    0.967106342f, 0.487536192f, 0.411815882f, 0.287840992f, 0.943790317f, 0.964594066f, 0.970538318f, 0.853570521f,
+    -0.347790062f, 0.358750165f, -0.539646089f, 0.166219696f, -0.835371077f, 0.255126297f, -0.79337728f, 0.0186930001f,
+    -0.317840517f, 0.0167341586f, -0.545495927f, 0.126069769f, -0.645747662f, -0.0120239165f, -0.0942945108f, -0.477246732f,
+    -0.395076632f, 0.0313027687f, -0.909327865f, -0.885109603f, 0.340726733f, 0.474419594f, -0.085708715f, 0.502483547f,
+    0.48474443f, 0.231780708f, -0.944280446f, -0.0671729743f, -0.0440643243f, 0.104148015f, 0.758854747f, 0.338025838f,
+    -0.685434461f, -0.20548445f, 0.961143732f, -0.626903594f, -0.766262472f, 0.746314228f, -0.780745149f, 0.483445495f,
+    -0.705345154f, -0.209633023f, 0.530741632f, -0.505647421f, 0.218502402f, 0.348585099f, 0.0794374868f, 0.809483945f,
+    0.568617821f, 0.325987369f, 0.447780728f, -0.947020948f, -0.255647779f, -0.0678251609f, 0.499694914f, -0.81651783f,
+    0.485728115f, 0.212490231f, -0.38209492f, -0.853791654f, -0.839128017f, -0.640457869f, 0.382407486f, 0.561263084f,
+    0.504843295f, 0.457715213f, 0.19972159f, -0.417604506f, 0.284243733f, -0.459821433f, 0.348012239f, 0.227191612f,
+    -0.137363598f, -0.612092674f, -0.016989084f, -0.894729912f, 0.293910921f, 0.192748427f, -0.871802509f, 0.451443166f,
+    -0.374972284f, -0.695005834f, -0.687179983f, -0.773636878f, -0.498450547f, -0.12446361f, -0.613079786f, 0.870885193f,
+    0.497058034f, -0.486691713f, -0.302264005f, 0.770365f, 0.929656744f, -0.834181845f, -0.97644943f, -0.959505677f,
+    0.0237474348f, 0.769950211f, 0.571592867f, 0.505760312f, 0.785944641f, -0.6124897f, -0.0542552508f, -0.0201597847f,
+    0.550624907f, -0.923424125f, -0.156163499f, 0.746740818f, -0.200314462f, -0.374109536f, -0.97824651f, 0.6609236f,
+    0.912692904f, -0.586186707f, 0.418094456f, 0.838325143f, 0.765708089f, -0.121375218f, 0.349444896f, 0.680002391f,
+    -0.282392651f, 0.596992016f, -0.0805049241f, -0.289475739f, -0.368653744f, 0.268077582f, -0.290495694f, 0.441960931f,
+    0.998757064f, 0.24011296f, 0.840097368f, -0.0426594354f, 0.514050543f, -0.67016387f, -0.210017219f, 0.659759581f,
+    -0.12475729f, 0.382154346f, 0.822265327f, 0.197176665f, -0.295939326f, 0.888064504f, 0.393053353f, 0.38149327f,
+    0.0424769111f, 0.197602808f, 0.672418058f, 0.654453397f, 0.766180515f, 0.453585863f, -0.213096365f, -0.882559121f,
+    -0.531292081f, -0.702677727f, -0.636981606f, 0.572142899f, 0.579515874f, 0.82449609f, 0.1754473f, 0.456847996f,
+    0.197243124f, -0.87761271f, 0.481424421f, -0.0384425856f, -0.0475087948f, -0.408878148f, -0.456172615f, -0.277868122f,
+    0.321532845f, -0.535531819f, 0.578025937f, -0.44572708f, 0.767112434f, -0.601025462f, -0.237703338f, -0.959273338f,
+    -0.0165832974f, -0.819796979f, -0.399508804f, 0.359579086f, 0.93148756f, -0.129916161f, -0.520134807f, 0.388057381f,
+    0.560626686f, 0.837813556f, -0.455100954f, -0.0234506782f, 0.490367353f, 0.38188684f, 0.723094225f, -0.629555285f,
+    0.205216259f, -0.0793583095f, 0.588831604f, 0.403421789f, -0.252389371f, -0.927128255f, -0.558844805f, -0.347320974f,
+    -0.716474414f, -0.416675538f, -0.619291306f, 0.616816282f, 0.2844778f, 0.966896355f, 0.827109277f, 0.24590297f,
+    -0.5627864f, 0.891889334f, -0.127509058f, -0.241328746f, 0.465012044f, 0.335250318f, -0.6842677f, 0.71603477f,
+    -0.347384095f, 0.702540517f, -0.0408657342f, 0.299710959f, 0.863674402f, -0.648843765f, 0.558896005f, 0.26927036f,
+    0.0971554518f, 0.51291734f, -0.386245936f, -0.00739551103f, -0.880502105f, -0.734635711f, -0.157223031f, -0.0991849825f,
+    -0.238597631f, -0.749238789f, -0.222087711f, 0.853627264f, 0.519771695f, 0.881501317f, -0.689990103f, -0.373754412f,
+    -0.672122419f, -0.956836283f, -0.612975299f, -0.953225672f, 0.416560918f, 0.977054954f, 0.270800829f, 0.788076162f,
+    0.642032802f, 0.650505722f, -0.0101766372f, 0.632623076f, 0.0586522631f, 0.375689387f, 0.185021162f, 0.547658324f,
+    0.812289119f, 0.287118286f, -0.964215994f, 0.296501428f, 0.719897389f, -0.317396194f, -0.121776864f, 0.171517953f,
+    0.133243725f, 0.798505723f, -0.00184935122f, 0.18646507f, 0.0781540573f, -0.503548145f, 0.370187461f, 0.793208003f,
+    0.12359792f, 0.367843449f, 0.789450109f, -0.945341349f, -0.28725943f, 0.851574063f, 0.781435668f, 0.0785172507f,
+    -0.665223062f, -0.0970144868f, 0.079486914f, -0.96422106f, -0.595459461f, 0.838936687f, -0.0752582029f, -0.3740004f,
+    -0.731370032f, -0.361371428f, 0.557795405f, -0.593156576f, 0.726760626f, -0.861115754f, -0.692466378f, -0.998009682f,
+    -0.917874396f, 0.832189679f, 0.662857711f, -0.731312573f, 0.413268685f, 0.863631368f, -0.345397115f, -0.119561985f,
+    0.848751724f, -0.759875655f, -0.579510331f, -0.116924241f, 0.669000089f, 0.520360529f, -0.0120788282f, -0.37392801f,
+    0.348392546f, -0.431486279f, -0.765203774f, 0.693629861f, -0.889256954f, 0.882189691f, 0.522487521f, 0.52652204f,
+    0.715164602f, -0.98695296f, -0.950340033f, -0.241561115f, -0.756020248f, 0.144705266f, 0.706607163f, -0.189224482f,
+    0.451917678f, -0.965856433f, 0.954330802f, 0.465920568f, 0.746899843f, 0.813309491f, -0.645000696f, -0.338906884f,
+    0.436245114f, -0.30368498f, -0.146013647f, 0.898547947f, -0.599006057f, 0.338968843f, 0.493611902f, 0.796957433f,
+    0.0356049128f, -0.283574879f, -0.448166907f, 0.516243517f, 0.0230812598f, 0.31914559f, -0.363591313f, -0.564138055f,
+    -0.0367109179f, -0.462900072f, 0.810649753f, 0.115423739f, -0.38573128f, -0.294788182f, -0.937785327f, -0.196442381f,
+    -0.361577392f, 0.25602141f, -0.812244892f, -0.867854178f, 0.844763696f, -0.395937324f, 0.34504509f, 0.691099703f,
+    0.454117119f, 0.332181662f, 0.197453499f, 0.700419426f, -0.288907558f, -0.563715398f, -0.629503787f, -0.343209714f,
+    0.747809112f, 0.728465796f, -0.759591281f, -0.556944072f, -0.0918326303f, -0.965761721f, 0.248858511f, 0.927257121f,
+    0.296630204f, -0.477325529f, -0.555534542f, -0.820227921f, 0.713875234f, 0.231095806f, 0.0894799232f, -0.339406252f,
+    0.438021898f, -0.434473634f, 0.667712033f, 0.762821019f, 0.899427056f, 0.598530948f, -0.987337112f, 0.953730047f,
+    -0.668564677f, -0.582167506f, -0.879591286f, 0.748186052f, 0.275482059f, -0.746580243f, -0.644115031f, -0.466580123f,
+    0.817724824f, 0.383711398f, 0.144788221f, 0.77985698f, -0.195061281f, -0.557287693f, -0.65175426f, 0.372704446f,
+    0.462990522f, -0.021540286f, 0.112873957f, -0.604803979f, -0.631851375f, -0.421806723f, 0.379015058f, 0.127590626f,
+    0.493641168f, 0.917839348f, -0.266978174f, 0.653672218f, 0.730813563f, 0.741445661f, -0.300565928f, -0.735852838f,
+    0.989381731f, -0.824765384f, -0.262787044f, -0.020925479f, 0.621828973f, -0.648151815f, -0.228969038f, -0.816479683f,
+    0.488827169f, 0.858390152f, 0.697255015f, 0.951090991f, 0.775987208f, -0.328726918f, 0.798612356f, -0.930422127f,
+    -0.995013654f, -0.564669371f, -0.330897212f, 0.983531058f, 0.304843307f, 0.742814958f, 0.224866495f, -0.611099541f,
+    -0.864060163f, 0.772907019f, 0.255422264f, 0.181259111f, 0.866953969f, -0.894273281f, -0.0446880795f, -0.297402769f,
+    0.608472109f, 0.582031846f, -0.696724892f, 0.0422129519f, 0.845708549f, -0.215023637f, -0.676006436f, -0.312213272f,
+    0.0392698571f, -0.726842523f, -0.218341812f, -0.406379193f, -0.828574061f, 0.455222934f, -0.67930162f, -0.658512354f,
+    -0.250337303f, 0.0923612267f, -0.493415117f, -0.429659009f, -0.795464694f, -0.521065712f, -0.0800494999f, -0.154278263f,
+    0.628677189f, -0.513360679f, -0.336458117f, 0.845965207f, 0.668946445f, 0.901131749f, -0.282802016f, -0.0764414296f,
+    -0.962181866f, -0.731869102f, 0.200623378f, 0.0679629445f, -0.42819345f, 0.259867936f, -0.204171389f, 0.711330235f,
+    0.564201772f, 0.596504152f, -0.313936681f, 0.636107564f, -0.0614447631f, -0.0584229119f, 0.598977268f, -0.394626349f,
+    0.991413534f, 0.128058106f, 0.170377642f, -0.730844319f, -0.546019077f, -0.277372032f, 0.413565934f, 0.809156418f,
+    0.407479554f, 0.465434194f, -0.904983103f, 0.594128311f, -0.161136568f, -0.998313963f, -0.468699992f, 0.527189732f,
+    0.32572782f, -0.91383183f, 0.389834315f, 0.166772828f, -0.629959702f, -0.514421523f, 0.790819049f, -0.384767562f,
+    -0.876988351f, -0.599072039f, 0.300260812f, -0.635353744f, -0.540180504f, 0.104491487f, -0.135939613f, 0.779312849f,
+    0.585175931f, 0.652651072f, -0.605643928f, -0.620792449f, 0.925411582f, 0.23968789f, 0.111383282f, -0.617569745f,
+    0.202135876f, -0.914340675f, -0.563568175f, 0.441271722f, 0.26982525f, 0.75620687f, 0.119996242f, -0.272405654f,
+    -0.269312352f, -0.53771925f, 0.603812635f, 0.340991437f, 0.797756791f, -0.651580215f, 0.105656251f, 0.793784797f,
+    -0.851510346f, 0.197822601f, -0.0391182639f, -0.980865836f, -0.160874739f, -0.510136545f, 0.303413421f, -0.216812879f,
+    -0.586280406f, 0.967347026f, -0.518861771f, 0.974332511f, -0.000972387439f, -0.329134405f, -0.902854085f, 0.445839286f,
+    -0.0726936534f, -0.028434271f, 0.568062067f, -0.0958329961f, -0.168831155f, -0.897712946f, 0.968916178f, -0.943166614f,
+    -0.157980457f, -0.981773198f, -0.063832894f, -0.961188078f, 0.0125513142f, -0.95804143f, 0.277814478f, 0.115423828f,
+    -0.0765057206f, 0.0133538265f, 0.584023893f, 0.570370078f, -0.686606348f, 0.330173045f, -0.14127633f, -0.741737783f,
+    -0.793622673f, 0.73915565f, 0.25626111f, -0.909221768f, 0.654280066f, -0.51407373f, -0.0897934288f, 0.646645665f,
+    0.338933617f, 0.548404455f, 0.927705944f, 0.408821911f, 0.774556696f, -0.13015388f, -0.316740274f, 0.468613714f,
+    0.183367372f, 0.189406827f, -0.657264173f, 0.419875681f, 0.0610156544f, 0.113534115f, 0.0783828273f, -0.428725958f,
+    0.399276167f, -0.865175426f, 0.560666084f, 0.304732352f, 0.227054909f, 0.00273699081f, -0.686514974f, 0.723414421f,
+    0.340854347f, 0.0432329513f, 0.43571344f, -0.824840963f, 0.0347505435f, 0.0979051813f, -0.202503592f, 0.87403363f,
+    -0.815786123f, -0.181699544f, 0.927011847f, 0.532576084f, -0.0839882493f, 0.859590173f, -0.733675599f, -0.767593145f,
+    0.846323371f, 0.0197331607f, 0.977022946f, -0.0261247102f, -0.232390583f, -0.891776383f, 0.299761564f, -0.71722436f,
+    -0.0167775918f, -0.852013409f, -0.959697723f, -0.318148345f, 0.520284414f, -0.0934357941f, 0.535922766f, 0.133522198f,
+    0.229507715f, 0.0237815976f, 0.0940349251f, 0.708517849f, -0.277593821f, 0.862361133f, -0.0782123357f, 0.0601152182f,
+    0.109329037f, -0.809397221f, -0.570294261f, 0.928050697f, -0.183459863f, 0.199059546f, -0.766416728f, 0.414396018f,
+    -0.173073083f, 0.413989186f, -0.259444118f, 0.574009418f, -0.488568813f, 0.809079468f, 0.140093252f, -0.494739324f,
+    -0.994647324f, 0.406249493f, -0.973122537f, -0.943387449f, 0.374062717f, 0.975371301f, -0.414584994f, 0.588976502f,
+    0.332660735f, 0.590377927f, 0.568968713f, -0.284345329f, 0.810334623f, -0.389848024f, -0.822008967f, -0.798292279f,
+    0.01934845f, -0.685876131f, -0.663571775f, -0.451106042f, 0.713146925f, -0.576895654f, 0.0194388554f, -0.494759589f,
+    -0.309979886f, -0.631809533f, 0.645139039f, 0.00323262019f, 0.329057038f, 0.263788402f, 0.239334449f, 0.85546577f,
+    -0.650483131f, 0.0559434369f, 0.70331943f, 0.472718328f, 0.0588875934f, 0.688681126f, 0.92915988f, 0.984122157f,
+    -0.755051613f, 0.994736433f, 0.544649839f, 0.89578265f, 0.208061218f, 0.398384899f, 0.543498635f, 0.0196492411f,
+    -0.333530486f, -0.327162921f, -0.209388033f, -0.391698033f, -0.186051905f, -0.157079443f, -0.458846331f, -0.772089243f,
+    0.0793412924f, -0.0989780352f, -0.405750751f, 0.954841435f, 0.896802604f, -0.526033461f, -0.492630541f, 0.023985358f,
+    -0.546046317f, 0.0854858831f, -0.436838359f, 0.582751811f, -0.675198495f, -0.468149185f, 0.135785669f, -0.3938936f,
+    0.524494529f, -0.435053557f, -0.678970754f, 0.959833145f, 0.921473086f, -0.606144428f, -0.744098723f, -0.390780658f,
+    0.701885343f, 0.707977772f, 0.591930747f, 0.889813483f, 0.4019337f, 0.321664065f, -0.904089034f, -0.152678937f,
+    0.00792493951f, -0.830515921f, -0.813313186f, -0.635936499f, -0.136345416f, -0.680556953f, 0.535139084f, 0.624764979f,
+    -0.243302196f, -0.80149883f, -0.572362959f, -0.924512565f, -0.291677684f, -0.56137079f, -0.0602614954f, -0.807829797f,
+    -0.191012874f, -0.244351134f, 0.73920989f, -0.235231146f, -0.729665101f, -0.946503997f, 0.0104920454f, 0.61555928f,
+    -0.335876882f, 0.570517361f, -0.317655891f, 0.215424821f, 0.399356097f, 0.191192985f, 0.320095718f, 0.374098122f,
+    0.36372149f, 0.706408143f, -0.0292854942f, 0.874221921f, 0.292664707f, 0.756974518f, 0.808495462f, 0.101102471f,
+    0.122317322f, 0.986708343f, 0.913933456f, 0.493660748f, 0.880233765f, 0.330595255f, 0.66795361f, -0.128764585f,
+    0.291031539f, -0.921035171f, -0.69648248f, 0.785240948f, -0.309140801f, -0.599648714f, 0.58672893f, -0.958169341f,
+    0.149865597f, -0.745510638f, 0.968078494f, 0.873736978f, -0.845318139f, -0.722928822f, -0.482202947f, -0.765681624f,
+    -0.273467779f, -0.925666451f, 0.592833519f, -0.986373067f, 0.97305882f, 0.192564443f, 0.724380612f, -0.447523355f,
+    0.00418627262f, -0.575111508f, -0.99842155f, 0.960285127f, 0.0358754732f, 0.68314296f, 0.838794053f, -0.723918557f,
+    0.360364288f, -0.730458796f, 0.926121473f, 0.319919795f, 0.4562518f, -0.65590179f, -0.887498736f, 0.763533056f,
+    0.944559276f, 0.730258346f, 0.687652349f, 0.0290686004f, -0.287683427f, 0.876143932f, -0.8830266f, 0.0372436047f,
+    -0.476455867f, 0.400245517f, -0.340289354f, -0.933630168f, 0.845341027f, -0.488087535f, 0.235598072f, -0.400402874f,
+    0.317395687f, 0.0808961317f, 0.810119867f, -0.985973775f, 0.0039199586f, 0.330193847f, -0.429257184f, -0.609486699f,
+    0.858806729f, 0.294250131f, -0.623385608f, 0.417573154f, -0.494327366f, 0.969330192f, 0.461490571f, 0.802483618f,
+    0.811632454f, -0.980579853f, -0.109858848f, -0.689738572f, -0.424058974f, 0.315837562f, 0.952114642f, -0.231096953f,
+    0.48133707f, 0.249328703f, -0.145391151f, -0.858156979f, 0.0644973963f, -0.165104851f, -0.985320926f, 0.271185607f,
+    -0.678603828f, 0.16540347f, 0.982684314f, -0.503644586f, -0.145946637f, 0.359606355f, 0.445242405f, 0.838794887f,
+    -0.963796377f, 0.929908574f, 0.811811686f, 0.263711125f, 0.999688089f, -0.084433198f, 0.983123243f, 0.631226778f,
+    -0.42215997f, 0.851178169f, -0.668274581f, -0.848860919f, 0.454130858f, 0.567256033f, -0.480190039f, 0.884623647f,
+    -0.206681788f, 0.869606018f, -0.218754441f, 0.418200731f, -0.995265365f, -0.362691134f, 0.246291935f, -0.485400021f,
+    0.541058898f, 0.139685258f, -0.330105126f, 0.935792446f, -0.0486074053f, 0.690091789f, -0.1234506f, 0.0947591141f,
+    0.0309615042f, -0.275288433f, -0.909166396f, -0.3490569f, -0.476029187f, 0.661483526f, -0.042561166f, -0.147237077f,
+    -0.203268483f, 0.0406903476f, 0.984047651f, -0.995803773f, -0.230051771f, -0.803599358f, 0.887594759f, 0.0653030872f,
+    0.953576505f, 0.687155664f, -0.0703750923f, 0.316856802f, -0.616565049f, -0.00625968073f, -0.675767601f, 0.163254291f,
+    -0.232392728f, 0.0193210207f, 0.885374546f, -0.962098837f, -0.461664975f, 0.378587574f, -0.733227849f, 0.68528235f,
+    0.756855667f, 0.721501529f, 0.623920441f, 0.788327396f, -0.640160441f, 0.115487784f, 0.680073559f, 0.638604045f,
+    0.340354919f, 0.242996842f, -0.44381994f, -0.777116835f, 0.483228326f, 0.787790596f, -0.670607686f, -0.0738524795f,
+    0.430663228f, 0.0119836796f, 0.190088734f, -0.864249825f, 0.208190203f, -0.414188921f, -0.751327693f, -0.703966677f,
+    0.0347036384f, -0.322715819f, 0.0880381912f, 0.810020745f, -0.507445693f, -0.635437965f, -0.887911856f, -0.7294662f,
+    -0.397783041f, 0.0486229658f, -0.222331926f, -0.68517828f, 0.826048613f, 0.379787266f, 0.68473947f, 0.225513563f,
+    -0.255939245f, 0.465846717f, 0.176121652f, 0.491302907f, 0.794166625f, -0.11208763f, 0.927518249f, -0.212785184f,
+    0.523409665f, 0.271882087f, 0.740801036f, -0.997877538f, -0.0968939587f, 0.810806513f, 0.358695209f, 0.230383366f,
+    0.48543945f, -0.0483827069f, 0.832774043f, 0.656999707f, 0.931163192f, -0.312952816f, 0.429294765f, 0.500803769f,
+    -0.59658581f, -0.92261225f, 0.660395265f, 0.964768946f, -0.882460833f, 0.81803298f, -0.267646402f, -0.80205816f,
+    -0.718459606f, 0.271958619f, -0.973519206f, -0.156789169f, -0.873295605f, 0.598519325f, -0.950765133f, -0.869970918f,
+    -0.364961863f, -0.744134188f, -0.188782647f, -0.20743522f, -0.00957804359f, 0.896018863f, -0.960743606f, -0.893445969f,
+    -0.747057199f, -0.27316007f, 0.491498441f, 0.924656808f, 0.091647245f, 0.0131267179f, 0.929442585f, -0.238298073f,
+    0.129627705f, 0.604977429f, 0.0610761307f, 0.418980658f, -0.916783512f, 0.619203269f, 0.139030054f, -0.889453888f,
+    0.0848369449f, 0.811013699f, 0.661089122f, 0.0496072732f, -0.113715969f, 0.682757378f, 0.227103502f, 0.790685773f,
+    -0.240141332f, 0.889761508f, 0.930916488f, 0.422175467f, 0.0663766712f, -0.331012756f, -0.789613485f, -0.296050519f,
+    0.509762049f, -0.254772812f, -0.99252522f, -0.761311412f, -0.791805148f, -0.0743412375f, 0.626912177f, -0.824085772f,
+    -0.137072131f, 0.677694917f, -0.607809842f, -0.237567618f, 0.0107013714f, -0.902578592f, -0.564847589f, -0.480719537f,
+    -0.0443582609f, 0.949949682f, -0.455176622f, 0.13468796f, -0.679025054f, -0.17931518f, 0.48941499f, 0.594990313f,
+    -0.874245763f, -0.629151821f, -0.0419819243f, -0.811179399f, 0.293556303f, 0.450961202f, 0.958331048f, 0.135115296f,
+    -0.931502283f, 0.010827831f, -0.626737773f, 0.00904260483f, 0.878225327f, 0.420562357f, 0.717874467f, 0.719993532f,
+    0.689787269f, -0.029829368f, 0.804064274f, 0.314671397f, -0.688953757f, 0.866372347f, -0.365073174f, -0.388798118f,
+    -0.401819348f, 0.0812993124f, -0.519102633f, -0.893510282f, -0.788425326f, -0.606818974f, 0.0934772342f, 0.0104740048f,
+    -0.198953733f, 0.743487656f, 0.756062806f, 0.624387443f, -0.222042158f, -0.350681037f, -0.237450123f, 0.512603223f,
+    0.420824021f, -0.0809026584f, -0.323026955f, -0.0132541582f, -0.266164601f, 0.379851162f, 0.194935068f, -0.58820504f,
+    0.204281732f, 0.844964981f, 0.00698708463f, -0.522512317f, -0.940978765f, 0.545685649f, 0.93570292f, 0.609831572f,
+    0.27178815f, -0.572959244f, 0.66776371f, -0.930747747f, 0.471341848f, -0.824244797f, 0.181205317f, -0.0646043718f,
+    0.238907799f, -0.865770519f, -0.524238527f, 0.868677676f, 0.450525373f, -0.483643323f, -0.115838483f, 0.945019186f,
+    0.238633916f, -0.152862996f, -0.112415895f, 0.626622319f, -0.475971878f, -0.982009232f, 0.557154775f, -0.348094493f,
+    0.587128043f, 0.420523733f, -0.845898569f, 0.145924062f, 0.322792113f, 0.814928234f, 0.927976072f, -0.0934009552f,
+    -0.675688326f, -0.178815916f, -0.309561908f, 0.220853344f, 0.0792573169f, -0.542370856f, -0.487104654f, 0.840388834f,
+    -0.285649717f, -0.994892895f, -0.614787996f, -0.409774303f, -0.605846405f, 0.162055641f, -0.492010921f, -0.0119229145f,
+    0.703701377f, -0.946604908f, -0.243562147f, 0.315971881f, 0.795276463f, -0.130679548f, 0.979872823f, -0.895401061f,
+    0.572708368f, 0.469762534f, 0.295897186f, -0.393555969f, 0.52203691f, 0.256264597f, 0.851665199f, 0.0329493247f,
+    0.0986685604f, -0.62828511f, 0.345020682f, -0.946283579f, -0.557560384f, 0.833149791f, 0.0378715508f, 0.337395549f,
+    0.0462648496f, 0.366749793f, -0.567053378f, 0.963154793f, -0.249703288f, 0.114517599f, -0.111568451f, -0.713066638f,
+    -0.672661185f, 0.153370291f, -0.795316756f, -0.269960314f, 0.590343893f, 0.340230078f, -0.468922377f, -0.0209295843f,
+    -0.554410934f, 0.0932979658f, 0.591474414f, -0.978782356f, -0.309378326f, 0.513493896f, 0.626815259f, 0.877242863f,
+    -0.522495091f, 0.768807411f, 0.844587684f, -0.558657527f, -0.352855474f, 0.910196066f, -0.0581336617f, -0.502734661f,
+    0.856989503f, 0.875364423f, 0.218674585f, -0.31700632f, -0.687712014f, -0.236230329f, -0.425624758f, 0.650988638f,
+    0.884760797f, 0.419701636f, -0.986083031f, 0.258304179f, -0.00540351123f, -0.268216938f, -0.691272378f, -0.309247673f,
+    0.287760079f, 0.511247039f, 0.0562671833f, 0.770263851f, -0.925090611f, 0.541610658f, 0.824154258f, 0.67053014f,
+    0.0559309945f, -0.303034186f, -0.0842062607f, -0.640288353f, 0.204578459f, -0.814612448f, 0.84407568f, 0.366733015f,
+    0.214574903f, -0.379099429f, 0.299395531f, -0.451223135f, -0.793423355f, 0.454598963f, -0.919104099f, -0.228228092f,
+    -0.0173384063f, 0.255105704f, -0.238973439f, -0.818420231f, 0.555731714f, 0.990470827f, 0.573488653f, -0.897161126f,
+    -0.290472299f, -0.767528057f, -0.250011235f, 0.746572971f, -0.696230114f, -0.541932523f, 0.00905397721f, 0.728190601f,
+    -0.566022038f, -0.968044519f, -0.456715494f, -0.635914624f, 0.967287481f, -0.0797909796f, 0.690346301f, -0.502330422f,
+    -0.429707795f, -0.380382597f, -0.811740875f, -0.037068449f, -0.777932107f, -0.244214982f, 0.641406834f, 0.155141056f,
+    -0.973615527f, -0.0482299961f, 0.0866265893f, -0.451870769f, -0.206296802f, 0.40812704f, 0.360125363f, -0.535255492f,
+    0.741923332f, 0.752739906f, -0.96354562f, 0.180846676f, -0.96143657f, 0.809654355f, 0.362565339f, 0.0413107425f,
+    -0.438532948f, -0.376139134f, 0.0147575233f, 0.198548064f, 0.475925803f, -0.308537126f, -0.208212659f, 0.983289719f,
+    -0.419591725f, -0.547723353f, -0.804986894f, -0.487331808f, 0.26109764f, -0.995601833f, -0.522446156f, -0.461072326f,
+    -0.267284244f, -0.0735494271f, -0.709898055f, -0.661315024f, -0.0182518922f, 0.498871952f, -0.0371952914f, 0.482714087f,
+    -0.425385833f, 0.368811399f, -0.992101014f, 0.671032608f, 0.311988384f, 0.878957748f, 0.400664598f, -0.0852854326f,
+    0.871225715f, 0.311400265f, 0.293557197f, -0.143827975f, 0.0534513332f, -0.738215387f, -0.338476241f, 0.510470033f,
+    -0.807838619f, 0.103598975f, -0.799057245f, 0.520021796f, -0.922115922f, -0.214191392f, -0.691908181f, -0.236530438f,
+    0.714178264f, -0.193078429f, 0.0354060717f, 0.00788488798f, -0.329349279f, -0.288300604f, -0.353087902f, 0.825873613f,
+    -0.933992565f, -0.908212006f, -0.349285841f, 0.0403016433f, 0.750407696f, 0.724123716f, -0.740800858f, -0.982180893f,
+    0.289147139f, -0.14521268f, 0.435312122f, -0.874537349f, -0.644479573f, -0.85177958f, 0.53147155f, 0.402760416f,
+    -0.429728657f, 0.232837647f, 0.639251173f, -0.115355693f, -0.837997615f, 0.910392523f, -0.668595076f, -0.895176589f,
+    -0.313024163f, 0.89506048f, -0.259675354f, -0.0797661543f, -0.585520029f, 0.223786071f, 0.676250219f, -0.006234664f,
+    -0.942519724f, -0.570781529f, -0.275287867f, -0.229394868f, -0.309381962f, -0.666940749f, -0.205800176f, -0.201211885f,
+    0.52924341f, -0.860676587f, -0.383989573f, 0.632691205f, -0.646796823f, -0.738961816f, 0.337310106f, 0.555714846f,
+    -0.0500380434f, 0.675274432f, 0.221393377f, -0.183250964f, 0.76328975f, 0.349408209f, -0.203731954f, -0.709376574f,
+    -0.40191859f, 0.337006032f, -0.262388617f, 0.248072624f, -0.669765651f, -0.911501408f, 0.0692698956f, -0.292037189f,
+    0.53132391f, -0.0841805115f, 0.762752652f, -0.440220028f, 0.948194027f, -0.181692809f, -0.14712733f, -0.477134049f,
+    -0.674730062f, 0.807845294f, 0.841547251f, -0.000375647302f, -0.860708356f, 0.515804589f, 0.520462275f, -0.860919058f,
+    0.562064469f, -0.112983972f, -0.382098943f, -0.308004081f, -0.934325933f, -0.386505425f, -0.671619415f, 0.19218801f,
+    -0.971355081f, 0.757035673f, -0.0551422387f, -0.00941781141f, 0.701950431f, -0.166658148f, 0.219515473f, -0.174158365f,
+    -0.904934824f, -0.0555688478f, 0.622149765f, -0.467951357f, 0.47164914f, 0.107484497f, 0.895868123f, 0.261245281f,
+    -0.320491493f, 0.43428421f, 0.903374195f, -0.957514703f, 0.823348224f, 0.142973229f, 0.390648961f, 0.765403628f,
+    0.537483096f, -0.350384086f, -0.377529085f, 0.86448139f, 0.352890581f, 0.314306647f, -0.434256375f, 0.253267139f,
+    0.353914648f, 0.403107345f, -0.836470366f, 0.423912674f, -0.943854153f, -0.83076179f, 0.698979795f, -0.407034189f,
+    -0.349400461f, -0.240948141f, -0.813379526f, -0.694989562f, -0.954349399f, 0.378327876f, -0.426495671f, -0.959610403f,
+    0.918572903f, 0.0209786408f, -0.288872361f, 0.931296706f, 0.585397482f, -0.507433772f, 0.398803502f, -0.707623601f,
+    -0.205736071f, 0.826668501f, 0.421899498f, 0.421116799f, 0.730644047f, 0.637609899f, 0.822178185f, 0.590808034f,
+    -0.690906942f, -0.508950233f, -0.236580774f, 0.877627254f, 0.821902454f, -0.803273916f, -0.746873438f, -0.674836636f,
+    -0.951192021f, -0.595191061f, -0.0725781918f, 0.402877897f, 0.423016012f, -0.454122365f, 0.833734989f, -0.717091739f,
+    0.247017533f, -0.131858036f, 0.0480745435f, 0.274988562f, -0.657004178f, -0.515263975f, 0.388537437f, -0.946940601f,
+    0.851804852f, -0.229738355f, 0.252878487f, -0.915180802f, 0.312136382f, -0.535611868f, -0.220079288f, -0.0271019563f,
+    -0.968880355f, 0.554355919f, 0.762570858f, 0.935846865f, -0.457569093f, -0.96811825f, -0.427434951f, -0.0856688693f,
+    -0.705975533f, -0.736112356f, -0.70714885f, -0.227682814f, 0.612117708f, 0.927799523f, -0.486533731f, -0.434661359f,
+    -0.457554549f, 0.190127343f, 0.119889602f, 0.391054571f, 0.419313133f, -0.971784592f, -0.638573468f, -0.0322082527f,
+    0.899425387f, -0.933152258f, 0.498850584f, -0.20423688f, 0.801761448f, 0.259769946f, -0.683364153f, -0.749967098f,
+    -0.922887743f, -0.511068046f, 0.00226213573f, 0.373777539f, 0.0220278148f, 0.568634927f, -0.519464314f, -0.850693464f,
+    -0.272271872f, -0.280505955f, 0.57995218f, 0.573605657f, 0.539634526f, -0.944687128f, 0.741707563f, 0.358649075f,
+    0.163625211f, 0.874032557f, -0.296087623f, 0.0830182806f, 0.907144368f, 0.402733117f, -0.0207751226f, -0.174942106f,
+    0.997112572f, -0.847602427f, -0.0379493572f, 0.957882941f, 0.344576448f, -0.707148373f, -0.629614115f, 0.0306144413f,
+    -0.731538236f, 0.629483163f, -0.104039587f, -0.975283861f, 0.0122942664f, -0.145104259f, 0.25392887f, -0.474301159f,
+    0.413353056f, 0.311392456f, 0.023298189f, -0.281271428f, 0.828757644f, -0.788975894f, 0.366201639f, 0.708781421f,
+    0.969856381f, -0.672576487f, 0.389007926f, -0.577519476f, -0.674366951f, -0.869573414f, -0.634135783f, 0.123880684f,
+    -0.895001054f, -0.87978822f, 0.555333316f, -0.499643505f, 0.653526068f, -0.730094612f, 0.594997048f, -0.0545521043f,
+    -0.365392238f, 0.1465846f, 0.535823882f, 0.764960885f, -0.809522331f, -0.985834062f, 0.00979701057f, -0.511905849f,
+    -0.203381419f, -0.306480795f, -0.901879191f, -0.839834154f, -0.983495653f, -0.250261813f, 0.256216615f, -0.191898137f,
+    0.353433162f, 0.338935584f, 0.467612445f, -0.70433259f, 0.169910401f, -0.293195993f, -0.774714112f, 0.539479017f,
+    0.941080093f, -0.832939327f, -0.487366498f, -0.957445085f, 0.879900932f, -0.0311303381f, 0.704074502f, -0.325909287f,
+    0.611120105f, -0.3330971f, -0.674287319f, 0.0793282464f, 0.867233515f, -0.506414056f, -0.764341474f, 0.465741932f,
+    -0.529340982f, -0.54192555f, -0.619700909f, 0.411541253f, -0.602505922f, 0.642935872f, 0.0171589814f, 0.595415711f,
+    -0.127578273f, -0.132355213f, -0.437461138f, 0.0683359578f, 0.320067108f, -0.682642877f, -0.689735293f, -0.614633203f,
+    -0.0484336503f, -0.00942095555f, 0.424916595f, 0.992507577f, 0.819380522f, 0.931358516f, 0.27503714f, 0.158814177f,
+    0.117863886f, 0.785246372f, 0.377970815f, -0.775936484f, -0.370878577f, -0.47822541f, -0.51895231f, -0.563860655f,
+    0.27097407f, -0.508339822f, -0.266571432f, 0.99133271f, -0.92106986f, -0.197634101f, 0.70599544f, -0.336652726f,
+    -0.607578933f, 0.172726929f, 0.217038617f, -0.0407515131f, 0.393440515f, 0.374501139f, -0.817294776f, 0.00285208691f,
+    0.970562577f, 0.978212953f, -0.675358593f, 0.619805872f, 0.00895753596f, -0.448573709f, -0.146599978f, -0.38970232f,
+    -0.103474021f, -0.548969448f, 0.674967349f, -0.762851298f, -0.802750349f, 0.410756022f, 0.35022974f, 0.850401044f,
+    -0.806485891f, 0.544470489f, 0.0505818836f, -0.497605205f, 0.215991467f, -0.0798563361f, 0.0482941046f, 0.854175448f,
+    0.824205995f, -0.628571153f, -0.524139106f, 0.314143181f, 0.636086106f, 0.478390068f, 0.774158776f, -0.0376427732f,
+    -0.955986261f, 0.0961456224f, -0.822929084f, -0.463592172f, 0.366138875f, -0.617103279f, 0.297596991f, -0.350474805f,
+    -0.0475033894f, -0.0575265661f, 0.423604876f, -0.293901742f, -0.396776944f, 0.588143647f, -0.134703606f, -0.1998135f,
+    -0.312815845f, -0.199832857f, -0.0757166296f, -0.486384541f, -0.150838733f, -0.421423942f, -0.46256718f, -0.365223557f,
+    0.0747237653f, 0.207521066f, -0.527230024f, 0.0405531451f, 0.811247826f, 0.267436713f, 0.948037088f, -0.483982146f,
+    0.497938871f, -0.742718697f, -0.883751214f, 0.295944422f, 0.155589595f, -0.711336792f, 0.887260497f, -0.800255477f,
+    0.765372753f, 0.174051464f, -0.233962879f, 0.233834818f, -0.956233799f, -0.0502199121f, -0.0950040817f, 0.649155855f,
+    -0.670012295f, -0.105315365f, -0.943304539f, -0.244893298f, 0.184951231f, -0.552246988f, -0.824216425f, -0.302207947f,
+    -0.963003814f, 0.449770063f, 0.77791065f, 0.488532245f, 0.781285882f, -0.263982385f, -0.149874032f, -0.716401994f,
+    0.0559179932f, 0.265885592f, -0.346451581f, 0.574566126f, -0.203964084f, 0.196504936f, 0.801625133f, 0.188529223f,
+    -0.0501485243f, 0.375357419f, -0.296756715f, 0.435353607f, 0.32286039f, -0.344824582f, 0.198448479f, -0.721205771f,
+    0.375386089f, 0.870943129f, 0.808692396f, 0.0272917841f, -0.77452004f, 0.563703597f, -0.589736998f, -0.310274422f,
+    0.0150016965f, 0.345318556f, 0.591225445f, 0.47734049f, 0.412099957f, 0.68772167f, -0.127557933f, 0.0254402924f,
+    0.392130703f, -0.633001745f, 0.378663152f, -0.0482110977f, 0.771117926f, 0.666193783f, -0.386875898f, 0.0877396613f,
+    -0.273909628f, -0.0459486768f, 0.912295341f, -0.1608233f, -0.660239935f, -0.464434385f, -0.129561812f, -0.860837042f,
+    0.853881657f, 0.174474254f, 0.681019008f, 0.437420607f, 0.307978183f, -0.80646342f, 0.768436968f, -0.154442713f,
+    -0.21779117f, 0.347091317f, -0.104112402f, 0.61804533f, -0.733393371f, 0.800222635f, 0.368206233f, 0.474834472f,
+    -0.0237066429f, 0.741889179f, 0.634866536f, 0.0646487698f, -0.430305362f, -0.372387201f, 0.528184533f, 0.435362548f,
+    0.636468291f, 0.952813506f, 0.946584761f, -0.539974988f, 0.391956806f, 0.0527900197f, -0.614993453f, -0.246188447f,
+    0.668732703f, -0.0647437721f, -0.359699428f, -0.204593301f, 0.46160531f, -0.925068915f, 0.620789051f, 0.337801665f,
+    -0.853793144f, -0.575680315f, -0.616189897f, -0.756230891f, 0.698185146f, 0.31338641f, 0.675493002f, -0.755895138f,
+    -0.0971675813f, 0.949684501f, 0.464315593f, 0.051572755f, -0.627945662f, -0.910945773f, 0.638496816f, -0.113645509f,
+    -0.147434279f, 0.540720284f, 0.0309386179f, 0.992484212f, 0.228036672f, -0.342110366f, -0.358359069f, 0.908427417f,
+    -0.964001119f, 0.78364104f, 0.452509344f, 0.168522626f, 0.735368192f, -0.0355477929f, -0.237567618f, 0.369023383f,
+    -0.648823559f, 0.459040195f, -0.177517116f, 0.949862182f, -0.587665915f, 0.491858035f, -0.445815086f, 0.89251703f,
+    0.966643155f, -0.849171758f, -0.6521281f, 0.132572234f, 0.239279777f, -0.118137322f, -0.312412232f, 0.00451121246f,
+    0.624805689f, 0.727914512f, -0.196343556f, -0.887031257f, -0.0105199805f, -0.275503367f, -0.854362845f, 0.383193702f,
+    0.369255871f, -0.720241368f, 0.137899444f, -0.899267077f, -0.495800257f, -0.764909327f, -0.225940436f, 0.0583211035f,
+    -0.129752293f, -0.742778182f, -0.479080498f, 0.796317756f, -0.0695099086f, 0.273008078f, -0.506440818f, -0.350523561f,
+    -0.498926818f, -0.188823596f, 0.817581534f, 0.258433253f, -0.209265098f, 0.0116490349f, 0.326953411f, 0.717224717f,
+    0.214938968f, 0.845473409f, -0.439019829f, 0.182125971f, -0.886542737f, 0.204589233f, 0.166333675f, -0.727346182f,
+    0.0727223083f, -0.848870814f, 0.0551895574f, -0.589066327f, 0.174397394f, 0.311044365f, -0.272274822f, -0.792260885f,
+    -0.638852954f, 0.434855968f, -0.328252584f, 0.468052834f, 0.487124681f, -0.719027102f, 0.845594645f, 0.731494308f,
+    -0.640783727f, -0.0452674665f, -0.219875351f, -0.996777952f, -0.792688251f, -0.28448078f, 0.812619805f, 0.759913743f,
+    0.640466571f, 0.0624252334f, 0.794269264f, -0.992761374f, 0.882551551f, -0.638444483f, -0.789844632f, 0.328006208f,
+    -0.67109108f, 0.746405423f, 0.351146519f, -0.316846818f, 0.751675308f, -0.672499597f, -0.200275466f, 0.970314741f,
+    -0.379227668f, -0.308783978f, -0.592539787f, 0.637174308f, -0.566906393f, -0.144134462f, -0.883706987f, 0.782241046f,
+    0.391251117f, -0.290653825f, 0.533301413f, -0.640382886f, 0.137584254f, -0.0968901366f, 0.201285422f, 0.037091352f,
+    -0.532684803f, -0.829942882f, -0.0528732575f, -0.611313999f, 0.0195927173f, 0.19948566f, 0.930584311f, 0.864755392f,
+    -0.0972613916f, -0.0743130147f, 0.017582519f, -0.0316449739f, -0.623702407f, -0.465986818f, 0.261410713f, 0.739961863f,
+    0.684800625f, 0.258667201f, 0.793442845f, 0.853049994f, -0.261592805f, -0.159686953f, 0.646408021f, -0.610821366f,
+    -0.400851011f, -0.238730699f, -0.271789283f, -0.860256314f, -0.658560395f, 0.792278528f, -0.454277813f, -0.940482378f,
+    -0.711034417f, -0.297739476f, 0.702058852f, 0.569607496f, -0.156503603f, 0.67871058f, 0.678939521f, -0.779441595f,
+    -0.0256109852f, -0.885586023f, 0.457577527f, -0.656639218f, -0.406638175f, -0.778739035f, -0.786620438f, -0.0370565131f,
+    -0.0984387323f, -0.95248729f, -0.86168313f, -0.867270648f, 0.818468332f, 0.397922456f, -0.0867165104f, -0.80712086f,
+    0.87864697f, 0.592908144f, 0.928192496f, 0.82220155f, -0.782192707f, 0.0926782638f, -0.723715663f, 0.807626545f,
+    -0.865406334f, -0.876644075f, 0.102366552f, 0.571559846f, 0.983638465f, -0.566348553f, 0.412355751f, -0.945683539f,
+    -0.0439096689f, -0.0348558351f, 0.482941687f, -0.400959849f, -0.748383641f, 0.0943657011f, -0.350362539f, 0.691503465f,
+    0.628535032f, 0.297782183f, -0.398402333f, 0.109101363f, 0.631674528f, -0.457087189f, 0.341822714f, -0.648693323f,
+    -0.570494771f, 0.64359051f, -0.829104841f, 0.432888478f, -0.101801649f, 0.589716911f, 0.578686476f, -0.176788405f,
+    -0.515924752f, -0.213281065f, -0.649744093f, 0.140113577f, -0.906682372f, -0.176871702f, -0.779902875f, -0.084043391f,
+    0.338543266f, -0.888273478f, 0.920046389f, -0.853430152f, -0.580102682f, -0.698892117f, -0.757197976f, -0.298412353f,
+    0.710648835f, 0.977187753f, 0.12580207f, 0.212452486f, 0.7099666f, -0.959320128f, -0.123089403f, 0.854876518f,
+    0.642469585f, 0.93627584f, -0.0567768179f, 0.46263966f, -0.0591803268f, 0.258740664f, -0.681364655f, 0.805643797f,
+    -0.953676879f, 0.612555623f, 0.409578323f, 0.738302052f, -0.167767495f, 0.7095294f, 0.395050168f, 0.811774015f,
+    0.260932356f, -0.689553261f, 0.542955995f, -0.00516604679f, -0.268289506f, 0.000827038079f, 0.242103472f, 0.757095635f,
+    0.531940103f, -0.0834288895f, 0.407554626f, -0.961937368f, 0.8444767f, 0.640504718f, 0.56628108f, -0.639250755f,
+    0.243545339f, 0.278067559f, -0.847591221f, 0.996884286f, 0.538850784f, -0.487367034f, 0.909478247f, -0.944589853f,
+    0.574812829f, 0.394894242f, 0.469867051f, -0.360270113f, -0.815790653f, -0.788994849f, 0.375716269f, -0.83975035f,
+    -0.0892366394f, -0.507804811f, -0.748529375f, 0.530705094f, 0.334655851f, -0.600235879f, -0.601061225f, -0.244926915f,
+    -0.249403581f, -0.259018213f, 0.045986414f, 0.0846112221f, 0.994249523f, 0.795211971f, 0.714138508f, 0.476034105f,
+    -0.185019568f, -0.414075553f, 0.017205948f, 0.29941088f, 0.456641883f, -0.700945854f, 0.696873069f, 0.978281736f,
+    0.886544704f, -0.932026148f, -0.0338353477f, 0.15540418f, 0.0312334355f, 0.281819344f, 0.356263161f, -0.379540652f,
+    -0.248500183f, -0.750874877f, -0.264159232f, -0.328122437f, 0.0501308739f, -0.358921796f, 0.0835940316f, -0.0427489392f,
+    -0.333409578f, -0.747485936f, -0.643281937f, -0.625228167f, 0.417106241f, 0.106325783f, 0.0240587238f, 0.704172552f,
+    0.636487186f, 0.983665824f, 0.468732625f, 0.823310435f, -0.845212042f, 0.900096655f, -0.0797946081f, -0.430680752f,
+    0.709861219f, 0.895509005f, 0.71661377f, 0.416242838f, -0.403708816f, 0.279487789f, 0.274684936f, 0.340189904f,
+    -0.186453179f, 0.111802183f, -0.625040114f, 0.348728538f, -0.333652914f, -0.834868729f, 0.556648314f, -0.932019472f,
+    -0.20316796f, -0.341415524f, -0.608102977f, 0.049389191f, -0.315413326f, -0.370629907f, -0.337920934f, -0.570251167f,
+    0.0819405168f, 0.455584466f, -0.515791655f, -0.141472012f, -0.350906432f, -0.0825390741f, 0.337861925f, 0.381655097f,
+    -0.0628389493f, 0.60847795f, -0.112706713f, 0.723155379f, 0.460633546f, -0.295676887f, 0.109947272f, 0.924366653f,
+    -0.44786033f, -0.344958574f, 0.330387831f, -0.264446527f, 0.211701646f, 0.415532917f, -0.100304648f, 0.579754472f,
+    -0.389238477f, 0.184261709f, 0.431262076f, 0.980375826f, -0.643302381f, -0.713541329f, 0.24075307f, -0.0761299133f,
+    0.932271779f, -0.421902537f, -0.225031242f, -0.249069586f, 0.30087319f, -0.8848598f, 0.0121621918f, -0.205720782f,
+    0.996600151f, -0.200679272f, 0.791571677f, 0.237052813f, 0.28912878f, 0.458693564f, 0.608722508f, 0.956574261f,
+    -0.65016526f, -0.417930573f, -0.345202684f, -0.745121777f, 0.174457818f, 0.907899916f, 0.0595298484f, -0.291429758f,
+    -0.365338773f, -0.255262345f, -0.738527179f, -0.923396289f, 0.357943624f, 0.157686085f, -0.0075357263f, 0.671432257f,
+    -0.766253114f, -0.249255389f, 0.00985526759f, 0.708126068f, 0.125670925f, -0.0170959458f, 0.160143644f, 0.491726935f,
+    -0.81373471f, -0.25665763f, 0.364529312f, 0.076808542f, 0.735272348f, -0.842962921f, -0.639604688f, 0.39004162f,
+    0.375005901f, 0.370271295f, -0.33525756f, 0.0191138126f, -0.0431907959f, -0.099683933f, 0.494699508f, -0.500383496f,
+    0.729658186f, -0.575214684f, 0.680492699f, 0.702896178f, 0.0865096524f, 0.0877402723f, 0.0795477405f, 0.444595575f,
+    -0.832823873f, -0.0463729985f, 0.0307647195f, 0.733952999f, 0.737557828f, -0.00888105109f, 0.33673203f, 0.278207481f,
+    0.863639712f, 0.84651494f, 0.514319539f, -0.606900573f, 0.610998273f, 0.83329922f, -0.633571565f, -0.906683147f,
+    -0.469731271f, 0.497177273f, -0.665833771f, 0.409270614f, -0.0600280613f, 0.955703735f, -0.118141845f, 0.68657434f,
+    0.208094165f, 0.834969223f, 0.729182661f, -0.932191789f, 0.639977098f, 0.369530559f, -0.159170732f, -0.917720437f,
+    -0.699112535f, -0.181861952f, -0.266722918f, -0.730915248f, 0.440973222f, -0.0866269618f, 0.977317572f, 0.169780403f,
+    0.618151248f, 0.929325461f, 0.776634932f, -0.684552848f, -0.99789536f, 0.845601082f, 0.579284608f, 0.666771889f,
+    -0.373969644f, 0.763662994f, 0.420348734f, 0.4899261f, -0.671538413f, -0.407484353f, 0.818169832f, 0.158819571f,
+    0.909801543f, 0.279079527f, -0.992323458f, 0.163413405f, 0.0846379772f, 0.344425172f, 0.985441744f, 0.129363954f,
+    0.405083805f, -0.735334814f, 0.790533602f, 0.778412998f, 0.483184487f, -0.184695661f, 0.523183227f, 0.52838397f,
+    0.0338904373f, 0.653342783f, 0.203257337f, -0.967337847f, -0.440977663f, 0.928036928f, 0.842528343f, 0.17207247f,
+    0.942103744f, -0.0505695939f, -0.854365349f, -0.332570106f, 0.775186777f, -0.171961248f, 0.23025164f, -0.324921161f,
+    0.868499458f, 0.794454992f, 0.456985682f, -0.524474382f, -0.87011987f, -0.282263577f, -0.85448885f, 0.525255442f,
+    -0.0111872116f, -0.920666039f, 0.590585887f, 0.233089209f, 0.997266829f, 0.435439944f, -0.351132691f, 0.321136445f,
+    -0.369683206f, -0.154134125f, -0.448090941f, -0.814839065f, -0.0755451918f, -0.418631941f, 0.17272006f, 0.553341568f,
+    0.303134382f, 0.0995783359f, -0.920876205f, 0.0194276497f, -0.0494902357f, 0.960540175f, 0.950846314f, 0.853404224f,
+    -0.633667886f, -0.993201137f, 0.553534567f, 0.402604729f, -0.850485861f, 0.162016109f, -0.978273332f, -0.14978683f,
+    0.494507998f, -0.595953822f, 0.0445336513f, -0.783093989f, -0.846659243f, -0.769619942f, 0.874786973f, -0.229872733f,
+    -0.607458889f, -0.511425018f, 0.821661055f, 0.759530127f, -0.556970835f, -0.502808928f, -0.829955399f, 0.892137051f,
+    -0.440237343f, 0.546477258f, 0.670612216f, 0.746227443f, 0.706217885f, 0.726810932f, -0.421948403f, 0.0301792938f,
+    0.675337672f, -0.607397735f, 0.649965107f, 0.213264495f, -0.997431219f, 0.380554348f, -0.0707317293f, -0.598053157f,
+    -0.276186764f, -0.179484457f, -0.667992532f, -0.267100096f, -0.738531172f, -0.59855032f, -0.0226855725f, 0.205096677f,
+    0.95844233f, 0.67833817f, -0.4088521f, -0.0862460956f, 0.889673591f, 0.252482384f, 0.294497848f, 0.341975212f,
+    -0.682056665f, 0.879295766f, -0.65146029f, -0.433500797f, 0.501084387f, 0.171697646f, -0.336243927f, -0.923502445f,
+    0.666650295f, 0.409246743f, 0.761741638f, -0.69723171f, -0.617079258f, -0.657121658f, -0.0196858812f, 0.889439046f,
+    0.088099055f, 0.240511656f, -0.29287976f, -0.595936954f, 0.260523289f, 0.176474407f, -0.992617846f, 0.147946581f,
+    0.0916078165f, -0.244524762f, 0.55755794f, 0.273910075f, -0.429955363f, -0.891908169f, 0.242777273f, -0.731358767f,
+    0.68578577f, -0.235021397f, 0.909725428f, 0.500650287f, -0.789701104f, 0.436577588f, -0.865525067f, -0.679767132f,
+    -0.84453243f, -0.561747074f, 0.631261945f, 0.62649709f, 0.744289219f, -0.105499066f, -0.218958154f, -0.776544988f,
+    -0.66436857f, 0.824593961f, 0.0857184455f, -0.558655679f, -0.262277067f, -0.882760167f, -0.996793211f, -0.753360212f,
+    0.959384441f, -0.778623104f, -0.512705803f, 0.109039277f, -0.357884586f, -0.156622007f, -0.0233700592f, -0.107790448f,
+    0.0215266813f, 0.983050168f, 0.396775216f, -0.896373749f, -0.102661602f, -0.823010027f, 0.441615283f, -0.849276781f,
+    0.746782362f, -0.0366281308f, -0.903472066f, -0.429086655f, 0.246988714f, 0.948801279f, -0.405595154f, -0.00182851963f,
+    -0.799470782f, 0.47626397f, -0.031231381f, -0.665549874f, 0.656852305f, -0.871099412f, -0.113064714f, -0.744126976f,
+    -0.528493881f, 0.830185771f, 0.978589237f, -0.368339092f, 0.531285703f, -0.526725173f, -0.779653847f, -0.855911076f,
+    -0.632121027f, 0.884648263f, 0.775654614f, -0.305845976f, 0.82963419f, -0.290149331f, 0.114790909f, 0.440934509f,
+    0.721341133f, -0.451546907f, 0.147597492f, -0.875900269f, -0.653964281f, 0.600302756f, 0.715148091f, 0.262598723f,
+    -0.551382661f, 0.685088873f, 0.366683096f, 0.44597584f, 0.620867074f, -0.581019521f, -0.0371554159f, 0.65918076f,
+    -0.247203633f, -0.0481343195f, -0.0477737635f, -0.858514905f, 0.938847899f, -0.292633832f, -0.398928702f, 0.301240623f,
+    0.980674446f, 0.831587315f, -0.54317981f, -0.0513399765f, 0.304115653f, 0.340556145f, 0.723264813f, -0.556013942f,
+    0.596226454f, -0.367019445f, -0.152813688f, -0.21069409f, -0.585254252f, -0.42622444f, -0.158253893f, 0.678058803f,
+    0.175001159f, -0.897164285f, 0.076812759f, -0.800851822f, 0.942509472f, 0.846331596f, -0.0622758456f, 0.270903111f,
+    -0.0645559654f, -0.195816025f, 0.859152138f, -0.00653033005f, -0.717474639f, -0.276210189f, -0.845724702f, 0.998758614f,
+    0.408116937f, 0.199063495f, 0.362123549f, -0.93682307f, 0.584841549f, 0.570803821f, 0.876017213f, 0.807319283f,
+    0.0532115065f, 0.235329464f, 0.211479142f, -0.723157048f, 0.108895406f, -0.170325443f, 0.0489771105f, -0.75167501f,
+    -0.768625617f, 0.906869233f, -0.675960779f, -0.373823166f, 0.878813684f, 0.783755004f, -0.99142319f, -0.217726097f,
+    -0.942582309f, 0.758241773f, 0.194737151f, 0.434299469f, -0.271154255f, -0.882028043f, 0.682654142f, 0.276872694f,
+    0.522378743f, 0.659487724f, -0.193007737f, 0.588201344f, 0.982462883f, 0.338874936f, 0.639086485f, 0.553765833f,
+    -0.915450752f, 0.389303774f, 0.770284593f, -0.0301851053f, 0.859639525f, 0.902850389f, 0.689333379f, 0.216569781f,
+    0.300553054f, -0.909360886f, 0.532063246f, -0.661418498f, 0.558935881f, 0.249527663f, -0.710194468f, -0.33630681f,
+    -0.835101426f, 0.963473439f, 0.131804004f, 0.346921831f, 0.574575484f, 0.388060868f, 0.999608338f, -0.57298547f,
+    0.770001769f, -0.259985149f, 0.34666869f, 0.500839829f, -0.937754154f, -0.124110125f, 0.902790904f, 0.671171188f,
+    -0.456167012f, -0.0333360098f, 0.450467199f, -0.95202297f, -0.474528819f, 0.691847384f, -0.229756743f, 0.209020078f,
+    -0.458686084f, 0.414229661f, -0.900720119f, -0.748083293f, -0.259369344f, 0.635699511f, -0.158402443f, -0.282963187f,
+    -0.85935837f, 0.839604974f, -0.971204817f, -0.417884439f, 0.491304517f, -0.116627425f, -0.900099099f, 0.351145864f,
+    0.649230301f, 0.602359295f, -0.78279978f, -0.912425756f, 0.994035482f, -0.680033267f, 0.604757786f, 0.384480268f,
+    0.47774452f, -0.796040654f, 0.705909252f, 0.544234335f, -0.873004079f, -0.956409574f, -0.825311303f, -0.475408345f,
+    -0.0391807668f, -0.794198632f, 0.399507195f, 0.70537734f, -0.545954108f, -0.975024223f, -0.884417355f, 0.987828851f,
+    -0.944588959f, 0.303897202f, -0.00684936391f, -0.559605241f, -0.857484102f, 0.690007687f, 0.110535607f, 0.903523743f,
+    -0.0431240648f, 0.247114137f, 0.358133137f, 0.39916712f, -0.0155722583f, 0.855311871f, -0.956608117f, 0.979380727f,
+    0.730092168f, 0.820162356f, -0.869867861f, -0.0501646399f, -0.56700182f, -0.281066656f, 0.411309689f, -0.861621082f,
+    0.84236455f, 0.0216470771f, 0.701657712f, -0.0268691666f, 0.931655884f, -0.687962353f, 0.0815949664f, -0.82144165f,
+    -0.134977609f, -0.8815341f, 0.482504785f, -0.624315917f, -0.4886792f, -0.437657118f, 0.316693366f, 0.0538078956f,
+    0.145250589f, -0.491369218f, 0.960531175f, 0.393898696f, -0.761959195f, -0.0724001154f, 0.854321241f, -0.94320786f,
+    0.530855536f, -0.387994081f, 0.42770505f, -0.509899437f, 0.306962818f, -0.0299791507f, -0.748846114f, 0.970667303f,
+    -0.198936969f, -0.709511518f, 0.438426644f, 0.654130638f, -0.686475933f, 0.580558777f, 0.222382918f, 0.640538752f,
+    0.685883939f, -0.304213464f, 0.836726069f, -0.0514142551f, -0.86324507f, 0.898931742f, 0.0500501655f, 0.134586722f,
+    0.484915704f, -0.00437847711f, 0.979775667f, 0.32246089f, 0.668636441f, 0.0814191103f, -0.485186845f, -0.959248841f,
+    -0.644675136f, -0.00248907553f, 0.699865758f, -0.138617411f, -0.30582127f, -0.895577371f, 0.767265201f, 0.32628575f,
+    -0.436678767f, 0.954281688f, 0.877954662f, 0.787512302f, 0.261027813f, -0.264200121f, 0.135005832f, -0.937565029f,
+    -0.221439794f, 0.0719611496f, -0.146973416f, -0.911609292f, -0.615457475f, -0.172088698f, -0.596456766f, -0.236726448f,
+    0.978884339f, -0.139677212f, -0.0766173005f, -0.0316693857f, -0.546334326f, -0.936957777f, 0.0752234906f, -0.835003376f,
+    -0.803620636f, -0.322489977f, -0.821396053f, -0.522399843f, 0.0163284261f, -0.908333004f, 0.607611537f, 0.335083336f,
+    0.954990804f, 0.938473105f, -0.890680552f, 0.283590198f, 0.642656744f, 0.292458653f, 0.0140150366f, 0.652133644f,
+    -0.914733827f, -0.69719708f, 0.64757365f, 0.0915635377f, 0.695811033f, 0.231199518f, 0.135659128f, 0.486554563f,
+    -0.630402625f, -0.936923444f, 0.489681602f, -0.362685233f, -0.457061172f, 0.68188709f, -0.786150873f, 0.0555265807f,
+    0.181356609f, -0.596035242f, 0.725147367f, 0.0117406985f, 0.73850596f, 0.997054756f, 0.944144189f, -0.0371843576f,
+    0.290500462f, 0.228241205f, 0.301241338f, -0.792052805f, -0.464336097f, -0.731190801f, 0.668763518f, -0.327108771f,
+    -0.0899674147f, 0.937659144f, 0.68424952f, 0.91109103f, 0.539263487f, -0.22274828f, -0.57480973f, 0.0192708708f,
+    -0.385274798f, 0.94999665f, 0.161173046f, -0.479070365f, 0.0667740703f, -0.265372872f, -0.702716231f, -0.388685793f,
+    0.732252598f, -0.633971453f, -0.858479261f, 0.255621076f, -0.749213457f, -0.216415256f, 0.409258664f, -0.58177042f,
+    -0.986987472f, 0.230028942f, 0.074992165f, -0.342223167f, -0.832046092f, 0.941509306f, -0.11042349f, 0.377888054f,
+    0.117800169f, -0.110305078f, -0.387590915f, 0.49679938f, 0.580362678f, -0.167577758f, -0.476810932f, 0.349304944f,
+    0.808762014f, 0.872321665f, -0.227920756f, 0.486198753f, 0.196603969f, -0.797993541f, -0.439174473f, -0.73303014f,
+    -0.508364439f, -0.237063482f, -0.0923644006f, -0.410836399f, -0.0232955813f, -0.54594779f, 0.463603467f, -0.242978111f,
+    0.61125344f, -0.131306559f, -0.185158223f, 0.288701296f, -0.825735211f, 0.122451715f, 0.343173414f, 0.0180773493f,
+    -0.391017973f, -0.389311075f, 0.642822564f, 0.485552311f, 0.937867939f, -0.240548f, -0.957558453f, -0.399853617f,
+    -0.947329521f, 0.739818335f, -0.304364085f, -0.206380963f, -0.214630991f, -0.176824853f, 0.279029459f, -0.648169577f,
+    -0.529522955f, -0.61871773f, -0.580852389f, -0.414313346f, 0.71238327f, 0.870503485f, 0.824112535f, -0.439681262f,
+    -0.789116979f, -0.679977536f, -0.998391688f, -0.206088677f, -0.163048536f, 0.694613755f, 0.112625808f, -0.833212614f,
+    -0.0274594016f, -0.669472814f, -0.64377892f, -0.876366496f, 0.0931993797f, 0.946761191f, 0.00961985439f, 0.0199141707f,
+    0.933480084f, 0.129608124f, 0.990770221f, 0.705910385f, -0.577015817f, 0.0424117707f, -0.076497063f, -0.707555234f,
+    0.743778527f, -0.172267154f, -0.213631406f, 0.361217588f, -0.374819934f, -0.880453169f, 0.572008789f, -0.673661292f,
+    -0.874151766f, 0.788109303f, 0.983061194f, 0.333414257f, 0.428364247f, 0.306154221f, 0.0818103254f, -0.104438879f,
+    0.43647337f, 0.5227772f, 0.711656094f, -0.387702972f, -0.177643046f, -0.0926739648f, -0.36476934f, -0.0714265108f,
+    0.55769366f, 0.867821395f, 0.37588802f, -0.61591512f, -0.0460887253f, 0.103485487f, 0.807985723f, -0.0749974921f,
+    0.967621446f, 0.218073085f, 0.750160158f, -0.0693889707f, -0.706883013f, 0.512044728f, 0.0926220566f, 0.0510014892f,
+    0.507971466f, 0.490418971f, 0.688481152f, 0.371972173f, -0.450398117f, 0.143707171f, -0.443987429f, -0.855052888f,
+    -0.189443037f, 0.581889808f, -0.454191267f, -0.85930568f, 0.940559924f, 0.524524629f, -0.982793391f, 0.220730901f,
+    0.392272502f, -0.250503242f, -0.180288896f, -0.564252079f, -0.919513643f, 0.814101398f, -0.86707449f, 0.08528319f,
+    -0.807786882f, -0.423518836f, -0.801180005f, 0.195211053f, 0.648440123f, 0.120638914f, 0.165133625f, 0.270760775f,
+    -0.11762128f, -0.493158996f, 0.638290644f, 0.650719285f, -0.905409217f, 0.505978942f, -0.371897191f, 0.376959622f,
+    0.161117986f, -0.00256568845f, 0.543313384f, -0.668406427f, -0.516388237f, 0.377647758f, 0.379503429f, -0.409254164f,
+    0.507847667f, -0.802624822f, 0.254345387f, -0.264797837f, -0.491016597f, -0.666712523f, 0.321397156f, 0.344150394f,
+    -0.71508193f, 0.315141082f, -0.550047696f, -0.426732033f, -0.393297672f, -0.833951056f, 0.299730331f, -0.203319654f,
+    0.608781576f, -0.906955063f, -0.545073211f, 0.265811175f, 0.54082346f, 0.656457007f, -0.179449633f, 0.0200664345f,
+    -0.997475326f, -0.383449167f, 0.992759526f, -0.360539705f, -0.0433797762f, -0.70791471f, 0.126492575f, -0.208488047f,
+    -0.275423437f, 0.855015516f, 0.601496398f, 0.802597642f, -0.800964475f, 0.806705475f, 0.321037889f, -0.264116138f,
+    -0.939870656f, 0.574645221f, 0.583863258f, 0.177095711f, -0.80253756f, -0.709876478f, -0.946841657f, -0.517362595f,
+    0.849115789f, 0.996573448f, 0.804932296f, -0.957266748f, 0.527394414f, -0.49267295f, 0.704133213f, 0.771309257f,
+    0.243768439f, 0.296502501f, 0.0803386271f, -0.356075048f, 0.198524103f, 0.258617133f, 0.879542232f, 0.937542379f,
+    -0.640669286f, 0.306115299f, 0.5164814f, -0.877316892f, -0.437761456f, -0.418954372f, -0.695705056f, 0.406626135f,
+    0.790599406f, -0.552279413f, 0.113880627f, 0.559328437f, -0.0104553513f, -0.808840215f, -0.104932062f, 0.665356576f,
+    0.021091409f, -0.0683794171f, -0.67693311f, 0.95923841f, -0.202053383f, -0.720803499f, -0.553103507f, -0.848292887f,
+    -0.335129291f, 0.159165919f, 0.628782928f, -0.331529081f, -0.3605223f, -0.811878681f, 0.35635981f, -0.412233114f,
+    -0.931388259f, 0.51948601f, 0.477829367f, 0.184513688f, -0.454539478f, -0.667058527f, 0.22597976f, 0.508732915f,
+    -0.943476319f, -0.807984769f, -0.581531584f, 0.639614999f, -0.283405215f, 0.86879462f, -0.258673579f, 0.31888932f,
+    0.879080117f, 0.363582313f, -0.417392582f, -0.983621538f, -0.519394398f, -0.182143852f, -0.417438686f, -0.000529814628f,
+    -0.758717299f, -0.473180026f, -0.168381497f, -0.356849879f, 0.06948293f, -0.4234097f, -0.856281936f, -0.74439168f,
+    -0.514445364f, 0.449452341f, -0.753078818f, -0.837479174f, 0.0472724773f, 0.0339842923f, 0.288809955f, 0.506356359f,
+    -0.402117312f, -0.207987428f, -0.966282904f, -0.965265155f, -0.850229383f, -0.0982687995f, 0.955243826f, -0.554247737f,
+    -0.884341478f, 0.797646165f, 0.000757907692f, -0.387641847f, -0.92232722f, 0.63724941f, -0.839732409f, -0.528825998f,
+    -0.149133548f, -0.592579126f, 0.0203291979f, -0.422501713f, -0.880515635f, -0.192952156f, -0.945022762f, -0.839063227f,
+    0.428281307f, 0.117419712f, -0.590313196f, -0.833289266f, -0.112772614f, 0.869203329f, -0.0259819236f, -0.186825544f,
+    -0.0495389514f, -0.00242695981f, 0.436379671f, 0.375187725f, 0.105605051f, -0.495976716f, 0.5660429f, -0.887938023f,
+    0.648755908f, 0.129445001f, -0.33198455f, 0.320662618f, -0.726389885f, -0.206276461f, -0.131962255f, -0.192614555f,
+    -0.531221092f, 0.605879426f, 0.787067533f, 0.937890887f, -0.49821955f, -0.425457358f, 0.356355667f, 0.876357436f,
+    -0.447807372f, -0.578296244f, -0.389977068f, 0.151884615f, -0.0949666277f, 0.300970972f, 0.442087233f, -0.654238343f,
+    0.753637731f, 0.708860636f, -0.776386976f, -0.0501061752f, 0.570157588f, -0.897042572f, 0.0733310804f, 0.69188875f,
+    0.68821615f, -0.902279377f, -0.076072149f, 0.0495946221f, 0.0997162163f, 0.0992482901f, -0.0255645476f, -0.798963904f,
+    -0.997187138f, 0.576444209f, -0.73885864f, 0.854544044f, 0.549736619f, 0.631661654f, 0.82420373f, -0.244236082f,
+    -0.815049827f, 0.67170012f, -0.0288257189f, 0.721322775f, 0.814928949f, 0.981534541f, -0.206920043f, 0.10421177f,
+    -0.775751233f, -0.618231118f, -0.980931103f, -0.0254164245f, 0.356844485f, 0.896906972f, 0.524800479f, -0.55852288f,
+    -0.35220325f, 0.173432007f, 0.469200552f, 0.695137024f, -0.246948212f, 0.268051535f, 0.976896107f, -0.994752288f,
+    0.157525733f, -0.306392848f, -0.565904677f, 0.95454514f, 0.0495092347f, 0.714383841f, -0.207086399f, -0.120123938f,
+    -0.745644212f, 0.504163384f, -0.196673542f, 0.437150985f, 0.966595113f, 0.643937409f, -0.974513829f, 0.0265941229f,
+    -0.667545259f, -0.098052837f, 0.741691232f, 0.524216712f, 0.926276982f, 0.148554459f, 0.19366096f, -0.244733408f,
+    0.895855367f, 0.555224121f, 0.585689545f, 0.964523196f, -0.32387799f, -0.801800311f, -0.565228999f, 0.9201141f,
+    0.932637095f, 0.101832405f, 0.112893395f, -0.467233181f, 0.696590424f, -0.631977856f, -0.535173833f, 0.7511006f,
+    0.269479603f, -0.403042316f, 0.311631203f, 0.623185754f, 0.0707156062f, 0.645033777f, -0.996591449f, 0.415260524f,
+    -0.527707756f, 0.108358152f, -0.680293918f, -0.315680474f, 0.555633545f, 0.659797311f, 0.644517601f, -0.389501125f,
+    -0.264653593f, -0.850351095f, -0.998282015f, 0.289757311f, 0.850419343f, -0.908971786f, -0.185202852f, -0.586697459f,
+    -0.984538972f, -0.777833641f, -0.990651488f, 0.656308472f, 0.768887162f, 0.0160710402f, -0.866172254f, 0.447886348f,
+    0.179217681f, -0.871406317f, 0.747640491f, 0.00722723641f, -0.979954422f, 0.414658576f, -0.665570021f, -0.542750895f,
+    -0.497049421f, -0.434595108f, -0.631168664f, -0.359597057f, 0.325311273f, -0.861502886f, 0.526290178f, 0.278972894f,
+    0.28497526f, -0.191189945f, -0.339236587f, -0.960580111f, -0.602947831f, -0.487977862f, -0.927673519f, 0.98140043f,
+    -0.538358152f, 0.859157622f, -0.35904485f, 0.682495296f, 0.123819523f, 0.304496676f, -0.495917529f, -0.463161856f,
+    0.214773044f, 0.0524249338f, 0.655759335f, -0.216546014f, -0.385507286f, 0.0971920192f, -0.885245085f, 0.648269117f,
+    -0.699625254f, -0.943263054f, -0.414813131f, -0.926833808f, 0.500759244f, 0.655331194f, 0.925971031f, -0.266397774f,
+    -0.26055482f, -0.890981853f, -0.601488948f, -0.984366f, 0.78973341f, -0.969161332f, 0.641459405f, -0.515645742f,
+    0.214279905f, 0.489884794f, 0.839556694f, 0.636401534f, -0.695061266f, 0.431594461f, 0.455971032f, -0.115834348f,
+    0.240245566f, -0.392000914f, 0.549860179f, 0.5803684f, -0.138156623f, 0.217800945f, -0.713163555f, 0.476931185f,
+    0.602150619f, 0.983856678f, -0.226309329f, -0.904238403f, 0.610126615f, 0.816475749f, 0.0409831405f, 0.795036912f,
+    -0.36092633f, -0.564489663f, 0.781312406f, 0.39188838f, -0.738598406f, -0.519031644f, -0.0454861f, -0.79912287f,
+    0.390847325f, -0.35416621f, -0.950323403f, 0.10949304f, 0.573063672f, -0.544406712f, 0.13134481f, -0.265987784f,
+    0.0582934171f, -0.382455856f, 0.724462569f, 0.750339627f, -0.357178211f, 0.597231686f, -0.155135095f, 0.100506574f,
+    0.572438955f, 0.680862486f, 0.751332343f, -0.582497835f, -0.160105437f, 0.122459851f, -0.0285229441f, 0.0121683301f,
+    -0.809581518f, 0.945745885f, 0.678281069f, -0.319297284f, 0.379689336f, -0.645298481f, 0.32937479f, 0.28467083f,
+    0.219893292f, -0.59928757f, -0.165883332f, 0.560743034f, -0.924920022f, 0.290003955f, -0.0826578885f, 0.80747509f,
+    -0.0830748007f, -0.459543437f, 0.240432724f, 0.184676692f, 0.64386183f, -0.223403662f, 0.525891364f, 0.215219945f,
+    0.838572741f, 0.290477365f, 0.942734599f, 0.0618833154f, 0.762802482f, -0.831407011f, -0.0860084444f, -0.417409956f,
+    0.243196473f, 0.677250266f, 0.408371925f, 0.673833072f, -0.527306974f, -0.137414306f, -0.791526139f, 0.507564366f,
+    -0.365628451f, 0.207745239f, -0.83757633f, -0.633465827f, 0.951947927f, -0.557121336f, 0.947154701f, 0.273329377f,
+    0.899404287f, -0.777418017f, -0.577771544f, -0.203823075f, -0.994831383f, 0.679171026f, 0.106883124f, -0.0443391725f,
+    -0.276513398f, 0.609125495f, 0.529023051f, 0.123804502f, 0.676928461f, -0.449456215f, -0.307575941f, -0.935153902f,
+    -0.91309613f, -0.108826421f, -0.667631209f, 0.897975087f, -0.00523205148f, -0.911041617f, 0.315508932f, 0.615628302f,
+    0.317573667f, -0.711412191f, 0.77857697f, -0.594495773f, 0.539516509f, -0.987645984f, -0.130477399f, 0.197421476f,
+    -0.08524248f, 0.340551496f, 0.549392343f, 0.894679964f, 0.666838765f, 0.194304317f, -0.090021953f, -0.873809755f,
+    -0.464622974f, 0.821379721f, -0.97715199f, -0.416278481f, -0.293883145f, -0.512362957f, -0.248253733f, -0.92204088f,
+    0.868553996f, -0.870861232f, -0.527907491f, -0.33732453f, -0.196141735f, -0.953117192f, 0.105246924f, -0.313332945f,
+    0.668202043f, 0.21931681f, -0.154974952f, 0.314779967f, -0.457428515f, -0.122330338f, 0.765394211f, -0.108042784f,
+    -0.274021655f, 0.224732965f, 0.32446292f, -0.882177889f, 0.715511382f, 0.798950613f, 0.242215529f, -0.347395986f,
+    0.726610422f, -0.48960188f, 0.641583622f, 0.944455743f, 0.23578237f, -0.482007086f, 0.529717267f, -0.172772899f,
+    -0.161295831f, 0.306914568f, 0.331819087f, 0.0599203706f, -0.774641395f, -0.32001555f, -0.233783364f, 0.35812059f,
+    0.453778476f, -0.989177167f, -0.583115995f, -0.823304713f, -0.199121058f, -0.982275188f, 0.579310834f, 0.912173331f,
+    0.651687503f, 0.746884346f, 0.0286027156f, 0.331646591f, 0.187544942f, 0.225393787f, -0.350217581f, 0.534495115f,
+    -0.215800121f, -0.234975144f, -0.450437695f, 0.690020204f, 0.960781991f, 0.0134547194f, 0.346375942f, -0.564355493f,
+    -0.701144099f, 0.00928934291f, -0.350269526f, -0.910846472f, -0.816693723f, 0.799260437f, 0.37806946f, -0.909963429f,
+    -0.295858234f, 0.458067685f, -0.535373211f, -0.729683518f, 0.0178777408f, 0.658555567f, -0.0236306433f, 0.462302834f,
+    -0.293714195f, -0.338612825f, -0.459724575f, 0.881581604f, -0.502148628f, 0.390019923f, 0.950069189f, -0.742896736f,
+    0.186937094f, 0.23933135f, -0.935941458f, -0.689529359f, -0.809676111f, -0.864444494f, 0.0435777083f, -0.0679682493f,
+    0.49721393f, -0.454671204f, -0.96549511f, 0.99075371f, 0.536429703f, 0.392424345f, 0.762432992f, 0.910214961f,
+    -0.508560956f, -0.544386506f, -0.318224162f, -0.976311803f, 0.686853707f, -0.647814751f, -0.553122103f, -0.232028604f,
+    0.533490062f, 0.482504934f, -0.512457848f, -0.417603701f, 0.400022238f, -0.981890261f, 0.457703322f, -0.487943351f,
+    -0.865990579f, 0.526773393f, -0.0933030993f, -0.744089127f, 0.127750069f, 0.956859231f, -0.420909077f, 0.198269725f,
+    -0.373039305f, -0.958603382f, 0.315668523f, 0.398696095f, -0.677152872f, 0.951150894f, 0.592398763f, -0.370283782f,
+    -0.37450698f, 0.749180079f, -0.466858983f, 0.543867528f, -0.173503861f, 0.28305164f, -0.204266414f, -0.955183268f,
+    -0.945311189f, 0.252741545f, -0.525332034f, 0.196459115f, -0.323092431f, -0.444662064f, 0.540602446f, -0.767888486f,
+    0.705493093f, -0.291894585f, -0.650322199f, -0.181002781f, -0.568703115f, 0.121822648f, -0.960353136f, -0.169889763f,
+    -0.794315934f, 0.595199645f, 0.023741819f, -0.208421975f, 0.820665717f, 0.936234951f, -0.0136605557f, 0.999675393f,
+    -0.114111759f, -0.00371883716f, -0.895211995f, -0.0285236612f, 0.839744627f, 0.476969093f, 0.398986429f, -0.714436531f,
+    0.779826522f, -0.703487337f, 0.515845776f, -0.952856839f, -0.468193501f, -0.537835121f, 0.981943011f, -0.291242301f,
+    0.301977575f, -0.57538259f, -0.794035196f, -0.408639014f, -0.867181361f, -0.30093661f, 0.251226395f, -0.267886341f,
+    -0.181548029f, 0.0198600683f, 0.343873024f, 0.216574281f, 0.939223349f, 0.595874429f, -0.681634843f, 0.596235335f,
+    -0.308171004f, 0.575724661f, 0.674768448f, -0.680313408f, -0.827954471f, -0.147850126f, 0.074452512f, -0.580515981f,
+    -0.412333727f, 0.449236989f, -0.231627136f, -0.0411374755f, 0.446603209f, -0.718771279f, 0.959205151f, -0.0764123946f,
+    0.221588865f, 0.581835151f, 0.358889014f, 0.762905836f, -0.112704873f, -0.365036696f, 0.716060936f, 0.763918459f,
+    0.963589489f, 0.979838371f, -0.298939556f, -0.320705354f, -0.105135597f, -0.290103704f, 0.655026495f, 0.0976548716f,
+    0.994149566f, -0.935699999f, 0.506251931f, -0.959709704f, 0.677396953f, -0.0827100202f, -0.862303138f, -0.176512778f,
+    0.297105163f, -0.640147865f, 0.958966255f, 0.488316268f, -0.520472705f, 0.203367457f, 0.728672683f, -0.692634284f,
+    0.764178634f, -0.71921432f, -0.838803768f, -0.713990927f, -0.383095026f, 0.377799243f, 0.999077976f, 0.0381756946f,
+    -0.164134279f, 0.0269924235f, 0.432252675f, 0.0222074874f, 0.85646534f, -0.549390733f, -0.522343338f, 0.434259295f,
+    0.0763352737f, 0.186701268f, 0.601032734f, -0.565329194f, -0.684058607f, -0.568711877f, 0.230502933f, -0.658570528f,
+    -0.873652101f, 0.820517838f, 0.341186583f, -0.736427546f, 0.142167255f, -0.897185683f, -0.00929711666f, -0.758850455f,
+    0.24303107f, -0.17949f, -0.944526315f, -0.0286127422f, 0.217637122f, 0.570852339f, 0.896377861f, 0.0699919313f,
+    -0.00800707377f, -0.639918327f, -0.0433545187f, 0.641177058f, 0.376196802f, -0.421561509f, 0.713794947f, -0.140120596f,
+    0.304147214f, -0.93178761f, -0.874928355f, -0.664554358f, -0.238717362f, -0.478061706f, 0.930488408f, 0.657244802f,
+    0.597290397f, 0.303681076f, 0.158100277f, 0.213906243f, 0.447187155f, 0.43445608f, 0.984475076f, -0.165412173f,
+    -0.550241709f, 0.864304841f, -0.72094804f, 0.0730799586f, -0.581440032f, -0.909722984f, 0.430938721f, -0.410383493f,
+    -0.247133732f, -0.517668009f, 0.954656124f, 0.815156996f, 0.942741811f, -0.792897165f, -0.166473195f, 0.40354839f,
+    -0.959535539f, 0.359500051f, 0.617316365f, 0.442362547f, 0.582033157f, 0.0207060985f, -0.951607823f, -0.757876635f,
+    -0.450870246f, 0.232615352f, -0.576990426f, 0.385665864f, 0.342560142f, -0.328079224f, 0.743192315f, 0.618372321f,
+    0.400095433f, 0.463342756f, 0.880786657f, -0.54412955f, 0.963866055f, 0.552653372f, -0.117522404f, -0.427214891f,
+    0.610947549f, 0.555277646f, 0.970612228f, 0.354815096f, -0.507855773f, 0.201577708f, -0.340587884f, 0.159930065f,
+    -0.844874024f, 0.464693099f, -0.826318026f, 0.801943004f, 0.321528018f, -0.897053361f, -0.928767741f, 0.550080597f,
+    -0.233441979f, -0.899966836f, 0.319853544f, 0.0364896841f, -0.263557374f, 0.911346078f, 0.70393604f, -0.19853954f,
+    0.765167773f, -0.889204502f, -0.102066278f, -0.0386317596f, -0.891947925f, -0.595270634f, -0.617595255f, -0.875190794f,
+    0.729284048f, -0.940029681f, 0.244576752f, -0.953818798f, 0.002519598f, -0.904537022f, 0.292435229f, -0.615734041f,
+    -0.381664723f, 0.2666758f, 0.87076211f, 0.0691081807f, -0.0005367173f, -0.289626032f, -0.956591129f, -0.985991776f,
+    0.722798109f, -0.315456867f, 0.132441536f, 0.766866446f, 0.875792384f, 0.649253607f, 0.37045747f, 0.413871467f,
+    -0.0841337293f, 0.600237846f, -0.943110228f, -0.727783501f, -0.0629384592f, 0.537418962f, -0.986512303f, -0.110258579f,
+    0.556884587f, 0.491081417f, -0.332855195f, 0.773051918f, -0.358831823f, 0.975501359f, 0.312499553f, -0.293412834f,
+    0.665773392f, 0.023609465f, -0.984179437f, 0.796356618f, -0.968737125f, 0.00539505156f, 0.535365164f, 0.0201161131f,
+    -0.555315733f, -0.0438174233f, 0.620304465f, -0.381795377f, -0.201240316f, -0.298618138f, -0.811424971f, 0.196037874f,
+    -0.524705648f, -0.631722212f, -0.531865537f, -0.173037529f, -0.253788054f, -0.452687889f, -0.288275599f, 0.0646025315f,
+    0.663175642f, 0.140383169f, 0.00738577079f, 0.334879756f, -0.562933981f, -0.651486397f, -0.065629296f, -0.990332782f,
+    0.869037569f, 0.991429567f, 0.972414196f, 0.925557435f, 0.133215338f, -0.851646841f, 0.237005681f, -0.0929691568f,
+    0.882085919f, -0.981540859f, 0.668570817f, 0.0134719312f, -0.335384518f, 0.873915315f, -0.4958722f, 0.874294639f,
+    -0.0440223068f, 0.115191273f, -0.506737292f, 0.963585675f, -0.699088037f, -0.0581258461f, -0.923219621f, 0.88019824f,
+    -0.962900996f, 0.543843329f, 0.430055112f, 0.686392546f, -0.84398967f, -0.119013928f, -0.583548307f, 0.160087228f,
+    -0.111892313f, -0.836856842f, -0.080234766f, -0.746542275f, -0.931611955f, 0.0705273524f, -0.772356987f, 0.714748561f,
+    -0.889767647f, 0.577807963f, 0.378801107f, -0.353977263f, 0.142651126f, -0.203985691f, -0.854746461f, -0.286548495f,
+    0.330233216f, -0.0338901021f, 0.36897701f, 0.376453996f, 0.813124895f, -0.873428881f, -0.845484912f, 0.502053022f,
+    0.913460314f, 0.369295746f, -0.0211402513f, -0.530587077f, 0.701845169f, -0.650294125f, -0.262339741f, 0.2715545f,
+    -0.344019115f, -0.247096136f, -0.900933981f, 0.919652998f, 0.0800377801f, 0.625747204f, 0.993376076f, 0.523291945f,
+    0.317463666f, -0.672427416f, 0.522647679f, 0.584204972f, -0.968589544f, 0.961687088f, 0.81601131f, -0.483936489f,
+    -0.536190629f, 0.0760291144f, 0.733060896f, 0.744043291f, 0.627125263f, -0.436960638f, -0.73850131f, -0.480263859f,
+    0.532142162f, 0.643677235f, 0.195998237f, 0.835236788f, -0.638191938f, 0.901761889f, 0.615990222f, 0.533593833f,
+    -0.161613271f, -0.490310699f, -0.630122364f, 0.342261553f, -0.744179249f, -0.0101723336f, -0.537454844f, 0.931560397f,
+    0.0689081326f, 0.943030179f, 0.0847662613f, -0.764437139f, -0.0579174459f, -0.367706627f, 0.556381285f, 0.519587517f,
+    0.0440918952f, -0.396428555f, 0.569014311f, 0.647800088f, -0.00497652311f, -0.378265798f, -0.885692418f, 0.454568475f,
+    0.692647517f, -0.99269408f, 0.0164476465f, -0.874566555f, 0.639466882f, -0.8141945f, -0.592730343f, -0.712880552f,
+    -0.806188881f, -0.892820299f, -0.157017589f, 0.828155041f, 0.985229969f, 0.905243874f, -0.26678887f, -0.913978159f,
+    -0.390895128f, -0.942818463f, 0.854621291f, 0.0440553501f, -0.683196902f, -0.345191985f, 0.0520864576f, 0.379276365f,
+    -0.889571249f, -0.160951421f, -0.397540569f, -0.374470085f, -0.93791455f, 0.649044752f, 0.25973478f, 0.103698604f,
+    -0.143259987f, -0.0428426638f, -0.97987771f, -0.186931118f, 0.052812241f, -0.681832969f, 0.348470032f, 0.412714422f,
+    0.445509344f, -0.336644977f, 0.349266142f, -0.652267277f, -0.92173183f, -0.811223984f, -0.426044613f, 0.304838091f,
+    0.455278218f, -0.587277591f, -0.556697726f, 0.0966292098f, 0.324612051f, 0.685370862f, 0.162264392f, -0.236772582f,
+    -0.742432237f, -0.151683718f, 0.250413269f, 0.922686636f, -0.605621457f, 0.197588965f, -0.0643456057f, 0.204189897f,
+    -0.302947521f, -0.205843806f, -0.857012212f, -0.178735048f, -0.274102092f, -0.378907382f, -0.127804622f, -0.452524245f,
+    -0.384105027f, -0.506535411f, 0.812031686f, -0.853693068f, -0.293298721f, -0.648564816f, -0.334179848f, -0.760679781f,
+    0.404766738f, 0.849770069f, -0.388539702f, 0.886394739f, -0.8935076f, -0.890829384f, -0.910303473f, -0.0449878909f,
+    -0.205112636f, 0.481941521f, -0.0945329592f, 0.525185704f, 0.600089908f, 0.761711299f, -0.390298575f, 0.694439232f,
+    -0.183848873f, 0.410514504f, 0.368986338f, 0.222355008f, 0.350902677f, 0.297477961f, 0.20891118f, 0.894814014f,
+    -0.634496629f, 0.690455616f, -0.696290851f, 0.469914734f, -0.812427282f, -0.172595292f, 0.169973418f, -0.830225885f,
+    -0.528969049f, 0.229376674f, 0.587970972f, 0.178736448f, 0.836684346f, 0.743777573f, -0.835020185f, -0.0416146293f,
+    -0.405825585f, 0.952432215f, 0.945238233f, 0.738051355f, 0.750432611f, -0.234219521f, -0.190764338f, -0.327820748f,
+    0.115698703f, 0.616818428f, 0.228710949f, 0.0729586557f, -0.33550781f, -0.873097658f, -0.705598891f, -0.771481216f,
+    -0.926818967f, -0.381954521f, 0.626167417f, -0.931946158f, -0.0711214468f, 0.0230273418f, 0.895740092f, -0.65478313f,
+    -0.39216885f, -0.566486657f, -0.219855845f, -0.953082681f, 0.792677581f, 0.618671179f, -0.396633059f, 0.990599215f,
+    0.369241208f, 0.0949027315f, 0.720576584f, -0.666646123f, 0.0599519238f, 0.0114876088f, -0.651011825f, -0.931103826f,
+    -0.874845266f, 0.21231471f, -0.540122688f, -0.00837425888f, -0.119609378f, -0.126232535f, 0.87185216f, 0.778527021f,
+    0.211053595f, 0.165274575f, -0.0258989092f, 0.651293457f, -0.645554781f, 0.655896008f, -0.298594624f, 0.336850762f,
+    0.869354129f, -0.588745475f, -0.923993587f, -0.842436552f, -0.554138601f, -0.759817839f, 0.193796203f, 0.377966821f,
+    0.874908566f, 0.372855932f, 0.287123293f, 0.674354613f, -0.701533139f, 0.383332014f, -0.402632654f, 0.0434166864f,
+    0.702323079f, 0.089678809f, 0.631337047f, -0.347948313f, 0.76704514f, 0.281682432f, -0.895163119f, 0.723127067f,
+    -0.92109406f, -0.58326149f, -0.975072145f, 0.462893426f, -0.276220173f, 0.502336204f, 0.256293982f, 0.754482687f,
+    0.992003322f, -0.838817656f, 0.677188754f, 0.603876948f, -0.335322827f, -0.854525805f, -0.353340536f, 0.0762171298f,
+    -0.806589186f, -0.945493698f, 0.690484703f, -0.241452694f, -0.957585514f, 0.0714654848f, 0.718080878f, -0.980723798f,
+    0.254701257f, -0.1298455f, 0.951359212f, -0.239353538f, 0.540552974f, 0.601301849f, -0.152655035f, 0.321802109f,
+    -0.86351496f, -0.331750631f, -0.281518281f, 0.793545365f, 0.896594942f, -0.504338622f, 0.082275711f, -0.114726864f,
+    0.759678066f, -0.964956641f, -0.131424055f, -0.360499233f, 0.338239551f, 0.793952346f, -0.793251812f, 0.792665482f,
+    0.284815609f, -0.594306648f, 0.500669181f, -0.474116296f, -0.681933761f, 0.440366477f, -0.788249373f, 0.931286156f,
+    -0.564319074f, -0.142757595f, 0.140133858f, 0.685787201f, -0.620705307f, -0.816046178f, -0.62954092f, 0.0127421748f,
+    -0.9860816f, -0.951519787f, 0.935721815f, -0.171145976f, -0.846372962f, 0.987911344f, 0.850521505f, -0.122831702f,
+    0.486190498f, 0.476408392f, -0.978194416f, 0.195081711f, -0.516413331f, -0.520855784f, -0.795249045f, 0.66742599f,
+    -0.263286054f, -0.273642927f, -0.685503542f, 0.681531906f, -0.310070843f, -0.451884598f, 0.874765277f, -0.533467591f,
+    -0.0433404185f, 0.91594404f, -0.536422312f, 0.126782462f, 0.199148938f, -0.757235646f, 0.446357429f, -0.944118798f,
+    0.321614265f, 0.122143656f, 0.765944362f, 0.395948768f, 0.665276408f, 0.809610069f, 0.437927127f, 0.74537605f,
+    0.279739141f, -0.86477387f, 0.748414159f, -0.261567533f, -0.3078731f, -0.185784861f, -0.822803438f, 0.463957995f,
+    -0.0461768359f, -0.258063227f, 0.574333131f, 0.0235625301f, -0.546672106f, -0.233985022f, -0.288152456f, 0.545530915f,
+    -0.530453503f, 0.805718124f, 0.838435292f, -0.198049203f, -0.419113129f, 0.838040233f, -0.268038034f, 0.490701169f,
+    -0.878238142f, 0.477149129f, 0.0153224617f, -0.693484962f, 0.696491539f, 0.200017259f, -0.313933134f, -0.394667119f,
+    0.549982369f, -0.843101084f, 0.472855121f, -0.187006235f, -0.745780468f, 0.328385085f, 0.601979554f, 0.510319293f,
+    0.942095637f, 0.214995205f, 0.865160644f, 0.0672501326f, 0.889408767f, -0.853975236f, 0.286509186f, -0.995841563f,
+    0.580205739f, 0.122394122f, 0.85408181f, 0.757276773f, 0.375789821f, -0.519637227f, 0.359393597f, 0.46819523f,
+    0.745775521f, -0.794803858f, -0.0784108564f, -0.752473235f, 0.0570354052f, -0.4972395f, 0.880164862f, -0.371541709f,
+    0.0925003663f, 0.72284317f, -0.161670923f, -0.872808456f, 0.845931888f, -0.209936097f, 0.941589892f, -0.544816554f,
+    -0.148949444f, 0.431049287f, 0.463405818f, 0.227960706f, -0.706065714f, -0.189114422f, 0.0338158011f, -0.323012292f,
+    -0.751744568f, -0.763841867f, 0.641470492f, 0.717984021f, -0.865491092f, 0.372002244f, 0.837161839f, -0.579788923f,
+    0.780847132f, 0.593959868f, 0.0367484763f, -0.858089626f, -0.777450204f, 0.177105457f, 0.148318633f, 0.998622894f,
+    -0.916813314f, 0.395615458f, -0.987382591f, -0.692202389f, 0.639863074f, -0.845500827f, 0.850472987f, 0.48195979f,
+    -0.824604213f, 0.455140948f, 0.332441002f, -0.656890392f, 0.672268331f, -0.726239741f, -0.102587998f, 0.400615722f,
+    0.198375911f, 0.929324806f, -0.594637454f, 0.720985413f, 0.325216085f, 0.351099223f, -0.979236364f, 0.998422384f,
+    -0.429148763f, -0.255948693f, -0.236273259f, 0.249931574f, 0.146560863f, 0.62298876f, -0.992336869f, -0.879811406f,
+    -0.805049062f, -0.965565443f, -0.331356257f, -0.0547288246f, 0.367002487f, 0.0097404439f, 0.126462162f, -0.0862271637f,
+    0.99409759f, 0.725001276f, -0.862336218f, 0.988886058f, 0.699450791f, 0.22177957f, 0.922682881f, 0.703926802f,
+    -0.884643972f, -0.880719483f, -0.547146618f, 0.496985704f, 0.455486357f, -0.731938601f, -0.806046963f, -0.039188344f,
+    -0.21448724f, -0.443127453f, 0.604939401f, -0.297869951f, 0.442049772f, 0.593726218f, -0.689144611f, -0.33005321f,
+    -0.965967536f, -0.310527295f, -0.27870965f, 0.41272977f, 0.360204786f, 0.088429004f, -0.181575179f, -0.0736430064f,
+    -0.630999863f, -0.344392419f, 0.541040719f, 0.874094427f, 0.517733037f, 0.602594078f, -0.0565368645f, -0.767146349f,
+    0.659856975f, -0.321243286f, 0.306196243f, -0.775047243f, 0.866007864f, 0.579818487f, 0.834784031f, 0.5725407f,
+    -0.137590021f, 0.0336287729f, -0.825286269f, -0.683795214f, 0.779294133f, 0.825969577f, -0.454681009f, -0.709483325f,
+    0.125242084f, 0.893636227f, -0.221031055f, 0.623134494f, 0.644451261f, 0.573592126f, 0.79712975f, -0.556762278f,
+    0.0103803761f, -0.273176104f, -0.0553908125f, 0.662859738f, 0.862950146f, -0.740243435f, -0.436608911f, 0.103094645f,
+    0.479414791f, 0.712545216f, 0.792067468f, 0.628185451f, 0.252036244f, 0.641646206f, 0.671135247f, -0.761448741f,
+    0.805814683f, 0.903769732f, 0.693599224f, 0.507306814f, 0.589642525f, -0.860965729f, 0.0426076874f, 0.675023556f,
+    0.427228361f, 0.382291734f, -0.705493093f, -0.534255147f, 0.305457175f, 0.0936219767f, -0.271382838f, 0.888346016f,
+    0.578092158f, 0.733837426f, -0.20386906f, 0.447103351f, -0.200180009f, 0.713314414f, 0.211454853f, -0.978853345f,
+    -0.109064959f, -0.826594651f, 0.522324204f, -0.549070001f, 0.481587499f, -0.39279139f, -0.188260362f, -0.826490641f,
+    0.516697288f, 0.460338682f, -0.0748287067f, -0.831291258f, -0.23418197f, -0.198702589f, -0.527956069f, 0.894751847f,
+    0.930561721f, 0.477329969f, 0.0843893811f, -0.0855672807f, 0.124838576f, 0.0192332417f, -0.862481892f, -0.665311933f,
+    -0.684931397f, 0.156925693f, -0.214675546f, 0.305922091f, -0.867270768f, -0.12141104f, 0.940335989f, 0.248932481f,
+    -0.316320837f, -0.349229157f, -0.663321316f, -0.785009861f, 0.0761715323f, -0.869339347f, 0.134238735f, -0.863210917f,
+    -0.0983089432f, 0.807556093f, 0.794499934f, -0.361050546f, 0.09601897f, 0.255253881f, -0.127850324f, 0.723614097f,
+    -0.314905763f, -0.906440377f, 0.467330843f, -0.265319824f, 0.506292939f, -0.376642793f, -0.975411236f, 0.101286158f,
+    -0.62479955f, 0.902473629f, -0.561784744f, 0.522648692f, -0.103622183f, -0.355577439f, -0.426233947f, -0.0162959378f,
+    0.701587796f, 0.575316072f, 0.413332015f, 0.558812916f, 0.818114817f, -0.351023048f, 0.260256499f, 0.947375f,
+    0.628072977f, -0.760729671f, -0.945924461f, 0.280346274f, -0.0648507029f, -0.276863515f, 0.805196285f, -0.800982058f,
+    0.333624184f, -0.259405077f, 0.689176977f, -0.433585852f, -0.723544538f, 0.255035877f, 0.340249062f, 0.770994723f,
+    -0.857918084f, -0.45918262f, 0.703457832f, -0.154411241f, 0.159502193f, -0.837249815f, -0.89526701f, -0.882969499f,
+    0.273821235f, 0.949741125f, -0.394821346f, 0.686802924f, -0.220211416f, -0.802961588f, -0.566965163f, 0.391435683f,
+    0.747313082f, 0.941179991f, -0.480812341f, 0.696275592f, 0.354133934f, 0.343026578f, -0.483082831f, 0.945554674f,
+    -0.579164267f, 0.995313823f, -0.439080775f, 0.775624216f, -0.245522708f, -0.740929365f, 0.285041183f, -0.338199645f,
+    0.0192662124f, 0.0105912732f, -0.996881127f, -0.158528879f, 0.429623425f, -0.00187844352f, -0.332213491f, -0.919433057f,
+    0.0313504487f, 0.720540702f, -0.836807251f, 0.666083813f, -0.600949347f, -0.121016547f, -0.108509772f, -0.364924908f,
+    -0.226839557f, 0.0706755891f, 0.464925289f, 0.163840666f, 0.200180143f, -0.98124218f, -0.395572931f, -0.155372709f,
+    -0.626742601f, -0.414386958f, -0.111609012f, 0.609514236f, 0.710325539f, -0.991336048f, -0.536948919f, 0.540513456f,
+    0.0311133564f, 0.990935802f, -0.0308887959f, -0.226123691f, -0.0151874162f, 0.142925769f, -0.549476743f, -0.190812647f,
+    -0.479348958f, 0.320749104f, 0.0673373044f, 0.433396727f, 0.376449883f, -0.095861569f, -0.479242265f, 0.73571527f,
+    0.23381497f, -0.516227663f, -0.473823756f, -0.931204438f, -0.394343138f, -0.317537248f, -0.725106716f, -0.467400312f,
+    0.0457146354f, 0.776865482f, 0.0866807178f, 0.780257225f, -0.606797993f, 0.675532401f, -0.931076229f, 0.654315233f,
+    -0.239412054f, -0.58529526f, -0.370557934f, -0.465244979f, 0.480025649f, -0.462989151f, 0.324373126f, 0.347857684f,
+    0.126465529f, -0.335623831f, -0.44615379f, 0.234587863f, -0.505260468f, -0.505917549f, 0.30151245f, -0.146637797f,
+    0.972869098f, -0.0707064047f, 0.0613765381f, -0.637481272f, 0.477887124f, -0.0246591289f, -0.482216656f, 0.307005972f,
+    -0.403388709f, 0.00576671306f, -0.899439573f, -0.32601735f, -0.0856746286f, -0.532606184f, 0.794386387f, -0.911821842f,
+    -0.103205301f, -0.723797262f, -0.31052047f, 0.863369942f, -0.671632826f, -0.66468966f, 0.186247438f, 0.82198298f,
+    -0.0886653885f, -0.890474439f, -0.138666317f, -0.217013642f, -0.183559656f, 0.163018495f, 0.745476186f, -0.458973825f,
+    0.67509526f, 0.813453853f, 0.898839593f, -0.362846911f, -0.994414747f, -0.561348736f, -0.428488165f, 0.245779395f,
+    -0.759445786f, -0.988870502f, 0.259371489f, 0.885041714f, -0.0594034605f, -0.137709841f, -0.231642187f, 0.175911888f,
+    -0.0044557862f, 0.335740864f, -0.0885264874f, -0.689647317f, 0.851065993f, 0.824847698f, 0.694688439f, -0.280488759f,
+    0.438325852f, -0.53518784f, 0.649653435f, 0.280047029f, 0.460762709f, -0.368810534f, 0.482098699f, -0.227042496f,
+    0.716565132f, -0.766531527f, 0.756202042f, -0.589260459f, 0.115958326f, 0.111542434f, 0.524430335f, 0.271223187f,
+    0.33362031f, 0.788689792f, 0.0993724093f, -0.531444907f, 0.22697942f, 0.0491693839f, -0.188619897f, 0.125331417f,
+    -0.586437523f, 0.749914944f, -0.175718114f, 0.700929642f, -0.0522155501f, 0.613518059f, -0.29065755f, 0.929742932f,
+    -0.24166587f, -0.451775789f, 0.40123871f, 0.0143114394f, 0.202440828f, -0.40137136f, 0.751333594f, -0.425036311f,
+    0.37247777f, 0.434171647f, -0.705895662f, -0.864771068f, 0.406940907f, -0.0867797658f, -0.0510514602f, 0.515962899f,
+    0.196221456f, -0.943175435f, -0.422627091f, -0.411204517f, -0.0338724442f, -0.240298167f, 0.608276606f, -0.941301703f,
+    -0.350329965f, -0.54375726f, 0.0464050956f, -0.143088579f, 0.532572687f, 0.063536346f, 0.463897943f, -0.241626054f,
+    0.988649845f, -0.545106888f, -0.420957536f, -0.446337074f, -0.176387757f, 0.564084411f, 0.891407013f, -0.487101316f,
+    -0.57853049f, 0.402731568f, -0.787628829f, 0.837851882f, 0.888379037f, 0.414718628f, -0.847750604f, 0.792535841f,
+    -0.456886441f, -0.897548437f, -0.286791533f, -0.414235383f, -0.16689305f, 0.018412767f, -0.327797443f, -0.995539308f,
+    0.964444458f, -0.837717414f, -0.350243807f, -0.1669873f, -0.349433482f, 0.202373788f, -0.14796406f, -0.215788618f,
+    0.0118242968f, 0.0602531284f, 0.635130703f, -0.666940391f, 0.429566145f, 0.645600736f, 0.173146009f, -0.675685167f,
+    -0.500409484f, -0.652571201f, -0.279419243f, -0.445363343f, 0.749315619f, 0.129323825f, 0.266858786f, -0.912022293f,
+    -0.183483973f, -0.203507811f, 0.135246888f, -0.574698508f, -0.907563269f, -0.278653711f, -0.618340373f, -0.0196187217f,
+    -0.284076333f, 0.992077053f, -0.969796062f, 0.955245912f, -0.248350963f, -0.148501262f, 0.55314815f, 0.00725387782f,
+    -0.921964526f, 0.222948685f, 0.316870868f, 0.450695306f, -0.313097119f, -0.150490671f, 0.379020363f, -0.448454261f,
+    0.997245908f, -0.497739524f, 0.241392747f, 0.390785843f, -0.142647341f, -0.177381486f, 0.432299256f, 0.0649981573f,
+    0.235256881f, -0.286962748f, -0.0602494664f, -0.246529073f, -0.994055748f, 0.167982593f, 0.664083302f, -0.919651449f,
+    -0.0012065589f, 0.826160192f, -0.16956009f, -0.367467195f, 0.788925052f, 0.264316648f, -0.775018573f, 0.00229138625f,
+    -0.0624374785f, 0.59838593f, 0.934633851f, 0.158494949f, -0.531861365f, 0.581702828f, -0.541813731f, -0.629701376f,
+    -0.0209277105f, -0.609009624f, 0.23337239f, 0.0490990095f, 0.473109394f, 0.00338413101f, -0.0309741106f, 0.626912713f,
+    -0.0196959712f, -0.0840429813f, -0.964994729f, 0.772387922f, -0.338740855f, -0.115621939f, 0.526317298f, 0.327079922f,
+    -0.653780997f, 0.0233843382f, -0.971785963f, -0.882254601f, 0.842075706f, -0.321127504f, 0.913764834f, 0.886360765f,
+    0.252810657f, 0.617031574f, 0.40335229f, -0.0268752985f, 0.569286764f, 0.0111725191f, 0.498820305f, 0.548192024f,
+    -0.672934413f, 0.21869573f, -0.633827388f, -0.830417871f, 0.215913892f, -0.549101591f, 0.615171254f, -0.913728356f,
+    0.714037836f, 0.471016735f, 0.0421553366f, -0.394063771f, 0.281095028f, 0.959512889f, 0.131731808f, 0.137204021f,
+    0.700908422f, -0.93261534f, -0.567323327f, 0.810523272f, -0.0551104397f, -0.613079011f, 0.587720633f, 0.828524232f,
+    -0.752494752f, -0.550471365f, -0.758749068f, 0.811724901f, 0.132880405f, -0.277064621f, 0.973150671f, -0.9316715f,
+    -0.61564368f, 0.246137783f, 0.460639626f, 0.182116821f, -0.638673902f, -0.257765532f, 0.699910939f, 0.79813081f,
+    -0.56720078f, 0.572303712f, -0.849652767f, -0.250533789f, -0.895948827f, 0.421201736f, 0.96019429f, -0.145274892f,
+    0.978271186f, 0.0644090027f, 0.999554992f, -0.682970524f, 0.983107865f, -0.980634868f, -0.441108942f, -0.854338944f,
+    -0.140136808f, -0.318780094f, -0.352902681f, -0.212779045f, 0.147630289f, 0.325338721f, 0.94907409f, 0.48044464f,
+    -0.674913406f, 0.897813261f, 0.667592943f, 0.336372316f, -0.124454692f, 0.0822237059f, 0.122894466f, -0.725932956f,
+    -0.908260584f, 0.421685606f, 0.310380757f, -0.594201803f, 0.511461794f, 0.325375527f, 0.92651993f, 0.498796403f,
+    -0.39443922f, 0.772887111f, 0.432651162f, 0.0891374797f, -0.314866722f, 0.323007554f, -0.327263951f, 0.862878442f,
+    0.94865644f, 0.870361984f, 0.231188297f, -0.806796312f, -0.387975425f, 0.706518173f, 0.949041665f, 0.101252928f,
+    -0.107286312f, -0.0610985532f, 0.579323888f, -0.639474988f, -0.406695992f, -0.946878731f, 0.461659551f, -0.728849113f,
+    -0.27500546f, 0.988862038f, -0.660020709f, 0.733681083f, 0.675233066f, 0.12467248f, -0.858036637f, 0.373748958f,
+    0.695447803f, -0.174806103f, -0.453685462f, 0.975807667f, -0.624176264f, -0.289270192f, 0.111319683f, -0.388124734f,
+    -0.135065436f, 0.999632061f, -0.171289936f, 0.199170545f, -0.957048535f, -0.959159672f, -0.112818658f, -0.116563804f,
+    -0.347614467f, 0.762504876f, -0.110433757f, 0.349776745f, 0.856662512f, -0.234185323f, -0.260557473f, -0.222238481f,
+    -0.342617005f, -0.466254205f, -0.61643827f, -0.182872117f, -0.47690165f, 0.871617556f, 0.253542662f, -0.869505823f,
+    -0.868327916f, -0.676519096f, 0.349139661f, -0.888538003f, -0.0777241513f, -0.14719452f, -0.709411323f, 0.888851762f,
+    0.445479184f, 0.0563755408f, 0.435181767f, -0.0145482412f, -0.196555391f, 0.53278029f, 0.545682311f, 0.120726541f,
+    -0.0137889292f, 0.382594913f, 0.849274874f, -0.448859006f, -0.0699336603f, 0.50389415f, -0.823132217f, 0.640139639f,
+    0.129698083f, 0.363462627f, -0.204127908f, -0.826540768f, -0.471684784f, 0.54896605f, -0.606909573f, -0.576881051f,
+    -0.55848664f, -0.819547772f, 0.614576876f, -0.0468446091f, 0.593856454f, 0.0907771587f, -0.7234689f, 0.419268638f,
+    0.279371738f, 0.0369906016f, 0.0859923661f, -0.342105657f, -0.615871549f, -0.632045388f, -0.459072083f, 0.650439918f,
+    0.94717139f, 0.0129810115f, 0.155344307f, -0.0362179838f, -0.835249603f, 0.0434816293f, -0.362028956f, -0.773215413f,
+    -0.0403491631f, -0.815388918f, -0.483729839f, 0.828042984f, 0.328465253f, 0.58835125f, 0.598704219f, 0.838950396f,
+    0.922229469f, -0.362078846f, 0.20702365f, 0.659218848f, 0.653436363f, 0.276622117f, 0.888991594f, -0.977741718f,
+    -0.511783481f, 0.297017515f, 0.954402328f, -0.491211444f, -0.351399302f, -0.891944706f, -0.974864066f, 0.287013978f,
+    -0.359407097f, 0.864524841f, 0.158604115f, -0.751816511f, -0.823117554f, -0.400841177f, 0.00983946491f, 0.146122128f,
+    0.733270288f, -0.908788621f, -0.321686298f, -0.418128908f, -0.0543576814f, -0.283153355f, 0.294137508f, -0.113695584f,
+    -0.444018304f, 0.207203671f, 0.202321842f, -0.825460732f, -0.0554134808f, 0.741687834f, -0.956113279f, 0.494591445f,
+    0.356245995f, -0.534297764f, -0.34997642f, 0.0520284399f, 0.203087479f, -0.873800457f, -0.0468723401f, -0.778565466f,
+    0.306240916f, 0.564438403f, -0.435318798f, 0.569733262f, -0.559298635f, -0.816284835f, 0.655609071f, 0.616451502f,
+    -0.603245556f, -0.0284571014f, -0.349508584f, 0.118479408f, -0.469752014f, -0.449800372f, 0.352456152f, -0.165268362f,
+    0.587929845f, 0.463173985f, -0.23552537f, 0.00833832938f, -0.833031118f, -0.347516865f, -0.599647105f, -0.900080025f,
+    0.689381659f, 0.593745053f, -0.421755135f, 0.34338221f, 0.479333639f, -0.319083512f, -0.707701504f, -0.700006485f,
+    -0.525053561f, 0.294182003f, 0.0978824943f, 0.0654448122f, -0.576226294f, -0.669584632f, 0.886448503f, -0.6793648f,
+    0.0517399125f, 0.501147449f, -0.106454045f, 0.167790115f, -0.332829893f, 0.838607967f, 0.133631945f, -0.0527472794f,
+    -0.0495083109f, -0.122728772f, -0.614111841f, -0.714273214f, 0.38882789f, -0.149473518f, 0.221419603f, -0.146704972f,
+    0.076845713f, 0.867713332f, 0.313092381f, -0.86855793f, -0.877570093f, -0.86445719f, 0.230100974f, -0.337695569f,
+    0.902543604f, 0.0367455371f, 0.119378373f, -0.556200743f, -0.774002433f, -0.169326648f, -0.790085912f, 0.582578719f,
+    0.926730633f, -0.968311131f, -0.800920844f, -0.141948327f, -0.257404894f, 0.389620185f, -0.653113604f, -0.395582318f,
+    -0.653289974f, -0.630335629f, 0.446252704f, -0.436513692f, -0.99497956f, 0.812736154f, 0.288737535f, -0.587925255f,
+    -0.443576336f, -0.08364591f, 0.287598521f, 0.66953367f, 0.641038537f, -0.576081038f, 0.930017352f, 0.693944514f,
+    0.920369565f, 0.585654616f, 0.832340598f, -0.863507509f, -0.734533191f, -0.206892103f, 0.91607064f, 0.350686371f,
+    -0.429008812f, 0.31016326f, -0.591512442f, -0.994581819f, 0.084554866f, -0.708506405f, 0.464298904f, -0.158582062f,
+    -0.101055838f, -0.762429118f, 0.0757942572f, -0.844316065f, -0.606197357f, -0.841426909f, 0.339718699f, 0.387075692f,
+    -0.978559673f, -0.641126633f, 0.82980144f, -0.338654757f, -0.535460472f, -0.0935318023f, -0.517204046f, 0.286505252f,
+    -0.100290395f, -0.176562339f, -0.566521406f, 0.0487356335f, -0.51683265f, 0.0963413566f, -0.786814988f, -0.103811257f,
+    0.516308129f, 0.374113768f, -0.314106345f, -0.783270538f, -0.11932376f, -0.136527508f, 0.425309181f, -0.0165212471f,
+    -0.729762554f, 0.107335776f, 0.159369022f, 0.77325964f, -0.517900288f, 0.637539744f, 0.0648327321f, -0.767333567f,
+    -0.744998991f, 0.139218077f, 0.773386776f, 0.850659192f, 0.799810648f, 0.510817826f, 0.490679473f, 0.359858572f,
+    -0.803442597f, 0.744075477f, -0.658812702f, 0.430537283f, -0.741584301f, 0.257116586f, -0.423199654f, 0.748829484f,
+    -0.658391058f, -0.257194519f, 0.460640401f, -0.0405333638f, -0.693026304f, -0.540491164f, -0.260386258f, -0.74551332f,
+    0.918489635f, 0.0682992041f, 0.924146354f, 0.375378191f, 0.959953785f, 0.546354234f, 0.381646484f, 0.790629685f,
+    -0.223973066f, -0.829680562f, 0.984254599f, -0.936529517f, 0.986884773f, 0.703118205f, -0.839124262f, -0.604876935f,
+    0.23002328f, 0.662530243f, 0.054536514f, 0.78260833f, 0.999411166f, 0.454704583f, 0.242781982f, 0.162702456f,
+    0.750255167f, 0.984721184f, 0.84692508f, -0.541996539f, 0.232866332f, -0.398764163f, -0.452648491f, 0.722426414f,
+    0.661337256f, -0.111360058f, -0.772204876f, 0.921436846f, -0.48199302f, -0.699864268f, -0.374195963f, -0.783019662f,
+    0.296620637f, -0.704146922f, -0.264569789f, -0.034986563f, 0.232579932f, -0.926691473f, 0.0267217029f, -0.385036021f,
+    -0.916745067f, 0.460289747f, 0.999328613f, -0.936398387f, -0.693861902f, -0.746974409f, -0.579035342f, 0.620653272f,
+    0.763433814f, -0.637153327f, 0.684285879f, -0.760495961f, -0.831933737f, -0.0784258917f, 0.720844328f, 0.691959679f,
+    0.812665999f, -0.246870697f, -0.547476888f, 0.771736503f, 0.945864558f, -0.743303061f, 0.849337518f, -0.476987958f,
+    0.769995332f, -0.240347728f, 0.593002677f, -0.766239285f, -0.451159954f, -0.614446938f, -0.620785177f, -0.0880487561f,
+    -0.699930847f, -0.200766712f, 0.185428545f, -0.46038413f, -0.288285345f, 0.872668147f, 0.135078028f, 0.346757174f,
+    0.728720605f, -0.660012305f, 0.0586499423f, -0.341680914f, 0.804033577f, -0.734769881f, -0.633277476f, 0.290704399f,
+    0.332470894f, -0.874394059f, -0.498680085f, 0.108472437f, -0.0205593593f, 0.896076977f, 0.503645003f, -0.527121425f,
+    -0.643438041f, 0.415102452f, -0.527311563f, 0.445091188f, -0.0748715028f, -0.825269461f, -0.583845019f, 0.138501465f,
+    0.802033603f, 0.918192267f, 0.93441391f, 0.699511945f, 0.664135456f, 0.799702525f, 0.653304458f, 0.382592529f,
+    0.819047689f, 0.970835149f, 0.40486607f, 0.8834638f, -0.505704522f, 0.996105731f, 0.271937221f, -0.125190884f,
+    0.604624331f, -0.581124008f, 0.0561727844f, -0.836903155f, -0.644437373f, -0.438880384f, -0.386330277f, -0.0800028741f,
+    -0.902046382f, -0.875327706f, -0.902588964f, 0.847700894f, 0.118039586f, -0.528060317f, -0.05641675f, 0.278268188f,
+    -0.902968287f, -0.136586294f, 0.991944849f, 0.151180342f, -0.37687397f, -0.878422439f, 0.7182464f, 0.993992209f,
+    0.10029152f, -0.323532671f, -0.227828369f, -0.314826399f, -0.537001431f, -0.97685498f, -0.894798934f, 0.847670436f,
+    0.514333487f, -0.973036647f, -0.87269026f, 0.451845139f, -0.44762814f, 0.306302756f, -0.553816795f, 0.946380377f,
+    -0.965200484f, 0.175842062f, -0.905078471f, -0.624142647f, 0.262068182f, 0.0771082118f, -0.504658282f, -0.118510902f,
+    -0.19330968f, -0.706453979f, 0.254028201f, -0.914009631f, -0.827540934f, 0.837867975f, -0.537459552f, 0.385278553f,
+    0.845683932f, -0.620813251f, -0.411429942f, 0.348774165f, -0.209980443f, 0.445768237f, 0.915076733f, -0.315958828f,
+    -0.14308688f, 0.280452728f, -0.867649972f, -0.16002138f, 0.426344514f, 0.558723927f, -0.873400152f, -0.360853374f,
+    0.833792031f, 0.273175508f, -0.515186906f, -0.341021627f, 0.0147699267f, -0.497312158f, -0.249376625f, 0.226170033f,
+    0.188083678f, 0.792478681f, 0.805168927f, 0.471471667f, -0.684172988f, 0.156956792f, -0.169404551f, 0.660857797f,
+    0.195433691f, -0.461722106f, -0.091288276f, 0.827040315f, 0.978218079f, 0.0458864532f, 0.825309813f, -0.887465298f,
+    0.738076746f, 0.103097908f, 0.422526449f, -0.299835086f, -0.41927883f, 0.688188255f, 0.137311459f, -0.706540048f,
+    0.889944732f, 0.338147432f, 0.0282208342f, -0.0824069902f, 0.738489032f, -0.0153033519f, -0.771082461f, -0.491579115f,
+    -0.871627271f, 0.991102576f, -0.350181729f, 0.0468124449f, 0.637928724f, 0.123287886f, -0.742998838f, -0.942039967f,
+    0.97630322f, -0.464468211f, 0.567948878f, -0.897672772f, -0.208821595f, 0.551171601f, 0.0625914335f, -0.294259846f,
+    0.674494386f, -0.500329912f, 0.332250476f, 0.748299062f, 0.409754008f, -0.45421201f, -0.178726494f, -0.234160975f,
+    -0.284144014f, 0.0257955492f, 0.547178805f, -0.389529794f, 0.653649986f, -0.718480349f, 0.963496745f, -0.178631499f,
+    -0.47555244f, 0.882675231f, -0.316008031f, 0.202366456f, 0.308985949f, -0.300761878f, 0.286561519f, -0.36051479f,
+    0.641328514f, 0.519644499f, 0.155479416f, 0.62051481f, -0.258024663f, -0.168072298f, 0.819649279f, 0.949593842f,
+    0.23519595f, -0.880811572f, 0.573639154f, -0.244519278f, 0.79223156f, -0.805086553f, 0.37667191f, 0.266066819f,
+    0.87922895f, 0.17061919f, -0.827155054f, -0.794326067f, -0.927359343f, -0.292935878f, -0.854423165f, 0.217622221f,
+    -0.607067049f, -0.161417708f, 0.550861478f, 0.710308731f, -0.735304713f, -0.387486637f, 0.816511035f, 0.973903477f,
+    0.89345479f, 0.307248116f, 0.72374326f, -0.598806798f, -0.577149689f, 0.482788175f, -0.846867144f, 0.44490087f,
+    -0.986192167f, 0.000568916264f, 0.741921246f, -0.818089068f, -0.610012591f, -0.122069828f, 0.52570641f, -0.73224622f,
+    0.679254472f, -0.181023806f, 0.120731048f, 0.369326591f, -0.477885336f, -0.214431301f, -0.271490604f, -0.402374774f,
+    0.847331345f, 0.667557597f, 0.0928629264f, 0.112666935f, 0.299383968f, 0.504311681f, 0.272923172f, -0.953496397f,
+    -0.690876067f, 0.513768733f, 0.735848248f, -0.909931064f, 0.596887171f, 0.437065959f, -0.574324727f, 0.0420503169f,
+    -0.0932806954f, -0.238632306f, -0.967635334f, -0.117686495f, 0.491552472f, -0.26444602f, -0.462789446f, 0.609744787f,
+    0.575967252f, 0.934954584f, -0.23026067f, 0.71884042f, 0.620982647f, 0.620382011f, -0.977311969f, -0.754558384f,
+    0.915783048f, -0.861692071f, 0.897618294f, -0.276249707f, 0.482620299f, -0.489589661f, -0.34364602f, -0.349262476f,
+    -0.164624006f, -0.9905954f, 0.872858584f, -0.583436549f, -0.18464072f, -0.70425123f, 0.6599226f, -0.60992676f,
+    -0.21623607f, -0.310839564f, -0.32098794f, 0.640185893f, -0.889216661f, -0.00781559292f, 0.00214734627f, 0.15047498f,
+    -0.339926571f, 0.247985289f, 0.219677716f, 0.52195704f, 0.806831062f, -0.172692433f, 0.708583295f, -0.678421557f,
+    -0.935957849f, -0.616418362f, -0.056213636f, -0.219593078f, -0.431664556f, 0.712905765f, 0.204509556f, 0.626434088f,
+    -0.819663107f, -0.331393689f, -0.635687649f, 0.237201408f, -0.723463058f, 0.92989552f, 0.867883384f, -0.145059153f,
+    0.962794602f, 0.164493605f, 0.887848496f, 0.974966705f, -0.422107816f, 0.856862783f, 0.54486388f, -0.896037042f,
+    0.146749094f, -0.914052844f, 0.780520678f, 0.846149325f, -0.293603361f, -0.676824331f, -0.980157912f, 0.217764452f,
+    -0.668939471f, 0.306599289f, -0.237911716f, 0.956510842f, -0.561593175f, -0.494897604f, 0.140482262f, 0.747821987f,
+    -0.190092027f, 0.829662859f, -0.655215383f, -0.457437694f, -0.751072884f, -0.197961196f, 0.451160282f, 0.117460944f,
+    -0.174741983f, 0.701289535f, 0.845791519f, -0.689543843f, 0.592467308f, -0.295599729f, 0.469317615f, 0.0359192938f,
+    -0.264182389f, 0.8786695f, -0.086071372f, 0.53232193f, -0.165546119f, -0.21079877f, 0.915476024f, 0.449403137f,
+    -0.767691433f, -0.982307911f, 0.591906011f, 0.416471362f, -0.654421508f, 0.47677514f, 0.31565848f, 0.977372587f,
+    -0.845897317f, -0.180983156f, -0.196760923f, 0.984808743f, -0.528556049f, -0.289848506f, -0.363751829f, 0.462157249f,
+    -0.16205284f, 0.107657619f, -0.983185172f, -0.518703401f, -0.032204967f, -0.0933677703f, 0.651746154f, 0.772233665f,
+    0.138325661f, -0.589063644f, -0.892616212f, -0.86722976f, 0.257795036f, -0.0671861172f, -0.0441411845f, 0.354880542f,
+    0.65997839f, -0.269315541f, -0.576012313f, -0.715252459f, -0.132027671f, 0.862813652f, 0.412254542f, -0.174074128f,
+    0.827813804f, -0.19966203f, -0.818566918f, 0.00866547972f, 0.310650587f, -0.845697224f, -0.175377354f, -0.473114371f,
+    -0.361869574f, -0.663937688f, 0.371807098f, 0.441168278f, 0.675781548f, 0.614687026f, -0.233607039f, -0.576553762f,
+    0.311990708f, 0.659906805f, 0.0746786967f, -0.379121989f, 0.825755835f, -0.347465545f, 0.428110242f, -0.765696645f,
+    -0.650632679f, -0.441644996f, 0.620807052f, 0.937010109f, 0.142452672f, 0.787755787f, 0.669985116f, -0.0617237613f,
+    -0.967619658f, -0.745892406f, -0.577479064f, -0.600784481f, -0.343302995f, 0.456579775f, -0.70341444f, 0.36005947f,
+    -0.194511414f, -0.737928331f, 0.546110928f, -0.604521155f, -0.024516575f, 0.0674324855f, -0.665672302f, 0.338810354f,
+    0.139354825f, -0.182307065f, 0.155433774f, 0.920728326f, -0.583417714f, -0.521241903f, -0.112798914f, 0.46161443f,
+    -0.674211085f, -0.940104365f, 0.0373254418f, 0.2424016f, 0.593172133f, 0.77288872f, -0.693175256f, 0.096047312f,
+    -0.932280123f, 0.816813469f, 0.555283964f, -0.578078926f, -0.0725399256f, -0.496447384f, 0.0576437041f, -0.979186118f,
+    0.547251165f, 0.143697351f, -0.912524164f, -0.710152864f, 0.333470583f, 0.087747395f, 0.405114025f, 0.320517808f,
+    -0.53050828f, 0.213756725f, 0.475616425f, -0.889218271f, -0.505768061f, -0.150348499f, 0.549301684f, 0.515573084f,
+    -0.678642035f, 0.735160887f, 0.341507554f, 0.426182121f, -0.620598733f, 0.30669871f, 0.376729608f, -0.0112139015f,
+    0.10871771f, -0.996446192f, -0.242573097f, -0.0480028912f, 0.410844654f, -0.89227277f, -0.316961646f, -0.364239424f,
+    0.252734512f, -0.0845949948f, 0.59791255f, 0.495717019f, 0.405952871f, 0.0759314299f, 0.490568131f, 0.747680306f,
+    0.120882072f, 0.210038811f, 0.977613211f, -0.522936523f, -0.153083771f, 0.331806034f, 0.631789505f, -0.965214789f,
+    -0.436288267f, -0.696680725f, 0.493762076f, 0.58928889f, 0.504414439f, 0.321922123f, -0.796399415f, 0.0429301001f,
+    -0.758771956f, -0.123581074f, 0.119027652f, -0.33493498f, -0.311459512f, 0.705379426f, -0.181526884f, -0.408492953f,
+    0.993802905f, -0.521769404f, -0.73301661f, -0.275305659f, 0.737552524f, 0.0109878043f, 0.80638051f, 0.051337678f,
+    0.0633689314f, -0.618889332f, -0.918264925f, 0.892656088f, -0.139517963f, -0.128300548f, -0.700609684f, -0.374450535f,
+    0.104723625f, -0.337578624f, -0.336238742f, 0.0229499005f, -0.699128985f, -0.209815353f, -0.226638585f, -0.838141143f,
+    -0.389326811f, 0.0999975652f, 0.437778354f, 0.413243085f, -0.926045775f, 0.714927197f, -0.484569341f, 0.40340054f,
+    -0.32343787f, 0.700549901f, 0.25282225f, 0.211589649f, -0.273469537f, -0.946113348f, -0.689492643f, -0.588231921f,
+    0.604059577f, -0.159658015f, -0.925387084f, 0.0406936407f, 0.755240798f, -0.917598069f, -0.824202895f, -0.909632802f,
+    0.848902643f, -0.582367063f, -0.693980277f, -0.629867196f, -0.600985706f, 0.47029984f, -0.289190233f, -0.437813222f,
+    -0.147778273f, -0.0823618695f, -0.184774801f, -0.647361934f, 0.69063133f, -0.846616387f, 0.493881404f, -0.722778797f,
+    -0.792369425f, -0.384762079f, 0.471852869f, 0.7671808f, -0.301989853f, 0.310692877f, -0.775174618f, 0.951459706f,
+    0.890137672f, -0.503976882f, -0.564663947f, -0.668099463f, 0.141850308f, 0.812981963f, -0.635202289f, 0.82577908f,
+    0.354406446f, -0.0888492987f, -0.588002086f, -0.672042072f, -0.529450178f, 0.992686212f, -0.296346843f, 0.114675164f,
+    0.656956196f, -0.254402816f, 0.969136655f, 0.883343816f, -0.788663924f, 0.463660806f, -0.21400176f, 0.272282809f,
+    -0.193559095f, -0.427016854f, -0.353573143f, 0.184767216f, -0.546092808f, 0.160540581f, 0.323509425f, 0.481678456f,
+    0.948906839f, 0.748616278f, -0.309779525f, -0.936112046f, 0.190302864f, 0.17992115f, 0.865613818f, -0.55869329f,
+    0.291884124f, 0.352270693f, 0.574768841f, 0.0348790772f, -0.600653231f, -0.851080775f, -0.575283825f, 0.347946227f,
+    0.134284273f, 0.87302959f, 0.268511027f, 0.384141713f, 0.670579314f, -0.422160596f, -0.895593464f, 0.661382735f,
+    -0.780798316f, 0.731305599f, 0.414413571f, 0.520394087f, -0.465410709f, -0.145725921f, 0.948880851f, 0.412255555f,
+    0.475798666f, 0.256104112f, 0.821208656f, 0.492738098f, -0.708245397f, -0.0568349585f, 0.231123224f, 0.355937511f,
+    0.991652906f, 0.342484266f, 0.845875442f, 0.0568801872f, -0.9711743f, 0.245182946f, -0.613982975f, 0.428461313f,
+    -0.540465415f, -0.827841699f, 0.227304503f, 0.460662425f, -0.0656322613f, -0.605257213f, -0.844209313f, 0.0236444529f,
+    0.250999451f, -0.69169569f, 0.996646047f, -0.349198908f, -0.270269424f, -0.817532837f, -0.282628536f, -0.420980245f,
+    0.77342242f, -0.857491374f, 0.631952763f, -0.937095165f, 0.319413096f, -0.648856938f, 0.0967971906f, 0.500145912f,
+    -0.0351761356f, 0.651805937f, -0.106270067f, 0.305853724f, -0.214508384f, -0.965592623f, 0.444878846f, -0.46465227f,
+    0.479916781f, -0.911618292f, -0.242787868f, -0.1600364f, 0.377831846f, 0.169256568f, 0.82113415f, 0.859598756f,
+    0.644730806f, -0.191757455f, 0.56287837f, -0.412494421f, -0.363144755f, 0.980211496f, -0.631289542f, -0.357833534f,
+    0.112948962f, -0.352220654f, -0.935415745f, -0.947739959f, 0.663702309f, -0.523469388f, 0.156362399f, -0.0716448203f,
+    -0.804962397f, -0.615987539f, -0.423672259f, -0.973756611f, -0.31568861f, 0.339607716f, -0.709719121f, 0.673837245f,
+    -0.724065185f, 0.562874734f, -0.647607207f, 0.449623197f, -0.227817863f, 0.543391109f, -0.916490197f, -0.46305868f,
+    -0.907593668f, -0.689500332f, 0.25418371f, -0.883157134f, 0.325864106f, 0.431266397f, -0.432232827f, 0.422941297f,
+    -0.0829958245f, 0.427462667f, -0.538678348f, -0.944449842f, 0.98125273f, 0.847453654f, 0.120998666f, 0.0861372799f,
+    -0.871181786f, 0.994027555f, -0.18519251f, 0.651580811f, -0.705751777f, 0.0809941217f, -0.771958947f, -0.56080699f,
+    -0.142729804f, -0.0687497184f, -0.749475837f, 0.562251091f, 0.723429859f, -0.797940493f, 0.235788062f, 0.951932311f,
+    0.0149874287f, -0.585986793f, -0.289213628f, -0.228091627f, -0.61256063f, -0.0945268199f, 0.924857974f, -0.759912908f,
+    0.487055719f, 0.755667329f, -0.556448877f, 0.730966091f, -0.818743229f, -0.632243574f, 0.057806883f, 0.706834137f,
+    0.466979086f, 0.924209177f, -0.180217966f, 0.483204156f, -0.440893471f, -0.681362391f, 0.907675505f, 0.969404399f,
+    -0.929121137f, -0.41217187f, 0.100711934f, 0.759033144f, 0.810419858f, -0.494817913f, 0.781792223f, 0.643017709f,
+    -0.290642947f, -0.0530898049f, -0.874194264f, -0.346768856f, 0.687555671f, 0.449911088f, 0.788238525f, 0.924687982f,
+    -0.0674788058f, 0.244545758f, -0.571935833f, -0.887755632f, 0.0814778507f, 0.900035381f, -0.199383929f, 0.872886419f,
+    0.287054747f, 0.07799647f, 0.40724203f, -0.155971691f, 0.467886627f, -0.39934966f, 0.213990793f, 0.194080561f,
+    -0.785991013f, -0.955830157f, 0.846424162f, 0.608521461f, -0.159483522f, 0.1628986f, -0.587131083f, -0.844305038f,
+    -0.564254999f, 0.865466893f, 0.432488412f, 0.585879028f, 0.0589182787f, 0.958539605f, 0.793414176f, 0.936502814f,
+    0.800890923f, 0.103006154f, 0.363567978f, -0.0499020517f, -0.626931012f, 0.24730584f, 0.525366306f, -0.0173646007f,
+    -0.362385809f, -0.591913342f, -0.183429882f, -0.517913461f, 0.89078033f, 0.975479424f, -0.652320266f, 0.772460401f,
+    -0.417749673f, -0.175996467f, 0.706487477f, -0.58315134f, -0.215632007f, 0.502571166f, -0.727431893f, -0.363268465f,
+    -0.932703972f, -0.0387119539f, 0.114045933f, 0.163308442f, -0.0216337759f, -0.416040778f, 0.148132592f, 0.202177525f,
+    0.641685188f, -0.121386036f, -0.388540059f, -0.655351818f, 0.868318856f, -0.191935584f, 0.369428456f, 0.770953238f,
+    0.0434526056f, -0.976534724f, -0.682606637f, 0.801398575f, 0.310286582f, 0.88247633f, 0.836811483f, 0.272366107f,
+    -0.596736848f, -0.209629163f, 0.475832641f, -0.277205378f, 0.298565149f, 0.867110312f, -0.245580733f, -0.583084583f,
+    -0.560394883f, -0.529347062f, -0.594735384f, -0.33351779f, 0.515295267f, -0.613123238f, -0.824140072f, 0.937452078f,
+    -0.336975932f, -0.687516809f, -0.182925969f, 0.703793705f, -0.170035422f, -0.807315886f, 0.472642481f, 0.064383328f,
+    0.0238340367f, -0.907329381f, -0.595861614f, 0.243901595f, 0.0300300922f, 0.585711062f, -0.0683289096f, -0.816152871f,
+    0.938005567f, -0.621361613f, -0.693468153f, 0.379446536f, 0.985790133f, -0.71439147f, 0.473073423f, 0.125145122f,
+    -0.729617476f, 0.311292022f, -0.391912818f, -0.951360226f, -0.692764699f, 0.0466200821f, 0.563299417f, 0.296395004f,
+    -0.358523935f, -0.604764104f, 0.965288401f, 0.461616367f, 0.56653738f, -0.0699565783f, -0.368307143f, 0.0158532783f,
+    -0.0749428943f, -0.739726961f, 0.559804618f, 0.657589614f, 0.97140789f, -0.833675027f, -0.181427583f, -0.757498384f,
+    -0.732842505f, 0.354857445f, 0.821176946f, 0.350217223f, -0.422973335f, 0.129715011f, 0.122765101f, -0.929348826f,
+    0.674092591f, -0.898711681f, -0.15069972f, -0.633497179f, 0.623923242f, 0.182489023f, -0.376760453f, -0.395593822f,
+    0.609299958f, 0.467750758f, -0.869422793f, -0.289582998f, 0.695535064f, 0.70146358f, -0.113045968f, -0.606882989f,
+    -0.625219822f, 0.701073289f, -0.128967851f, 0.494988292f, 0.0234273616f, -0.33045581f, 0.386529326f, -0.992726922f,
+    0.822394788f, 0.423886001f, -0.158568338f, 0.120169468f, -0.310594559f, 0.235341609f, 0.226513565f, -0.853310645f,
+    -0.0415013544f, 0.620867372f, 0.585162461f, -0.146101743f, 0.196249634f, -0.566880584f, -0.209104359f, 0.914460301f,
+    -0.154027432f, 0.499563783f, 0.805860698f, 0.0893346146f, 0.283872783f, 0.315137923f, -0.348295867f, 0.135271728f,
+    -0.444398224f, -0.205390364f, -0.22860004f, 0.766338706f, 0.893889785f, -0.287597001f, 0.0862257034f, 0.351383507f,
+    -0.798373401f, 0.189200088f, 0.577949941f, 0.312048197f, 0.75977695f, 0.354017019f, -0.637865007f, -0.400628179f,
+    -0.680143714f, 0.781751335f, 0.790026426f, 0.732647598f, 0.443679184f, -0.746270061f, 0.430669576f, -0.365243584f,
+    0.457309425f, -0.827493846f, -0.30508855f, -0.258334637f, 0.264122337f, 0.202515587f, -0.80825752f, -0.674907327f,
+    0.845380247f, -0.0881208926f, -0.130437434f, 0.456826627f, -0.484245121f, 0.368311703f, 0.633932173f, 0.17282778f,
+    0.852522612f, 0.263239712f, 0.784016192f, -0.752072811f, -0.978526354f, -0.669526815f, -0.717422545f, -0.384360343f,
+    -0.545530081f, -0.723986685f, 0.0786195993f, -0.527712286f, 0.34058699f, 0.0226529613f, 0.748622596f, -0.325840622f,
+    -0.6532408f, -0.331647336f, -0.750272751f, 0.949479938f, -0.942514062f, 0.390496254f, -0.333739549f, -0.606753528f,
+    0.526278853f, 0.721984625f, -0.617688298f, 0.29828468f, 0.0271176621f, 0.873032451f, 0.726961434f, 0.628634512f,
+    -0.606202543f, 0.73236382f, -0.619627714f, -0.444233f, 0.619617283f, -0.0620606057f, -0.422603756f, -0.180344716f,
+    -0.0879274011f, 0.386711568f, -0.950372577f, 0.187188983f, 0.0199862402f, 0.964298844f, -0.0172102861f, 0.928723812f,
+    0.307892561f, 0.545044541f, 0.330801576f, -0.033800751f, 0.691698313f, -0.878893137f, 0.214681566f, 0.130886331f,
+    -0.974644005f, 0.54476577f, -0.681629241f, 0.72014153f, 0.535174429f, 0.637866318f, -0.508784771f, -0.597737849f,
+    0.0620355718f, -0.0165471639f, 0.0975915492f, -0.240127444f, 0.611437619f, -0.295542777f, -0.775188148f, 0.437477291f,
+    0.823712409f, -0.349594831f, 0.373432845f, 0.218015328f, -0.356692106f, 0.609587669f, 0.476321399f, 0.833053827f,
+    -0.704378128f, -0.907422125f, 0.234806031f, 0.523148417f, 0.375693142f, 0.709446609f, -0.156405985f, 0.117212653f,
+    -0.449968368f, 0.0251063257f, 0.6330598f, 0.896778822f, 0.469492048f, -0.429046363f, 0.858213782f, 0.0645098984f,
+    -0.285647631f, -0.373605341f, -0.458423465f, 0.46814999f, 0.204855472f, 0.204637289f, 0.850087643f, 0.540038764f,
+    0.563079238f, 0.426475406f, 0.741951287f, -0.225569412f, 0.378084779f, 0.359833896f, 0.38734591f, -0.205236271f,
+    -0.5008564f, -0.864623547f, 0.0430466682f, -0.414919823f, -0.132493332f, -0.53024143f, -0.156184345f, -0.799757242f,
+    -0.793393195f, -0.032407321f, 0.561017811f, 0.913347542f, 0.933362424f, -0.937556565f, 0.508575857f, 0.405647188f,
+    -0.23658891f, -0.301518202f, 0.547825515f, 0.588827133f, -0.981574893f, -0.980144799f, 0.763738155f, -0.532913327f,
+    -0.968670964f, -0.402921379f, -0.432792813f, 0.203501523f, -0.840930164f, -0.843569577f, -0.0406806879f, -0.0694891214f,
+    -0.694080055f, 0.903584838f, 0.0736500397f, 0.711674392f, 0.87905407f, 0.464417934f, -0.00701669371f, -0.320637733f,
+    -0.394053549f, 0.955183804f, -0.944869757f, -0.877173543f, 0.59698391f, -0.0404834822f, -0.231759593f, 0.727528691f,
+    -0.326167673f, 0.0518417731f, -0.986366391f, -0.654790819f, -0.855636895f, -0.824352264f, 0.184926823f, -0.96532011f,
+    -0.924456716f, -0.0543102361f, 0.345969111f, -0.588045478f, -0.755489111f, 0.965271473f, 0.9903211f, -0.278700352f,
+    0.4554196f, 0.448946625f, -0.206102714f, 0.933263063f, 0.507778287f, -0.692522347f, 0.93307054f, -0.160308704f,
+    -0.119121097f, 0.315374017f, -0.00970571022f, -0.406730115f, -0.670893013f, 0.32419312f, 0.210718244f, -0.111528061f,
+    -0.211487532f, -0.216932237f, 0.528533518f, -0.71032548f, -0.172098115f, 0.221117929f, -0.246590152f, -0.474968493f,
+    -0.555249631f, -0.157235295f, -0.880254209f, -0.0239489879f, -0.132714987f, 0.725481391f, 0.2695553f, 0.260381252f,
+    -0.0472521819f, -0.630693018f, -0.180097744f, 0.987630546f, 0.10941276f, -0.670279801f, -0.670860827f, 0.643728793f,
+    0.330392927f, 0.0294453707f, 0.998971343f, -0.723478854f, -0.739104092f, -0.457863599f, -0.137572601f, 0.270404339f,
+    -0.318978041f, 0.557529628f, 0.387060851f, 0.0665717348f, 0.204695836f, 0.954197049f, -0.889404178f, 0.936936021f,
+    -0.558729768f, 0.691854537f, 0.43125245f, 0.397273839f, 0.925456822f, -0.101926647f, 0.466100991f, 0.20141618f,
+    0.921985567f, 0.634881675f, -0.242333472f, 0.141838074f, 0.943484962f, 0.903580129f, -0.765476882f, -0.733969986f,
+    0.95290947f, 0.85577774f, 0.569779932f, 0.255682558f, 0.758365631f, -0.450997561f, 0.730046272f, -0.00986364111f,
+    0.521574736f, 0.522159934f, 0.923602283f, 0.963260889f, 0.765613377f, -0.19937183f, 0.219477758f, 0.549226642f,
+    -0.710421979f, 0.211886272f, -0.67219162f, -0.174905151f, 0.142227501f, -0.0559230931f, -0.309349477f, -0.0591768399f,
+    0.298566371f, 0.0440970212f, -0.878723979f, 0.794737399f, 0.0952543765f, -0.360514581f, -0.687007189f, 0.297644317f,
+    0.298250288f, 0.160285264f, -0.362065732f, -0.436500221f, -0.60640806f, -0.158237338f, 0.542684138f, -0.522868037f,
+    0.513046443f, 0.126819268f, 0.60668695f, 0.448502213f, 0.319939107f, 0.546068251f, -0.525945604f, 0.230551034f,
+    -0.153345823f, -0.973831415f, 0.116589069f, -0.282997787f, 0.797671318f, 0.447207421f, -0.241245791f, -0.956762195f,
+    -0.923757732f, -0.829414785f, 0.472429127f, -0.0884137601f, -0.982201934f, -0.63044107f, -0.631631494f, 0.362739921f,
+    -0.448775023f, -0.437507838f, 0.897258818f, -0.612318397f, -0.85113883f, 0.938445687f, -0.713999569f, -0.63443321f,
+    -0.478758156f, -0.312793434f, -0.641450822f, -0.259777516f, -0.197496369f, -0.00778754242f, -0.270244986f, -0.789496481f,
+    -0.718910396f, 0.440256596f, 0.226069823f, -0.786731422f, 0.332112402f, -0.298266083f, 0.821384609f, 0.362732172f,
+    0.580675602f, 0.921343923f, -0.545669675f, -0.21292223f, -0.336217552f, -0.522935927f, -0.612210512f, -0.880387008f,
+    -0.506070197f, -0.428399593f, -0.347460151f, 0.736605465f, -0.235713303f, 0.589090347f, -0.0867726356f, 0.190356717f,
+    0.585621297f, -0.357218146f, 0.794425249f, -0.257599562f, -0.980401576f, -0.0505948626f, 0.123887092f, -0.216455713f,
+    0.583030224f, -0.327545434f, -0.8435179f, -0.397552609f, -0.00884965062f, 0.328236818f, -0.329857498f, -0.116477072f,
+    -0.236935645f, -0.268214077f, 0.276852608f, -0.0637251139f, -0.839747071f, -0.176001012f, 0.453810096f, -0.436662257f,
+    0.971835434f, 0.655676484f, 0.95831126f, 0.805501521f, 0.412385941f, -0.608685374f, 0.399024487f, 0.497583002f,
+    0.184799239f, 0.344563454f, -0.81825012f, -0.766966343f, 0.366333842f, -0.455993354f, 0.355119795f, 0.246736139f,
+    0.72367537f, 0.447502196f, 0.970460296f, -0.265111178f, 0.44852078f, 0.803289354f, 0.0416988991f, -0.768454373f,
+    -0.135348111f, -0.265805602f, 0.263853401f, -0.381253749f, -0.521910906f, 0.695226371f, -0.166522458f, 0.913274169f,
+    -0.0670920163f, 0.968076348f, -0.391645819f, -0.104215972f, 0.00175985403f, 0.641721606f, 0.015256715f, -0.651495814f,
+    0.492719203f, 0.35656926f, 0.700826228f, 0.52028656f, 0.689913392f, -0.765973806f, 0.152794033f, -0.711792409f,
+    0.317009598f, 0.233795494f, -0.547860861f, 0.715536296f, -0.0593850724f, 0.19556427f, 0.936865509f, -0.802643716f,
+    0.615470171f, -0.703049302f, 0.11780332f, 0.293762624f, 0.169917226f, -0.625718713f, -0.165823072f, -0.725025535f,
+    -0.0909715518f, -0.0782420188f, -0.737102509f, -0.421007633f, -0.700722516f, 0.821102023f, -0.3754825f, -0.268777251f,
+    0.846713245f, 0.888540506f, -0.826699555f, 0.889389336f, -0.724397063f, 0.972045183f, -0.691173375f, 0.941148877f,
+    0.659045935f, -0.80869174f, -0.996369362f, -0.257399619f, -0.131143749f, -0.58267808f, -0.584745586f, -0.998704791f,
+    0.715708196f, -0.932973742f, 0.651891589f, -0.748393655f, -0.904062033f, -0.161190704f, 0.528309286f, -0.726537049f,
+    0.304240495f, -0.604342043f, 0.32108283f, -0.632000566f, 0.903792799f, 0.571294844f, -0.0402740911f, 0.452433854f,
+    0.0115995817f, 0.810099244f, 0.671257436f, 0.479863554f, -0.88662219f, -0.256107926f, -0.386323839f, 0.276975363f,
+    -0.643147528f, 0.406063259f, -0.181856111f, -0.287858516f, -0.559994578f, 0.680218756f, -0.137162849f, -0.874599755f,
+    -0.659840524f, -0.796289504f, -0.822926521f, -0.39945069f, -0.0456774235f, 0.254110605f, -0.504708409f, -0.230787963f,
+    -0.933879435f, 0.344502568f, -0.366259933f, -0.329424798f, -0.674892366f, -0.266629249f, -0.00882446766f, -0.820129097f,
+    -0.595909417f, 0.926836073f, -0.328195691f, -0.699753165f, -0.303947061f, 0.710990012f, -0.229829386f, -0.869530559f,
+    -0.187099531f, -0.468156517f, -0.110468991f, -0.391199023f, -0.678599238f, 0.177034155f, -0.319415361f, 0.836809874f,
+    -0.757421315f, -0.0411433801f, -0.244426697f, 0.651311934f, 0.564466059f, 0.531645298f, -0.28741309f, 0.75606966f,
+    -0.285798579f, -0.070920378f, 0.690200269f, 0.210590303f, -0.562879622f, 0.285809278f, -0.164753824f, 0.89306426f,
+    0.195591494f, -0.667831063f, -0.217244372f, 0.208196729f, 0.274075121f, 0.176151589f, -0.426592439f, -0.0569752008f,
+    0.209985524f, 0.917429507f, 0.23761344f, -0.107517458f, -0.484098703f, 0.0316896848f, -0.890200555f, -0.543019116f,
+    0.264602244f, 0.923314631f, -0.240315706f, -0.953698993f, 0.61523062f, 0.139444381f, 0.88245368f, 0.263074636f,
+    0.0588453077f, -0.638820171f, 0.243796036f, -0.540185809f, 0.458726019f, -0.0723826885f, -0.72163713f, 0.0632363185f,
+    -0.253042459f, -0.965867102f, -0.0788359717f, -0.553575337f, 0.208040401f, -0.298223078f, -0.919851661f, -0.501135647f,
+    0.208757907f, -0.111648746f, -0.442491442f, -0.813014925f, -0.184344783f, -0.271703392f, 0.145997018f, -0.916024864f,
+    0.888529599f, 0.501223743f, 0.274770647f, 0.0368934646f, 0.825731158f, 0.214911103f, -0.106611758f, 0.645379961f,
+    -0.813854694f, 0.731613278f, 0.202930436f, -0.470630258f, -0.288022071f, -0.129339457f, 0.895219564f, 0.313814133f,
+    0.919701099f, 0.177585006f, 0.0596362799f, 0.73659271f, 0.860997021f, 0.707853436f, 0.742241323f, -0.238924444f,
+    0.539572537f, 0.626630962f, -0.84216398f, 0.0832492933f, -0.347423732f, 0.589719832f, 0.401722729f, 0.171050504f,
+    0.463380933f, -0.356103748f, 0.0802809224f, 0.0513972938f, 0.454369545f, 0.79373616f, -0.0147773828f, 0.511326849f,
+    0.951550663f, -0.163773239f, 0.0921249911f, -0.129699051f, 0.696462929f, -0.168100849f, -0.616791427f, -0.87373668f,
+    -0.607096136f, 0.96513015f, 0.228580415f, 0.16826731f, -0.160491183f, 0.103133984f, -0.310771465f, -0.261375606f,
+    -0.529449761f, -0.303489625f, 0.988365471f, 0.0825263113f, 0.136846259f, -0.738093257f, -0.288479954f, 0.573089659f,
+    0.712160707f, -0.101750016f, 0.568695843f, -0.299715102f, -0.215188429f, -0.601156652f, 0.919116139f, -0.616849542f,
+    -0.790457487f, -0.877531171f, -0.739281178f, 0.117310666f, 0.689356089f, 0.328436941f, 0.42448467f, -0.201267064f,
+    0.1939639f, -0.495566905f, 0.3234635f, 0.443388015f, -0.236401305f, 0.393757671f, -0.0622468852f, -0.935621917f,
+    0.577296138f, -0.154101625f, -0.770658493f, -0.19345583f, 0.0718617439f, 0.629991591f, 0.392056167f, -0.689177334f,
+    0.175728947f, -0.394630909f, -0.581336856f, -0.686881185f, -0.459567964f, -0.715999186f, -0.543159902f, -0.930857301f,
+    -0.462543935f, 0.241160765f, -0.389109194f, -0.226913288f, 0.893879771f, -0.359724343f, -0.24349238f, -0.0466180928f,
+    -0.109798171f, 0.518757343f, 0.012304944f, 0.0972571224f, 0.88822335f, -0.471890807f, 0.000604329281f, 0.905115366f,
+    -0.383256555f, 0.29055208f, 0.0577958003f, 0.22450231f, -0.979658604f, -0.542739749f, -0.762387872f, 0.248583689f,
+    0.300560832f, 0.339814603f, -0.551365077f, 0.0763247013f, -0.545003235f, 0.39349696f, 0.768710077f, -0.116375558f,
+    0.799472451f, -0.0931715742f, 0.630038083f, 0.463076472f, -0.018157918f, -0.572263718f, -0.666320145f, 0.114583172f,
+    0.899822831f, -0.677096665f, -0.95785898f, 0.499750435f, 0.512474597f, 0.849563897f, -0.52747339f, -0.575704277f,
+    -0.618093669f, -0.0773245692f, -0.377119005f, 0.649749398f, -0.817826331f, -0.505494058f, 0.541406572f, -0.30879283f,
+    0.0479266085f, 0.203487337f, 0.594534636f, 0.460292637f, -0.0167855639f, 0.299964935f, -0.287421823f, -0.298601568f,
+    0.780582726f, -0.426115274f, 0.0787699968f, 0.823726237f, 0.0187693182f, -0.783907712f, -0.965023637f, 0.13786158f,
+    -0.555771291f, 0.919659019f, -0.79242599f, 0.462425411f, -0.200172335f, -0.309837252f, -0.592916429f, -0.619370759f,
+    -0.239331409f, -0.241660759f, -0.397837102f, 0.748455048f, -0.00173964712f, -0.642918348f, -0.404285401f, 0.107299574f,
+    0.311594665f, -0.536643267f, -0.0161972344f, -0.296767354f, 0.117097534f, 0.589845121f, -0.270845324f, 0.436627477f,
+    0.722209632f, -0.29687798f, -0.638306975f, -0.0769950822f, 0.918754756f, -0.00830905978f, -0.689199388f, -0.380465925f,
+    -0.801218927f, -0.0656667352f, -0.0515568703f, 0.1369946f, -0.0932621807f, -0.302395493f, 0.119081438f, -0.601347208f,
+    -0.874480784f, 0.345668346f, -0.325187176f, 0.928644598f, 0.204683676f, 0.612401485f, -0.41677916f, 0.0898122117f,
+    -0.615501642f, -0.627754033f, 0.835994542f, 0.240185797f, -0.897535026f, 0.755584776f, 0.386662096f, -0.880553126f,
+    0.162591293f, 0.929207385f, 0.4192743f, 0.915312409f, 0.254660457f, -0.234723017f, 0.534999073f, -0.353203535f,
+    0.748280704f, -0.386992782f, -0.768629551f, 0.0574115962f, -0.981943369f, 0.337058336f, 0.0338842347f, -0.823713839f,
+    -0.797938347f, 0.335719377f, 0.516488433f, 0.269023955f, -0.373482525f, -0.376001358f, 0.419114321f, -0.670030236f,
+    -0.445957839f, 0.101577193f, 0.0237261578f, -0.272753268f, 0.105545454f, -0.000600185536f, 0.249973208f, -0.968374789f,
+    -0.815906346f, 0.386525899f, -0.623710752f, 0.785290182f, -0.127137467f, 0.663270295f, 0.756773651f, 0.275782108f,
+    0.935704231f, -0.864625454f, 0.616194904f, -0.23655957f, -0.0699788928f, -0.764166713f, 0.326182008f, -0.971125484f,
+    0.404104799f, 0.333981514f, 0.820208192f, -0.800384939f, 0.815903306f, 0.647448242f, -0.350978523f, 0.479266167f,
+    0.162240922f, 0.663681746f, 0.9306041f, 0.0439658053f, 0.37730518f, -0.46812135f, 0.882783294f, -0.274762303f,
+    0.423023462f, -0.57953316f, 0.270394653f, 0.328074157f, -0.373042017f, -0.262224764f, 0.745733023f, 0.870423853f,
+    -0.358674675f, 0.71316272f, 0.825993657f, -0.87535423f, -0.574365497f, -0.0297043379f, -0.488013536f, -0.300930947f,
+    0.680731833f, 0.674789965f, -0.692896068f, 0.764146924f, 0.324094832f, 0.972633898f, 0.533274889f, 0.042318657f,
+    0.600370944f, 0.0479299352f, 0.23958154f, -0.171217382f, -0.683919549f, -0.972392976f, 0.0118747512f, 0.938838303f,
+    0.458282769f, 0.972530246f, 0.984913409f, 0.9681741f, 0.620170832f, 0.803509355f, 0.763496578f, 0.895705402f,
+    -0.388331681f, 0.651517391f, 0.581839144f, 0.227647543f, 0.0249958839f, -0.874536157f, 0.44047305f, 0.56122309f,
+    -0.295671821f, -0.163157985f, 0.884832799f, 0.86775136f, 0.97753638f, 0.70440501f, 0.125726074f, -0.0889720768f,
+    0.748457074f, -0.434909523f, -0.922240376f, -0.627199829f, -0.346716702f, 0.36741969f, 0.307372063f, -0.443415403f,
+    -0.117149867f, -0.0699080825f, -0.758552313f, -0.0669918805f, -0.111498684f, -0.924730241f, -0.456574291f, -0.768366694f,
+    0.481493056f, 0.188940719f, 0.071947366f, -0.339808911f, 0.0389193185f, 0.20801729f, 0.900743544f, -0.572977781f,
+    0.973292649f, -0.266745955f, 0.375212729f, 0.381352931f, -0.202477872f, -0.836151361f, -0.354135424f, 0.0756264701f,
+    0.635685205f, -0.181393042f, 0.447820604f, 0.669150829f, -0.648623049f, 0.981026947f, 0.558839321f, -0.30411154f,
+    0.212619826f, 0.603373408f, 0.734771073f, -0.0543111004f, 0.495370299f, 0.235228509f, 0.304087937f, 0.923502743f,
+    -0.0583754592f, -0.794399023f, -0.131805584f, 0.172303572f, 0.587831199f, 0.335279882f, 0.57474637f, -0.927557468f,
+    -0.895704389f, 0.461459458f, -0.229137585f, -0.209957734f, 0.781610668f, -0.423424214f, 0.94009465f, -0.22704865f,
+    -0.233699039f, -0.349615157f, -0.964690268f, -0.952319801f, 0.221836716f, -0.376303226f, -0.962308168f, -0.873039603f,
+    0.656613946f, 0.800476909f, 0.883098543f, 0.571436405f, -0.176593646f, -0.823692679f, 0.318165004f, 0.168187574f,
+    -0.658166051f, 0.873430729f, 0.0419798382f, -0.0545376427f, 0.0221742578f, 0.282285005f, -0.856713116f, -0.279874355f,
+    0.818887413f, -0.879933894f, 0.310346544f, 0.614413202f, 0.171307415f, -0.836459339f, -0.44302848f, 0.669769824f,
+    0.195180222f, -0.178349227f, -0.849601984f, 0.241687536f, 0.821342826f, 0.0627947524f, 0.878875732f, 0.58015728f,
+    0.981812f, 0.318270653f, 0.278290272f, 0.754748583f, 0.665560603f, -0.617526352f, 0.198222652f, 0.747179389f,
+    0.519583941f, -0.217959374f, -0.246429801f, -0.448504835f, -0.12652503f, 0.30641675f, -0.182825118f, -0.883598804f,
+    -0.049977079f, 0.406538993f, -0.601050436f, 0.212224364f, -0.0674115792f, -0.149028063f, 0.113029681f, 0.636104107f,
+    0.663046777f, 0.353481472f, 0.946744382f, -0.594814062f, -0.715509713f, -0.272334307f, -0.611721694f, 0.136435628f,
+    -0.23829107f, 0.0109376898f, 0.523697674f, 0.625043929f, -0.603494346f, 0.255633444f, 0.817267954f, 0.924272716f,
+    0.0954227746f, 0.996145129f, 0.120491005f, 0.79801327f, 0.395937383f, -0.0441744365f, 0.926038682f, -0.441653043f,
+    -0.273477077f, -0.939317822f, 0.604215741f, -0.117939562f, -0.867995501f, -0.503848672f, 0.837555647f, -0.0593954846f,
+    0.573007703f, 0.940611839f, 0.00180292292f, 0.961663246f, -0.80626595f, 0.407721758f, -0.056238737f, -0.197366536f,
+    -0.641799927f, 0.146629035f, 0.249882445f, -0.804341018f, -0.402121544f, -0.197238579f, 0.618686557f, 0.165583879f,
+    -0.365311891f, -0.649420738f, 0.342992038f, 0.808009386f, 0.892963111f, 0.349716574f, 0.0341607071f, 0.682384849f,
+    -0.767483175f, -0.711576581f, -0.0913896561f, 0.635703921f, 0.566446841f, 0.0399849713f, 0.479373664f, -0.670752645f,
+    0.804595828f, 0.266614825f, 0.604949772f, 0.6790452f, 0.206977054f, -0.972495019f, -0.413563102f, 0.0220756698f,
+    0.736872971f, 0.415719301f, 0.122233346f, -0.320059985f, -0.162483618f, -0.0641985387f, 0.529434681f, -0.664654434f,
+    0.347367316f, -0.501378059f, 0.95480895f, 0.0262631532f, 0.513979733f, -0.924275815f, -0.403654486f, 0.800567389f,
+    0.294472247f, 0.661864638f, 0.143129542f, 0.917241037f, 0.234771803f, 0.89734292f, 0.521088123f, -0.0149133038f,
+    -0.831912696f, -0.758075714f, -0.551282823f, -0.783294737f, 0.686799288f, 0.68944484f, 0.346969724f, -0.614640832f,
+    -0.381976813f, 0.126692429f, -0.514081895f, 0.110033542f, 0.720273554f, -0.277895659f, 0.94751507f, 0.193093508f,
+    0.35731113f, 0.473099023f, 0.0593668818f, -0.379681647f, -0.719967306f, 0.586993635f, 0.81740123f, -0.577433348f,
+    -0.351517707f, 0.881858051f, 0.0407493748f, 0.0873758495f, 0.408035159f, -0.87346518f, -0.0288888346f, -0.257356972f,
+    -0.602670431f, -0.378658772f, -0.391089946f, -0.2424061f, 0.848939478f, 0.323087364f, -0.122478105f, -0.497753501f,
+    -0.320521951f, 0.599329889f, 0.94912684f, 0.633467376f, 0.831046343f, -0.306203485f, -0.70042491f, 0.725115299f,
+    0.487134457f, 0.227810279f, 0.569569767f, 0.825926483f, -0.618715703f, 0.560574174f, -0.200184271f, -0.804953694f,
+    0.50750351f, 0.941197515f, -0.97785145f, 0.656264246f, 0.50153023f, -0.639337957f, -0.325484693f, 0.813620985f,
+    0.605568647f, -0.250046402f, -0.647342086f, -0.890030742f, -0.800377846f, 0.702654898f, -0.978481352f, 0.590097487f,
+    0.566204309f, 0.668458283f, -0.232984275f, 0.793068171f, 0.0240304358f, -0.285145432f, -0.826512098f, 0.429796875f,
+    -0.676469326f, -0.634052277f, 0.202651545f, -0.797904611f, 0.394929916f, 0.829650104f, 0.915949881f, 0.634170651f,
+    -0.827381194f, 0.363636464f, 0.168378338f, -0.271855533f, 0.0357756242f, 0.746904969f, 0.250880271f, -0.289767027f,
+    -0.504837811f, 0.254047543f, -0.26344198f, 0.461340427f, 0.632503748f, -0.868908286f, -0.242555276f, -0.868702769f,
+    -0.71599251f, 0.926841378f, -0.501473427f, 0.657830358f, -0.775010765f, -0.899200499f, 0.659072936f, 0.473795235f,
+    -0.0189349707f, -0.0394226238f, 0.670737028f, -0.517236173f, -0.533486187f, -0.257970273f, 0.694169164f, 0.993215561f,
+    -0.524206638f, -0.420717806f, -0.751732051f, 0.703873456f, -0.503498554f, -0.236133143f, -0.0170069486f, -0.341226131f,
+    -0.216265947f, -0.23848781f, 0.154959947f, 0.0876725689f, -0.0486316718f, -0.649662375f, -0.0582545437f, 0.076070942f,
+    0.481126726f, -0.161991879f, -0.414172441f, 0.413585931f, 0.194307595f, 0.162923619f, -0.686505735f, -0.87271452f,
+    -0.79572928f, 0.451502621f, 0.600738585f, -0.800977588f, 0.62517339f, -0.103143916f, 0.987087369f, -0.406382591f,
+    0.125162959f, 0.49792707f, 0.0690202266f, -0.982496083f, -0.14397195f, 0.844898999f, -0.427257746f, -0.348713577f,
+    0.800726235f, 0.0632279441f, -0.575246274f, -0.178315967f, 0.493550777f, 0.700620472f, 0.746115804f, 0.0545568429f,
+    -0.336557508f, -0.198401779f, -0.216188416f, 0.739124656f, 0.470789611f, 0.995695949f, 0.0221487265f, -0.628311634f,
+    0.64534837f, 0.621563852f, -0.898227572f, 0.350335121f, -0.496153504f, -0.69192487f, -0.951223373f, -0.63272202f,
+    0.435566694f, 0.00961146131f, 0.109221697f, -0.777525127f, -0.585279942f, 0.615589261f, -0.0112554682f, -0.588531911f,
+    -0.498757988f, 0.977521718f, 0.492831916f, -0.267450452f, 0.382784218f, -0.261020064f, 0.123105377f, 0.781110466f,
+    -0.784765959f, 0.137695879f, 0.945765793f, 0.73217082f, 0.31303364f, -0.664947331f, -0.576064169f, -0.831620038f,
+    -0.806016803f, -0.414534599f, -0.491996974f, -0.313488722f, -0.981489539f, -0.540453553f, 0.174647659f, -0.506592274f,
+    0.164152831f, 0.430152535f, -0.0459150225f, -0.260284603f, 0.439821988f, 0.964973629f, -0.923138976f, 0.0893740058f,
+    0.967353106f, 0.00548313139f, -0.0970247388f, -0.454182386f, 0.088594906f, 0.226302594f, 0.19145523f, 0.702260971f,
+    0.124264225f, -0.386250407f, 0.477892309f, 0.177318782f, -0.818894744f, -0.880284727f, -0.463759571f, -0.497265875f,
+    0.16547747f, 0.146690339f, -0.0273665637f, -0.306093097f, -0.340839118f, -0.434088379f, 0.384816915f, 0.754867017f,
+    0.0573030449f, 0.618772089f, 0.900737345f, 0.502446651f, 0.17540963f, 0.215457067f, -0.26920557f, 0.926584303f,
+    -0.853332281f, 0.199015051f, -0.931389153f, -0.329825401f, -0.29842338f, 0.217344701f, 0.245785579f, 0.513269484f,
+    0.498424023f, 0.910021484f, -0.0687806085f, 0.334237278f, -0.582832992f, -0.589458227f, -0.122148201f, -0.0624214709f,
+    0.788299561f, -0.954999447f, -0.335742682f, -0.453964919f, 0.105010673f, 0.0197029207f, -0.165357694f, 0.745925069f,
+    0.157201707f, 0.470864147f, 0.828423381f, -0.30959186f, 0.800738156f, 0.432167262f, 0.3134197f, 0.209230229f,
+    -0.211931467f, 0.0407217704f, 0.139172778f, -0.494565129f, 0.0678224638f, -0.659065783f, 0.826743424f, -0.709453046f,
+    -0.333174795f, -0.83776027f, 0.73312515f, -0.796183586f, 0.541000903f, 0.802584827f, -0.316490322f, -0.883700669f,
+    0.270367503f, -0.390533179f, -0.365077317f, -0.166982174f, 0.709053159f, 0.185890123f, 0.947195351f, -0.893959284f,
+    0.558269143f, 0.578072011f, -0.134401679f, 0.410319686f, 0.148352712f, 0.853707552f, -0.190683052f, 0.689082623f,
+    0.70894599f, 0.100650102f, -0.875093877f, -0.90631634f, -0.705836475f, 0.942016602f, -0.875584483f, 0.287165344f,
+    -0.111528493f, 0.560772777f, -0.240128934f, 0.916215897f, 0.656421185f, -0.923814893f, -0.0719832182f, -0.652918935f,
+    0.706295729f, -0.220607713f, -0.331274688f, -0.469058692f, 0.801944792f, -0.0285531208f, 0.297764689f, 0.740699291f,
+    0.670603991f, 0.275988191f, -0.151526734f, 0.598792911f, -0.187631264f, 0.0379736982f, -0.328593194f, 0.767360389f,
+    0.617843509f, 0.454438806f, -0.199320748f, 0.686771393f, 0.540496647f, -0.995132685f, 0.848467827f, 0.0833364725f,
+    0.325854927f, -0.204671532f, -0.839912534f, -0.293667883f, -0.275550097f, -0.981377602f, -0.657761931f, 0.411253393f,
+    0.0693854839f, 0.58530724f, 0.583065569f, 0.62160337f, 0.774304092f, 0.663926303f, -0.822381854f, 0.419813573f,
+    -0.847088873f, 0.383506864f, -0.073299177f, 0.306889325f, 0.351845145f, -0.734539509f, 0.319915622f, -0.148893908f,
+    -0.607766807f, 0.208423287f, -0.350746244f, 0.716148198f, -0.749911785f, 0.422064036f, -0.172839999f, -0.414023817f,
+    -0.781359911f, -0.597439528f, 0.464398384f, 0.13177985f, 0.190439567f, -0.79462266f, -0.120249733f, 0.212053999f,
+    0.350290477f, 0.658183634f, -0.429502219f, -0.41761747f, -0.663566947f, 0.292462617f, 0.514858007f, -0.705838084f,
+    0.126607746f, -0.921488404f, -0.690273821f, 0.570431411f, -0.209149018f, -0.938082099f, 0.371678442f, 0.872842968f,
+    0.361485571f, -0.619193375f, -0.713411331f, -0.473283768f, 0.752967596f, -0.327405185f, 0.175823286f, 0.808102965f,
+    -0.0888465419f, 0.998978078f, 0.883939862f, -0.438358873f, -0.177182704f, -0.654980183f, -0.547105551f, 0.0829364583f,
+    0.00977814849f, -0.0843809471f, 0.0945096686f, -0.777974725f, 0.762649298f, 0.440187275f, 0.0224083532f, 0.407178581f,
+    0.0740683377f, -0.403263539f, 0.0809118971f, 0.254729003f, -0.444268227f, -0.18046914f, 0.123828448f, 0.730311275f,
+    0.534669995f, -0.403239071f, 0.478135347f, -0.263912529f, 0.915472806f, 0.879631162f, 0.694618285f, -0.0767116845f,
+    -0.64026475f, 0.487301648f, -0.797942758f, -0.87172097f, 0.212040976f, -0.229111061f, -0.00423244247f, 0.287622035f,
+    -0.909592748f, -0.637883723f, 0.987568259f, 0.540154278f, 0.989134014f, 0.63321346f, 0.204951689f, 0.383635163f,
+    -0.577084303f, -0.799659252f, -0.555641949f, -0.21482636f, -0.662435889f, -0.866270602f, 0.968822777f, -0.236137897f,
+    0.384609491f, -0.405896604f, 0.397824287f, 0.248957992f, -0.369550645f, 0.603785157f, -0.836677194f, 0.537388086f,
+    -0.740782917f, 0.355884582f, 0.365481675f, 0.461061567f, 0.849729717f, -0.510717213f, -0.472735047f, -0.952854872f,
+    0.237479404f, 0.637453854f, -0.650927663f, 0.302435786f, 0.709956825f, 0.442794979f, -0.501127601f, 0.363769025f,
+    0.558417916f, 0.249479279f, -0.696419656f, 0.466147006f, 0.221363157f, -0.452601105f, -0.302827954f, -0.768508255f,
+    0.649762571f, 0.305270433f, 0.905045271f, 0.328712761f, -0.751098216f, -0.459905565f, 0.271030813f, -0.0512305908f,
+    0.644883335f, 0.613360822f, 0.287095189f, -0.6838817f, -0.074671708f, 0.263174027f, -0.603246808f, -0.457251161f,
+    -0.174221471f, 0.792388797f, 0.61207813f, 0.335806608f, 0.892462671f, 0.3627249f, -0.993464231f, -0.490034878f,
+    0.725355625f, -0.628245473f, -0.803164124f, 0.378162622f, -0.657948494f, 0.122813128f, -0.518423617f, 0.606761694f,
+    -0.547056556f, -0.350717694f, -0.883769333f, 0.497487515f, -0.855302751f, 0.0234302692f, 0.463496208f, -0.84538883f,
+    -0.655546844f, -0.271401912f, -0.387285769f, -0.269466728f, 0.304475874f, 0.926499486f, 0.217986614f, 0.947985232f,
+    -0.415494263f, -0.625440836f, 0.156690553f, -0.606808245f, 0.716164231f, 0.27461949f, -0.58080101f, 0.207122043f,
+    0.354165792f, 0.737716079f, -0.221043855f, 0.792871177f, 0.0527614355f, 0.383895129f, 0.382653415f, -0.326196462f,
+    0.860906541f, 0.096367918f, 0.939177096f, 0.785974741f, -0.558936536f, 0.917834878f, -0.947938561f, -0.629216075f,
+    0.421250433f, 0.84675175f, 0.855908096f, -0.627330124f, 0.321194828f, -0.483026475f, 0.988990903f, 0.445536941f,
+    0.344035268f, -0.807554901f, -0.931679845f, -0.949486911f, -0.211961985f, 0.798710525f, 0.719440937f, 0.106797487f,
+    0.668343127f, -0.255616874f, 0.799710155f, -0.534624457f, -0.611894608f, 0.798581243f, 0.00468640029f, -0.57118696f,
+    -0.0284376964f, -0.691792667f, 0.377266645f, -0.430628657f, 0.444803774f, 0.928445935f, -0.743982255f, 0.628885865f,
+    -0.707855344f, 0.350756139f, 0.795043826f, -0.424899757f, 0.508640528f, -0.156447724f, 0.919364393f, 0.0349340327f,
+    -0.706456363f, -0.843365431f, -0.584180176f, -0.251397133f, 0.666862249f, -0.990784109f, -0.744811118f, 0.952655137f,
+    0.320302278f, -0.46498093f, 0.929704666f, -0.51448375f, 0.379637718f, -0.0822054446f, -0.988424718f, -0.965343475f,
+    0.939510524f, 0.696897924f, 0.486150801f, -0.72847712f, -0.77493459f, 0.923818052f, -0.957425773f, 0.4598234f,
+    -0.0333587416f, 0.679097056f, -0.876194417f, 0.0184716303f, 0.580941439f, -0.00285317888f, -0.425868481f, 0.718819439f,
+    0.905789375f, -0.393666148f, -0.728633344f, 0.316756725f, 0.876328707f, 0.0328098647f, -0.222820088f, 0.469815552f,
+    -0.455916286f, -0.435949087f, -0.602657616f, 0.965893149f, -0.151136369f, -0.895135045f, 0.17054081f, -0.761346638f,
+    -0.206333518f, -0.260818332f, -0.803381443f, 0.994992316f, 0.267247349f, 0.770487905f, -0.330070376f, 0.0983815491f,
+    0.324875951f, -0.558430076f, -0.614071548f, 0.59101069f, 0.783954978f, -0.524844706f, -0.668822587f, 0.871495068f,
+    -0.286485463f, 0.965080559f, 0.84612596f, 0.807733417f, 0.430804819f, 0.00766644953f, -0.367761046f, 0.79429388f,
+    -0.0816856697f, -0.966223359f, 0.0827924609f, -0.796316504f, 0.539976656f, 0.830227017f, 0.279785454f, -0.0736289918f,
+    -0.23401618f, 0.753759742f, -0.339622974f, -0.485899866f, 0.300195962f, 0.103913121f, 0.859150767f, 0.108730808f,
+    -0.270934552f, -0.564282894f, -0.517777681f, -0.0051105395f, 0.867304742f, -0.872618556f, -0.143337965f, 0.63217026f,
+    -0.201004356f, 0.45133689f, 0.775021851f, -0.955401182f, -0.185500547f, 0.40354082f, 0.108402863f, 0.885582209f,
+    0.874965847f, -0.442774445f, -0.379526109f, -0.00975006446f, -0.588130474f, 0.361548632f, -0.666190743f, -0.641160727f,
+    -0.987796009f, -0.845595539f, 0.105327822f, 0.906830072f, 0.133390442f, -0.46400243f, 0.951307952f, 0.0723292679f,
+    0.715631545f, 0.489452899f, 0.63986975f, 0.11733333f, -0.855394065f, -0.160297692f, -0.0837970898f, 0.355349571f,
+    -0.778990865f, -0.585543215f, 0.626551032f, -0.345212042f, -0.530777276f, 0.621570289f, -0.489817768f, 0.203975499f,
+    -0.0274580084f, 0.483825892f, -0.0620193183f, 0.488813639f, 0.38286227f, -0.875876427f, 0.67122978f, 0.0386130251f,
+    -0.427731335f, -0.0515718199f, 0.437611341f, 0.374527425f, 0.50888294f, -0.000104181796f, -0.142382741f, -0.795366287f,
+    -0.156670645f, 0.33453086f, -0.702966332f, -0.318532676f, -0.0567759052f, -0.962139726f, 0.859641314f, 0.922151566f,
+    -0.939528406f, -0.604437232f, -0.691555858f, 0.38723889f, -0.0557415709f, 0.641983867f, -0.482752234f, -0.973891437f,
+    -0.671562731f, -0.056604933f, -0.739723265f, 0.535995424f, -0.153582215f, 0.843866944f, -0.255015194f, 0.881213546f,
+    0.344334483f, -0.540921926f, 0.505095541f, 0.230315119f, -0.25079608f, -0.761153519f, 0.136870936f, -0.454372406f,
+    0.0864236653f, -0.953725815f, 0.23887518f, -0.529003322f, -0.764533103f, -0.255881369f, -0.429250926f, 0.014138489f,
+    -0.589158177f, 0.406169653f, 0.168465674f, -0.573046565f, 0.0122701442f, -0.322118551f, -0.772639394f, -0.60254544f,
+    0.500677168f, 0.741287887f, 0.174786314f, -0.69953984f, -0.61420697f, -0.902514398f, 0.202020302f, 0.447236866f,
+    0.863756955f, 0.0795542896f, -0.880214512f, -0.742781699f, 0.669407725f, -0.212531969f, 0.422864974f, -0.487692833f,
+    -0.083789818f, 0.695428789f, 0.245490745f, -0.439906031f, -0.684825778f, 0.189380482f, -0.676832438f, -0.383131087f,
+    0.130012825f, -0.437074542f, -0.237448558f, 0.550519645f, 0.960753441f, -0.283939242f, -0.738836169f, -0.703216732f,
+    0.0631820485f, 0.247546986f, 0.360172123f, 0.731259644f, 0.432208687f, -0.0355821699f, -0.249113783f, -0.450369269f,
+    0.844834447f, -0.858366609f, 0.332786709f, 0.851766288f, 0.489762127f, 0.921800196f, -0.192823872f, 0.900084376f,
+    -0.97284317f, -0.341709375f, -0.490909934f, -0.387008399f, -0.516974807f, -0.0826894268f, 0.938469112f, -0.199875772f,
+    0.778937757f, -0.479319334f, -0.97569555f, -0.0981195122f, 0.639078557f, 0.842048466f, -0.0357603952f, 0.482797652f,
+    0.721198022f, 0.954051197f, -0.754109204f, -0.0387299322f, 0.371248186f, -0.0640077442f, -0.0296589248f, -0.0539367087f,
+    -0.313932151f, -0.581385851f, 0.721857727f, 0.0513162501f, 0.350152075f, 0.581690192f, -0.660542965f, 0.355542302f,
+    0.693156242f, 0.48758015f, -0.490169108f, -0.00951980054f, -0.786427617f, -0.86763525f, -0.518117487f, 0.838798285f,
+    0.940944076f, -0.10877832f, 0.470731825f, 0.425187886f, -0.96731329f, -0.0856391713f, -0.424329162f, -0.802039087f,
+    0.0542803854f, 0.69314909f, 0.042374339f, 0.192331389f, 0.938168943f, -0.491018236f, 0.829883575f, -0.214649931f,
+    0.208456874f, 0.618409753f, -0.156339526f, 0.863058507f, -0.840825737f, -0.372130543f, -0.829599261f, 0.611057043f,
+    -0.334222108f, 0.366258979f, 0.181645393f, 0.483297259f, -0.128896475f, -0.0746664777f, 0.549858987f, -0.175747693f,
+    -0.541234136f, 0.0613658242f, -0.321077615f, 0.269463271f, 0.724350393f, 0.498515755f, -0.32801646f, -0.185812473f,
+    -0.125091374f, -0.591466486f, -0.233298331f, 0.0111474087f, -0.395182282f, -0.217357486f, 0.277487189f, 0.336156249f,
+    -0.19110015f, 0.0412681215f, 0.851743817f, -0.15695332f, 0.969077229f, -0.415975153f, -0.00843101367f, 0.118544541f,
+    0.31707108f, 0.109294564f, 0.620242655f, 0.230688229f, 0.366307527f, -0.49891293f, 0.480200231f, 0.368060023f,
+    -0.704253376f, -0.385627568f, 0.533219516f, -0.258386284f, 0.454920501f, 0.781485438f, -0.577510655f, -0.461446822f,
+    -0.676934183f, 0.782400727f, 0.47036168f, 0.221506849f, 0.987383246f, 0.404355943f, 0.0666158795f, 0.0216474682f,
+    0.740590155f, 0.308636963f, 0.509626925f, -0.386724919f, 0.693560123f, 0.285091549f, 0.918663085f, -0.681106269f,
+    -0.352701902f, -0.779415131f, -0.727901459f, 0.742449641f, -0.422440559f, -0.889364719f, 0.32574451f, 0.0299790557f,
+    -0.463022172f, -0.112756819f, 0.793302178f, 0.466762125f, -0.49849689f, 0.888913453f, 0.30165121f, 0.886750758f,
+    0.991571486f, -0.885927439f, 0.984738946f, 0.18613033f, -0.398999184f, 0.011114982f, -0.948555589f, -0.0259185601f,
+    -0.808284163f, -0.821175873f, 0.266095459f, 0.983687937f, -0.12834686f, -0.779497623f, -0.783001423f, -0.492384255f,
+    -0.596216857f, 0.607450008f, -0.759597659f, -0.798257768f, 0.706911266f, 0.313512444f, 0.585722804f, -0.67683953f,
+    -0.719840229f, 0.823113024f, -0.170234829f, -0.23019509f, 0.347052723f, 0.613510549f, 0.753834665f, -0.0297542773f,
+    0.980929434f, -0.462117046f, 0.275109023f, 0.930890262f, 0.372639745f, 0.227385476f, 0.95648855f, 0.359162301f,
+    0.0677720085f, 0.874922633f, 0.587738633f, 0.72167331f, 0.133005694f, -0.417040944f, 0.0201840606f, 0.691114724f,
+    -0.250468701f, -0.151716396f, 0.0654017627f, -0.250238806f, -0.908661187f, -0.122429259f, -0.380553186f, 0.651605606f,
+    -0.85613054f, -0.21310626f, 0.185657933f, -0.832115889f, 0.750219524f, 0.302711338f, -0.463491529f, -0.0592065006f,
+    -0.456776172f, -0.329678774f, 0.735651433f, -0.342670292f, 0.337540984f, -0.00542759756f, -0.628786385f, 0.716861188f,
+    0.776916742f, 0.33688724f, 0.485605806f, 0.912548959f, 0.598555326f, 0.0167748667f, 0.465333819f, 0.931360483f,
+    -0.357862473f, 0.615848184f, -0.311701506f, 0.664217174f, 0.94624269f, 0.730574846f, -0.392493635f, -0.223842412f,
+    -0.584837735f, 0.412693471f, 0.558851957f, 0.51950413f, -0.569991767f, 0.327274889f, -0.659942627f, -0.834038496f,
+    0.587639332f, 0.88003093f, -0.568957686f, 0.385300964f, -0.874197185f, -0.759176135f, -0.316761583f, 0.867606103f,
+    -0.670011461f, 0.282188416f, 0.337988377f, 0.0694132f, -0.0789478198f, -0.43823266f, 0.571063995f, 0.032411363f,
+    -0.788108826f, 0.668503523f, -0.906420827f, -0.984075785f, -0.948473752f, -0.0748177618f, 0.335337192f, 0.850133359f,
+    0.300793707f, -0.235995486f, 0.0298123527f, 0.709526658f, 0.328522801f, 0.70564878f, 0.878769457f, 0.571817994f,
+    0.364886552f, 0.208887145f, 0.42281571f, 0.0630643368f, 0.644407749f, -0.200278863f, 0.813298881f, -0.390332788f,
+    -0.0563909896f, -0.026821401f, -0.072541371f, -0.307685196f, -0.153517872f, -0.14064464f, -0.243838891f, 0.874333501f,
+    0.631059647f, -0.628049672f, 0.469228685f, 0.324059576f, 0.897288799f, 0.572745025f, 0.341481447f, 0.080076538f,
+    0.159839019f, 0.710545361f, 0.51582557f, 0.234213516f, -0.171513349f, -0.185498998f, -0.399387121f, -0.397227466f,
+    0.452382833f, 0.0741622746f, 0.886825264f, -0.899983644f, -0.242210701f, -0.288134545f, 0.262577593f, -0.0820925757f,
+    -0.764387906f, -0.419990152f, 0.520649314f, -0.710859776f, -0.959281445f, 0.273559153f, -0.772182643f, -0.353329003f,
+    0.96527791f, 0.661152303f, -0.000468981016f, -0.07403557f, 0.0251653846f, 0.861965418f, -0.859404027f, -0.239934772f,
+    0.488206625f, 0.268235385f, 0.789725959f, -0.329668969f, 0.840745568f, 0.384076238f, -0.228216842f, -0.943533659f,
+    -0.690772176f, -0.836876214f, -0.996491551f, 0.153891012f, 0.474202514f, -0.0123922387f, 0.964844704f, -0.06616579f,
+    -0.176098347f, 0.231931403f, 0.593552947f, 0.865079761f, -0.304647326f, 0.640374959f, 0.520913601f, -0.24549441f,
+    0.351725399f, 0.760955513f, 0.387412935f, 0.128404021f, -0.7266891f, 0.288763583f, -0.679728031f, 0.0502509363f,
+    0.0530002527f, -0.590965152f, 0.730952501f, -0.825977027f, 0.224330232f, -0.552327514f, 0.668259442f, -0.0796078295f,
+    -0.211206868f, -0.406591952f, 0.995109499f, 0.0753729567f, 0.701216042f, 0.944125593f, -0.256712973f, -0.685748875f,
+    -0.763164103f, 0.557898521f, 0.667801976f, 0.236648276f, 0.333004624f, 0.772025168f, -0.392971009f, 0.373398334f,
+    0.102408417f, -0.102433912f, -0.132038563f, 0.554266512f, 0.280643523f, -0.842902124f, 0.0731708929f, -0.399047583f,
+    0.918840647f, -0.43732357f, 0.213980883f, -0.23730655f, 0.528081954f, 0.270595461f, -0.740341544f, 0.837489188f,
+    -0.726645648f, 0.630763829f, -0.375218868f, -0.142428935f, -0.706911743f, -0.484543294f, 0.664283693f, -0.843187153f,
+    0.480245501f, 0.00709484471f, 0.592936039f, 0.96472156f, -0.397656977f, -0.300397903f, 0.249470979f, -0.205045044f,
+    0.575946867f, 0.396712422f, 0.831204474f, -0.119618803f, -0.730001211f, 0.0275894515f, 0.0148330266f, 0.563613534f,
+    0.0686384812f, -0.29979232f, 0.366375595f, -0.536664486f, -0.610200286f, -0.463826418f, -0.462300599f, 0.0144351032f,
+    0.607007444f, -0.678510308f, 0.954118729f, 0.2004859f, 0.873064756f, 0.900529444f, -0.863564014f, 0.275415421f,
+    0.181738675f, -0.172232866f, 0.313445032f, -0.420958638f, -0.553065538f, -0.262515426f, 0.350788862f, -0.562209845f,
+    0.0159321744f, 0.446126848f, -0.628602386f, -0.24360171f, 0.869596243f, -0.640353501f, 0.652839839f, -0.204416811f,
+    0.203831941f, -0.311125427f, 0.812211037f, 0.948726475f, 0.413639694f, 0.397433013f, -0.196646437f, 0.488929272f,
+    -0.159495682f, -0.989025772f, 0.908362985f, -0.00952126645f, -0.411377668f, 0.572672963f, 0.255378425f, 0.327819109f,
+    0.644508243f, -0.267808348f, 0.159117192f, -0.751612067f, 0.936554909f, 0.384749264f, -0.126966923f, 0.465236187f,
+    0.563073516f, -0.454826653f, -0.268499941f, 0.391500026f, -0.899422228f, -0.897293925f, -0.0311483331f, 0.231734425f,
+    -0.603127539f, 0.171395168f, -0.984777987f, -0.668947816f, 0.710775554f, 0.272550732f, 0.104984075f, -0.0387335122f,
+    0.407088459f, -0.918679774f, -0.436797976f, -0.710496485f, -0.240275264f, 0.483988136f, 0.0164637696f, 0.744366109f,
+    0.295998454f, 0.0149261635f, 0.68972677f, 0.0679732338f, 0.421105474f, 0.0968753472f, -0.395800948f, 0.123115174f,
+    -0.40494296f, -0.584332645f, 0.864956737f, 0.266300827f, 0.186001197f, -0.402246118f, -0.236292213f, -0.421852648f,
+    0.292446434f, -0.602947116f, 0.914850473f, -0.553284228f, -0.846971691f, -0.742371678f, 0.149474263f, -0.174228907f,
+    -0.236217335f, -0.0954220518f, -0.0221265256f, 0.665323019f, -0.94526273f, -0.756424248f, -0.89458406f, -0.644329906f,
+    0.65602535f, 0.625257671f, -0.290398031f, -0.691051602f, 0.685983062f, -0.591428697f, -0.285310179f, 0.848293722f,
+    -0.419623762f, -0.100160383f, 0.273877144f, -0.645812094f, -0.526330352f, 0.432721078f, -0.359796613f, -0.663216889f,
+    0.0743150637f, 0.235353842f, 0.522483945f, 0.30992046f, 0.159925833f, -0.0987811759f, 0.632867336f, -0.66333729f,
+    0.721443176f, -0.631856382f, 0.718415976f, -0.47779429f, -0.0955461189f, -0.155199111f, 0.333439529f, 0.695418537f,
+    0.503268778f, -0.874422967f, -0.440431744f, -0.16527395f, 0.0455047563f, 0.143930167f, -0.676348031f, 0.161733285f,
+    0.548385382f, -0.600191832f, 0.576950133f, -0.983913958f, 0.190123692f, 0.566444397f, -0.135522634f, -0.289294958f,
+    0.771316648f, 0.954017818f, 0.565619886f, 0.0609496348f, -0.203119576f, -0.655436397f, 0.423303127f, -0.197358593f,
+    -0.231605574f, -0.00605949014f, -0.98129338f, 0.0489095673f, 0.642990112f, 0.643137932f, 0.112781599f, 0.757573068f,
+    -0.643066406f, -0.964667439f, 0.794121802f, -0.726783276f, 0.340357184f, -0.837789059f, 0.849556684f, -0.71480304f,
+    -0.379587889f, -0.592973292f, 0.842116594f, -0.095034413f, 0.515574098f, -0.637623012f, -0.927389145f, -0.173386052f,
+    -0.596738338f, -0.974617362f, -0.371758491f, 0.893736839f, -0.377337039f, 0.296358287f, -0.668959141f, -0.119151175f,
+    -0.450987011f, 0.118322425f, -0.955657005f, -0.00791255664f, 0.728312612f, -0.713297904f, 0.905496001f, -0.0103408583f,
+    0.516181707f, -0.682768285f, -0.732174933f, -0.64359808f, -0.619511306f, 0.0817603394f, 0.448652565f, 0.587440193f,
+    -0.484157622f, 0.141166538f, -0.48870194f, 0.759581327f, 0.748100519f, 0.120747529f, -0.732363045f, -0.121970497f,
+    -0.142443687f, -0.974240363f, 0.158967644f, 0.340739369f, 0.40420267f, -0.768988431f, 0.248836875f, 0.898667395f,
+    0.934552252f, 0.570316315f, -0.755031168f, -0.947117507f, 0.876716495f, 0.397929609f, 0.858089626f, -0.719641924f,
+    0.711973011f, 0.782523751f, -0.864742875f, 0.00037321425f, -0.942500353f, 0.624894679f, -0.603296936f, 0.233280525f,
+    0.310395628f, -0.231721625f, 0.962917686f, 0.466817021f, -0.288152218f, -0.925041139f, 0.739952207f, 0.313609511f,
+    -0.340981513f, -0.89954716f, -0.756260812f, -0.66542381f, 0.370451182f, -0.434423685f, 0.427667081f, -0.38831982f,
+    0.502265513f, -0.901351392f, -0.494195223f, 0.71326685f, -0.861424148f, 0.84343946f, -0.601208091f, -0.977024138f,
+    -0.452198148f, 0.969911516f, -0.414894879f, 0.698509753f, -0.555392683f, 0.991638243f, 0.77677232f, 0.606532156f,
+    -0.204591915f, -0.197636247f, 0.220950693f, -0.283683628f, 0.0674630255f, -0.182793364f, 0.281262457f, -0.0125514437f,
+    -0.890588224f, 0.875162542f, 0.0215156209f, 0.0390235186f, 0.38723886f, -0.346276551f, 0.655717611f, 0.974833071f,
+    0.957539022f, -0.448173672f, 0.601042688f, -0.46243158f, -0.187604725f, -0.705295861f, 0.410666496f, -0.832596719f,
+    0.333584189f, -0.222002581f, -0.785650671f, 0.0636263639f, -0.32535997f, 0.324919254f, 0.321178436f, -0.360705763f,
+    0.254020959f, 0.524335027f, 0.0969759375f, 0.274796188f, -0.175157383f, -0.186959192f, -0.602703154f, -0.609903514f,
+    0.392809153f, 0.758996129f, 0.00655850256f, -0.730279922f, -0.992893517f, 0.890668452f, -0.633794546f, 0.0610410608f,
+    -0.0900286511f, -0.565458357f, 0.23016721f, -0.817042768f, -0.323138714f, 0.722249329f, -0.667002022f, 0.0962278917f,
+    -0.704635859f, -0.622528255f, 0.0127048092f, 0.369183093f, -0.646984041f, -0.374067307f, -0.832448602f, -0.83933723f,
+    -0.900828481f, 0.708273411f, 0.415334612f, -0.961152256f, -0.131037369f, -0.651476562f, 0.684502602f, 0.220049977f,
+    -0.568048298f, -0.626443267f, 0.621485114f, 0.810668111f, -0.137330055f, 0.747968495f, 0.176109791f, 0.35224703f,
+    0.0269211773f, -0.0954588652f, -0.614947677f, -0.270872533f, 0.0929013491f, 0.270774305f, -0.589618087f, 0.537864864f,
+    -0.675208747f, 0.721657455f, 0.388130367f, -0.561143816f, 0.945439756f, -0.950720072f, -0.814824343f, 0.326723665f,
+    0.515724719f, 0.197759554f, 0.323203027f, 0.289246857f, 0.61798799f, -0.867610574f, -0.00269033574f, 0.179001212f,
+    -0.213664681f, -0.0554603525f, 0.831029356f, 0.908105373f, -0.705066085f, -0.932211161f, 0.319175512f, 0.554144204f,
+    -0.681448042f, -0.0550955571f, -0.0426589027f, 0.644484103f, 0.490448892f, 0.0334509388f, -0.249535426f, -0.237191379f,
+    0.184606344f, -0.557396531f, 0.230549276f, -0.0753981844f, -0.0832878351f, 0.045265913f, 0.482303232f, -0.94407922f,
+    0.632041812f, -0.909392357f, 0.406500608f, 0.315306515f, -0.711732924f, 0.011752367f, 0.253419638f, 0.767877758f,
+    -0.972431779f, 0.894734621f, 0.0650341883f, -0.538634717f, 0.981604278f, -0.584376574f, -0.547378778f, 0.983153582f,
+    0.231042683f, -0.536353767f, -0.504411578f, -0.856764436f, -0.698696613f, 0.801196694f, -0.199344099f, -0.578266025f,
+    -0.00687661441f, 0.836647868f, -0.437404603f, -0.529412389f, -0.569554925f, -0.411946207f, -0.976102293f, -0.216912851f,
+    0.745183051f, -0.96641463f, -0.136591643f, -0.817067266f, -0.221867666f, 0.153016344f, 0.720606446f, 0.107140221f,
+    0.265184015f, 0.830438197f, 0.783283055f, -0.78643316f, 0.519959092f, -0.589103639f, -0.532289863f, -0.497274041f,
+    0.221445128f, -0.741782963f, -0.907711387f, -0.0134242168f, -0.908330977f, 0.247109458f, -0.528891623f, 0.82977289f,
+    -0.22100693f, -0.368014246f, -0.775826395f, 0.934943318f, -0.412583262f, -0.602287412f, 0.491149127f, 0.345289201f,
+    0.549977362f, 0.999165773f, 0.967640042f, 0.760373414f, -0.190400884f, -0.315153509f, -0.631683886f, 0.30643326f,
+    -0.564735413f, -0.866559744f, 0.542539537f, -0.182120666f, 0.686479807f, -0.468043447f, -0.280055255f, -0.363397032f,
+    -0.724196792f, -0.206821516f, 0.899529099f, -0.101675034f, -0.0939339772f, -0.292983174f, 0.123509981f, 0.926714599f,
+    0.378329068f, 0.485216647f, -0.414004266f, -0.984011233f, 0.801762819f, 0.799536884f, -0.579204977f, -0.00420872355f,
+    -0.652881563f, 0.934519172f, 0.519411922f, -0.936159611f, 0.290890217f, -0.412531823f, -0.169895127f, -0.681254625f,
+    0.109913297f, 0.0819724575f, -0.840374649f, -0.216960236f, -0.256825089f, 0.410531998f, 0.623394847f, 0.622727931f,
+    0.518888116f, -0.196409434f, 0.208870441f, 0.344515979f, 0.495260149f, -0.346044451f, -0.411821812f, -0.359086484f,
+    -0.582713425f, 0.00395532092f, -0.57025218f, 0.138383806f, 0.537224472f, 0.228417888f, -0.432448626f, -0.903343558f,
+    0.691230655f, 0.733313024f, 0.137562305f, 0.318457901f, -0.797249556f, -0.581939638f, 0.327283651f, 0.878675163f,
+    0.191268161f, -0.5775249f, -0.203320906f, -0.145776793f, 0.177793562f, -0.880665541f, 0.23464936f, 0.318692118f,
+    -0.862566531f, 0.332031697f, -0.322428197f, -0.768622339f, 0.389027983f, 0.712019324f, -0.0198737495f, 0.0615524389f,
+    -0.937727094f, -0.39185068f, 0.0158508997f, 0.585532069f, 0.280558407f, -0.642736018f, -0.129369408f, -0.796306491f,
+    0.159104541f, -0.527439058f, -0.424568415f, 0.620934248f, 0.055837743f, 0.334501922f, 0.633975267f, 0.491048634f,
+    0.354035437f, -0.503514886f, -0.607585073f, 0.232571334f, -0.273314297f, 0.00181872526f, 0.56115216f, 0.384535134f,
+    0.926434219f, 0.647149086f, -0.598401785f, 0.28748256f, 0.833964407f, -0.157645687f, 0.0590511896f, -0.774444818f,
+    0.691164196f, -0.295089632f, 0.464706242f, -0.379928231f, 0.149184719f, 0.0971227437f, 0.525572836f, -0.374762863f,
+    0.421130598f, 0.901904941f, 0.0693424642f, -0.236633152f, 0.183904558f, 0.811704755f, 0.0218390748f, 0.989732563f,
+    -0.162949055f, 0.786840856f, 0.837988853f, -0.0709140524f, 0.312719584f, -0.517036796f, 0.411448985f, 0.298033714f,
+    0.98798126f, -0.229851589f, 0.457433224f, 0.942075253f, 0.669083118f, -0.020149881f, 0.610547781f, 0.919611752f,
+    0.23886171f, 0.958231926f, -0.536686003f, 0.199504614f, 0.82253629f, -0.901119769f, 0.172782749f, -0.921536624f,
+    -0.822590232f, 0.501518011f, -0.267828077f, 0.996300519f, 0.69937253f, -0.319247812f, -0.417659253f, 0.657580078f,
+    -0.503557563f, -0.0449827313f, -0.328019083f, 0.865400374f, 0.102158904f, 0.485534579f, -0.981956542f, 0.306266248f,
+    -0.522475302f, 0.751362264f, -0.941438258f, 0.240264192f, -0.792674422f, 0.740268171f, -0.394892633f, -0.670803547f,
+    0.938126147f, 0.629025042f, 0.315954298f, -0.606454134f, 0.60384655f, -0.313143373f, -0.0272483528f, 0.400864244f,
+    0.994309723f, 0.624328375f, 0.765879393f, 0.804523349f, 0.0868755952f, -0.57121408f, 0.342057914f, 0.464979947f,
+    -0.867523253f, 0.67116338f, 0.782699823f, 0.714433074f, -0.600479841f, 0.487334549f, -0.991635978f, -0.841785908f,
+    -0.661903262f, 0.928184152f, 0.422349751f, 0.309002608f, -0.701140523f, 0.436331689f, 0.356884718f, 0.395472288f,
+    0.311144024f, 0.0602724142f, 0.199411914f, -0.812172532f, -0.322371215f, 0.257164478f, -0.92453289f, -0.0359441862f,
+    -0.452816725f, 0.266646773f, 0.293759793f, 0.473678917f, -0.318946183f, -0.836866498f, -0.422828197f, 0.0912793353f,
+    -0.393850297f, -0.587126017f, -0.541769207f, 0.328797221f, -0.715985f, -0.482665151f, 0.694179595f, 0.763624132f,
+    0.521735609f, -0.568165004f, -0.693193972f, 0.765804052f, 0.504164219f, -0.690720022f, 0.763268054f, 0.15156275f,
+    -0.750666201f, 0.360039949f, 0.228039771f, 0.269867927f, 0.640233338f, 0.0328898169f, 0.452468187f, -0.971140981f,
+    -0.434903502f, 0.263842285f, 0.2873061f, -0.873249352f, -0.8013165f, 0.653880537f, -0.222257063f, 0.160759673f,
+    -0.331545353f, 0.779871404f, 0.838584602f, -0.349348783f, -0.242320821f, 0.950035393f, -0.870863259f, 0.610649765f,
+    0.643096149f, -0.0984006077f, 0.58328414f, 0.710278809f, 0.0550915077f, 0.497721434f, -0.000524764357f, 0.164692521f,
+    -0.442425847f, 0.633495808f, -0.227861583f, 0.707590461f, 0.168694302f, 0.413373023f, 0.729399681f, 0.884881496f,
+    0.288958251f, -0.895329416f, 0.886783719f, -0.956412554f, -0.0561652593f, -0.294270605f, 0.202214569f, 0.203964889f,
+    -0.615129471f, -0.841897547f, 0.789113045f, -0.911535919f, 0.109764725f, 0.894743383f, -0.833716631f, -0.975264132f,
+    -0.262910247f, -0.969849885f, -0.134421661f, 0.0220774207f, -0.684153616f, -0.691300631f, 0.449195474f, -0.861634254f,
+    0.601119936f, 0.154533163f, 0.630018115f, 0.511962533f, -0.150963932f, 0.0390035287f, -0.8187657f, -0.888564765f,
+    0.55935359f, -0.345368057f, 0.125380471f, 0.842238069f, -0.356209308f, 0.550422549f, 0.938882589f, -0.161047578f,
+    0.640632689f, 0.808224261f, 0.859673142f, -0.0230402965f, -0.323531479f, 0.381952107f, -0.107410893f, -0.0647602379f,
+    0.664498091f, -0.38875097f, 0.899674356f, 0.146130636f, 0.288163692f, 0.188230321f, -0.733570755f, -0.0279729348f,
+    0.250010937f, -0.719479024f, 0.0773834363f, 0.138034478f, 0.59116888f, 0.763255596f, -0.743234992f, 0.985454738f,
+    -0.818766654f, -0.547345638f, 0.615619302f, 0.456842393f, 0.810711741f, -0.331053883f, 0.282682866f, -0.911284566f,
+    -0.963995934f, 0.257416427f, -0.710913181f, 0.963756621f, 0.333996296f, 0.392017454f, -0.431151241f, 0.756519794f,
+    0.909255922f, 0.515680432f, -0.590973616f, 0.552149713f, -0.213926435f, 0.751336277f, 0.547519743f, -0.261276484f,
+    -0.401887774f, 0.458090365f, 0.14580591f, -0.709335148f, 0.96511817f, -0.794909477f, 0.862270534f, -0.455956668f,
+    -0.205556497f, -0.703390181f, 0.901203036f, -0.753966153f, -0.499641091f, 0.542628825f, -0.888700187f, 0.795471132f,
+    -0.946439922f, -0.815692544f, 0.0499215052f, -0.657045543f, 0.93283987f, -0.377733648f, 0.625966311f, -0.255646944f,
+    0.910631001f, -0.727651894f, 0.537528992f, 0.107124709f, -0.52085036f, -0.234639138f, 0.235310897f, 0.200499117f,
+    -0.817443728f, -0.933697939f, 0.0315514468f, 0.882545412f, 0.937990904f, 0.0524521992f, -0.588193536f, 0.444545358f,
+    -0.595699608f, -0.526895881f, -0.234910816f, 0.579319715f, 0.0324482098f, 0.456280351f, 0.521086395f, 0.635238111f,
+    -0.0939333439f, 0.4040429f, 0.81233412f, 0.43375954f, -0.886564314f, 0.877520859f, -0.0855178386f, 0.968183398f,
+    -0.579813898f, 0.655965328f, 0.425153017f, 0.460176855f, 0.494254619f, 0.804452062f, 0.65983814f, -0.727065504f,
+    0.74789995f, 0.560535491f, 0.555271387f, 0.670143604f, -0.105829313f, -0.843113482f, -0.110109456f, 0.151775137f,
+    0.868151486f, -0.645298183f, -0.0932465717f, 0.414660931f, -0.993396103f, -0.741138339f, 0.216301024f, 0.532962561f,
+    -0.732825458f, 0.539742231f, 0.420713246f, 0.854219913f, -0.944308996f, -0.586582541f, -0.350244194f, 0.0653624386f,
+    -0.841147661f, -0.519800901f, 0.392594129f, -0.205542594f, -0.399238616f, -0.697601259f, 0.449391991f, 0.439776868f,
+    0.496696442f, -0.221966878f, 0.723026633f, -0.883755386f, 0.814720511f, -0.988406718f, -0.801773608f, -0.666177869f,
+    -0.793216705f, -0.59677881f, -0.034723945f, 0.844257772f, -0.808097184f, -0.413713515f, 0.358611047f, -0.51873064f,
+    -0.931074858f, 0.908500433f, -0.139024347f, -0.235493392f, 0.561353803f, -0.228156283f, -0.888986826f, 0.542507291f,
+    0.724410534f, 0.851807892f, -0.224631369f, 0.543098152f, 0.675313354f, 0.499294341f, -0.122362502f, 0.881614149f,
+    0.825603664f, -0.479783237f, 0.615130186f, -0.257235944f, -0.104665644f, 0.706158161f, -0.5164814f, -0.691469789f,
+    -0.667736351f, 0.429290026f, -0.0936902091f, 0.49333334f, 0.115938574f, -0.175594449f, 0.398958027f, 0.195071414f,
+    0.0166320782f, -0.440046072f, -0.0527000315f, -0.0715978593f, 0.870237708f, -0.473361909f, -0.358595788f, -0.854655445f,
+    -0.0915417522f, -0.365518123f, -0.687084436f, -0.468620479f, -0.681580961f, -0.133171812f, 0.230845198f, 0.92605406f,
+    0.812148929f, 0.803608f, 0.914464235f, -0.0377926119f, 0.784322023f, 0.630380869f, -0.797078967f, 0.802010238f,
+    0.728109658f, 0.00317476178f, -0.388394386f, -0.912282526f, -0.800950885f, 0.804387927f, -0.427119881f, 0.735217214f,
+    -0.660221219f, -0.506545424f, 0.25618574f, 0.147092491f, -0.399207711f, 0.6130023f, -0.721737862f, -0.977778018f,
+    0.163455844f, -0.657826841f, -0.591312528f, -0.333019555f, 0.472552299f, 0.153964341f, -0.771487296f, -0.639756501f,
+    0.624414623f, -0.387220949f, 0.641976595f, -0.949457705f, -0.210143551f, -0.737172961f, 0.104962431f, -0.463973999f,
+    0.361310333f, -0.343585968f, 0.53401345f, 0.331649929f, 0.867549121f, -0.725102842f, 0.317621589f, 0.752633095f,
+    0.36633113f, 0.573941708f, 0.754775882f, -0.868060768f, 0.716820955f, 0.672202647f, -0.960423529f, 0.679334223f,
+    0.785614491f, -0.531913579f, 0.465284944f, -0.679483831f, 0.551812887f, -0.624229133f, -0.447835237f, 0.611200988f,
+    0.809500694f, 0.513026953f, -0.491443127f, 0.122436762f, -0.768803716f, 0.406248957f, 0.575291455f, 0.529195309f,
+    -0.630097032f, -0.34948498f, -0.108729981f, -0.609674752f, -0.115331881f, 0.114002101f, -0.342830122f, -0.286083937f,
+    -0.409856141f, -0.996934712f, 0.999875963f, 0.904835999f, 0.24307394f, 0.767188609f, 0.139809549f, -0.868664026f,
+    -0.0317206755f, 0.516963959f, 0.889135599f, -0.925626397f, -0.403949767f, 0.716053367f, 0.316780269f, 0.370210081f,
+    0.636325598f, -0.161585137f, -0.957724869f, -0.0717396587f, 0.80206722f, -0.969319582f, -0.556509972f, 0.404249489f,
+    -0.455702275f, -0.214458272f, -0.935770273f, 0.00861455966f, -0.925765157f, -0.592386961f, 0.474519074f, -0.263506055f,
+    0.0141154015f, -0.14157927f, 0.909525156f, 0.229158059f, 0.988995969f, -0.631032765f, -0.826545119f, 0.907414556f,
+    -0.383959264f, 0.59035188f, 0.38263768f, -0.0545568839f, -0.624234915f, 0.550655127f, 0.211494267f, -0.828151643f,
+    0.585084796f, 0.91471827f, 0.490547657f, 0.804813921f, 0.0721862167f, -0.0132202897f, 0.726216376f, -0.467892498f,
+    0.0896036029f, 0.179107815f, -0.50072819f, 0.86723721f, 0.507434309f, 0.188913211f, -0.15016441f, 0.97846055f,
+    0.946089983f, -0.94811976f, -0.847717166f, 0.645374f, 0.497107148f, 0.263209701f, 0.480257541f, -0.404498518f,
+    0.116993539f, 0.913336754f, -0.573604405f, 0.513278544f, -0.444675148f, 0.706103444f, 0.866833985f, 0.805589199f,
+    0.938327432f, -0.0973387659f, -0.215472743f, -0.983157396f, 0.919712782f, -0.266228497f, 0.222329691f, 0.276247263f,
+    0.112108327f, -0.823826909f, 0.350110441f, -0.881656587f, 0.0171721056f, -0.307972729f, -0.574075818f, -0.222382396f,
+    0.441442311f, -0.344052553f, -0.77191025f, -0.333091617f, -0.0843224823f, 0.995429695f, 0.123309746f, -0.91076678f,
+    0.548594415f, -0.753148198f, 0.393174678f, -0.479334772f, -0.578740776f, -0.816488028f, 0.525232673f, -0.380123407f,
+    -0.990814865f, 0.664382041f, -0.574395001f, 0.820630133f, -0.439710706f, 0.120984457f, 0.483484656f, -0.0845223665f,
+    0.160006106f, -0.239948347f, 0.159190089f, -0.88477838f, -0.466437489f, 0.202144638f, -0.723715007f, 0.771578789f,
+    0.930260718f, 0.896585584f, 0.506123662f, 0.603034139f, -0.502405822f, -0.779837549f, 0.028883392f, -0.131991789f,
+    0.480794668f, 0.294882208f, -0.816254616f, 0.392765254f, -0.898717046f, -0.0162919182f, 0.0239405464f, 0.95363158f,
+    0.900246799f, 0.714389682f, 0.098699145f, -0.324833632f, -0.515900671f, 0.225737214f, 0.939270914f, -0.766362965f,
+    0.189136058f, -0.398313433f, 0.456440926f, 0.501075923f, 0.985601783f, -0.78025651f, 0.574267626f, -0.763880134f,
+    0.557638586f, 0.660939217f, -0.935029685f, -0.819720566f, 0.209037647f, 0.230105147f, -0.610821486f, -0.418554425f,
+    -0.403508067f, 0.349940479f, -0.0699887052f, 0.649635673f, 0.723811209f, 0.217762306f, 0.553531408f, -0.179407209f,
+    -0.0462906398f, 0.0587869957f, -0.328224957f, 0.553447783f, 0.199708313f, -0.942079127f, 0.410228908f, 0.878296316f,
+    0.580172837f, -0.936107635f, 0.845991731f, 0.875978112f, -0.217478558f, 0.596924245f, -0.350862771f, -0.388740033f,
+    0.508158386f, -0.289470136f, 0.503355503f, 0.374100596f, 0.744953036f, -0.498937786f, 0.752554476f, 0.927756488f,
+    0.928140819f, 0.881993592f, -0.636820078f, 0.183668897f, 0.239156574f, 0.321009845f, 0.683780193f, -0.361112714f,
+    -0.766434789f, 0.0516750738f, 0.469601959f, -0.479186982f, 0.797390163f, -0.0928807631f, 0.669909179f, 0.91200465f,
+    -0.677836418f, -0.845360935f, -0.542073071f, -0.807315707f, 0.529816568f, -0.0595873408f, -0.125022262f, 0.751245618f,
+    0.947206855f, 0.476785332f, 0.731729031f, 0.756602466f, -0.766348004f, 0.309694082f, 0.345357209f, -0.60620445f,
+    -0.152584285f, 0.39111796f, 0.974678278f, 0.288284928f, -0.685843468f, -0.182801455f, 0.236671314f, -0.306532711f,
+    -0.937992632f, -0.714457512f, 0.700044692f, 0.848270774f, -0.783588409f, 0.0186727922f, -0.7833637f, 0.683905482f,
+    -0.930265486f, -0.115806229f, -0.328913689f, -0.808057725f, 0.450272441f, 0.595143974f, -0.563693643f, -0.465901971f,
+    -0.165968597f, 0.433725238f, -0.87599355f, -0.226105854f, 0.356533498f, 0.468925655f, 0.956807077f, 0.116720922f,
+    -0.851641238f, 0.821025908f, -0.98212111f, -0.774841607f, -0.440962344f, 0.200114042f, 0.596744478f, -0.577225387f,
+    -0.14595519f, -0.053399764f, -0.670696437f, -0.507200778f, -0.764817417f, -0.225714192f, 0.0101197492f, -0.251140207f,
+    0.0932935998f, 0.595702171f, -0.878447592f, 0.70264405f, 0.122256376f, 0.599501133f, -0.209216848f, -0.522390127f,
+    0.568621933f, 0.530365586f, 0.495710075f, -0.909312308f, 0.0534269325f, 0.35554716f, 0.409620911f, 0.134164274f,
+    0.277280748f, -0.269365996f, 0.400460511f, 0.294466823f, 0.124775149f, -0.292748809f, -0.573645592f, -0.756341279f,
+    -0.674406826f, -0.920648694f, -0.287924558f, -0.220687434f, -0.35187456f, -0.132987231f, 0.0307231564f, -0.599674106f,
+    0.0514890961f, -0.846904635f, -0.02425595f, -0.901913404f, -0.146084502f, -0.468191445f, -0.652905762f, -0.381719321f,
+    0.765686631f, -0.962502301f, -0.492971748f, 0.620932698f, -0.40404138f, 0.0492057651f, -0.956317544f, -0.806638539f,
+    0.270052373f, 0.641548693f, 0.574104965f, 0.0015860335f, -0.627096355f, -0.387802631f, 0.718985975f, -0.430952787f,
+    0.320206821f, -0.470351785f, -0.548404932f, -0.45878315f, 0.886552811f, 0.130937293f, 0.594308019f, -0.303654343f,
+    -0.163457155f, -0.536269128f, -0.270955741f, 0.505025268f, 0.840576589f, -0.896181703f, 0.077588357f, 0.115604915f,
+    -0.67459774f, -0.550622404f, -0.694301128f, 0.234513536f, 0.969004095f, 0.348810047f, -0.183484599f, 0.654623926f,
+    0.286575347f, -0.374262333f, 0.859428346f, -0.0702890307f, -0.973714769f, -0.0611164533f, -0.256070048f, 0.0500344001f,
+    0.539187133f, 0.854210675f, -0.267328084f, -0.420299292f, 0.280860186f, -0.119344033f, -0.307421714f, -0.757457495f,
+    -0.47574839f, 0.98282522f, -0.849045157f, 0.376717299f, 0.550239801f, 0.942724347f, 0.957559407f, 0.674593925f,
+    -0.966530323f, 0.176578835f, -0.00637783576f, 0.821526647f, -0.583258569f, 0.0447538793f, 0.700196326f, -0.114889354f,
+    0.091945067f, -0.156512588f, -0.0812283754f, -0.208618417f, -0.998073757f, -0.381262213f, 0.0742491484f, -0.642282188f,
+    0.44329676f, -0.287044525f, 0.275860488f, -0.0765494928f, -0.41634497f, -0.0803066865f, -0.686211526f, 0.271354318f,
+    -0.54645884f, -0.451935887f, -0.456894964f, -0.381193936f, -0.907595396f, -0.60100019f, -0.544240594f, 0.790390491f,
+    0.880642951f, -0.211368963f, 0.920697391f, 0.509708345f, -0.178976789f, 0.246281296f, -0.707618535f, 0.961229742f,
+    -0.86740917f, -0.579647958f, -0.606963992f, 0.402359158f, 0.873478591f, -0.50393492f, -0.00792644732f, 0.802669227f,
+    0.819618225f, 0.125782907f, -0.198253706f, 0.842112005f, -0.531280458f, -0.255388111f, 0.729527533f, 0.455836892f,
+    0.498364985f, -0.672295511f, 0.763841152f, -0.979787827f, 0.277962714f, 0.387888283f, 0.63583988f, -0.875559747f,
+    -0.141964257f, 0.498671889f, -0.231342033f, -0.656105518f, -0.62021488f, -0.968578815f, 0.712360322f, 0.654330432f,
+    -0.323690027f, 0.356907845f, 0.304229081f, 0.379134715f, 0.412138045f, -0.0734830126f, 0.289451957f, 0.49428612f,
+    0.411340088f, 0.425081551f, 0.269688874f, 0.134247974f, -0.736608207f, -0.404304653f, -0.148532793f, 0.700999677f,
+    -0.385681272f, -0.777961731f, 0.784738243f, -0.711006999f, 0.0765124485f, 0.839940131f, -0.427409172f, -0.381994098f,
+    0.323127747f, -0.585434258f, -0.26719293f, 0.523615003f, 0.590522349f, 0.824997425f, -0.172704592f, -0.46313706f,
+    -0.675842226f, -0.555259228f, -0.800538003f, 0.897074997f, -0.865064085f, 0.258418679f, 0.0774333179f, 0.881272733f,
+    0.662955821f, 0.226076528f, 0.614817679f, -0.638044477f, 0.953824461f, -0.192581356f, -0.155435294f, -0.368706554f,
+    0.239957139f, -0.22399272f, 0.261964798f, -0.620864451f, -0.213173807f, 0.16053766f, -0.433526069f, 0.589769781f,
+    -0.232998848f, -0.437435746f, 0.320664793f, 0.0588455647f, 0.107200973f, -0.120598033f, 0.13847284f, -0.47341305f,
+    0.863881707f, -0.411685348f, 0.398114592f, 0.062794432f, 0.24770686f, -0.520152986f, 0.0400096811f, 0.11290139f,
+    0.898228288f, 0.0451582968f, 0.154850826f, 0.534388065f, 0.472165346f, -0.979951978f, 0.461816877f, -0.893620789f,
+    0.383250654f, 0.456123412f, -0.207460269f, -0.575151563f, -0.149635941f, -0.55069828f, 0.292102218f, -0.50421834f,
+    -0.947243512f, 0.507184088f, -0.467577606f, -0.187322974f, -0.203021929f, 0.409535021f, 0.374386519f, -0.199641868f,
+    -0.403666347f, -0.709167778f, 0.204122692f, 0.448441356f, 0.0325335078f, 0.226520523f, 0.572486937f, -0.49656114f,
+    -0.211005196f, -0.762848616f, 0.755020976f, 0.119086012f, 0.114817001f, -0.38502416f, -0.560775399f, 0.877518594f,
+    0.871387362f, 0.448360562f, -0.0087078074f, 0.152324408f, -0.205755994f, 0.643809915f, 0.436451644f, -0.727459311f,
+    0.15913102f, -0.112622835f, 0.0724925026f, 0.478176713f, -0.588814437f, -0.887941241f, 0.59319514f, 0.242098331f,
+    0.173806474f, 0.886462033f, -0.746538281f, -0.952512503f, -0.404484123f, 0.388978571f, -0.441749156f, -0.810013711f,
+    0.901178956f, 0.974036634f, 0.491105288f, -0.565190434f, -0.219381198f, -0.411880165f, 0.476541042f, -0.766667783f,
+    -0.245076284f, 0.807739854f, -0.0462485217f, 0.664801776f, 0.679922879f, -0.398995608f, -0.617232323f, -0.799794495f,
+    -0.657206416f, -0.573930264f, 0.022220239f, -0.998662353f, 0.563136339f, -0.773329914f, -0.155858025f, 0.171298772f,
+    -0.790990829f, 0.0471213125f, -0.45443365f, -0.706740856f, -0.706655622f, 0.904898763f, -0.518920243f, -0.130669639f,
+    0.512893677f, 0.864978731f, 0.926848888f, -0.959866643f, -0.898802638f, 0.300254613f, 0.463056356f, -0.83531785f,
+    0.788882971f, 0.568881392f, -0.00853703357f, -0.0685893148f, 0.824177086f, -0.693437874f, 0.458112925f, 0.104217649f,
+    -0.094416514f, 0.569981575f, 0.962891698f, -0.63124603f, -0.148176968f, 0.307653099f, 0.931732714f, -0.17195347f,
+    -0.861908138f, -0.581589878f, -0.776879847f, 0.442516714f, 0.191826239f, 0.290602714f, 0.491875798f, -0.125894591f,
+    -0.0801937059f, 0.500686526f, -0.1707021f, 0.538364768f, -0.802137077f, 0.25738579f, -0.838402092f, 0.166221067f,
+    0.0210992377f, -0.314055413f, -0.952440977f, 0.0855617821f, 0.0619643889f, 0.852074742f, 0.505849361f, 0.136316553f,
+    0.81563586f, 0.951437593f, -0.656731009f, -0.367993265f, -0.785776079f, -0.973537683f, 0.78499645f, 0.315511048f,
+    0.663466811f, 0.510766029f, 0.377647251f, 0.720749319f, 0.733870208f, -0.140759841f, 0.507483602f, -0.585987985f,
+    -0.32644546f, 0.123018339f, 0.731604397f, -0.474633992f, -0.590955913f, 0.326200783f, -0.200885281f, 0.199580938f,
+    -0.9806602f, 0.00662326766f, 0.205874726f, 0.0823255032f, -0.381615162f, 0.658632278f, 0.820005417f, 0.528485119f,
+    -0.0403727256f, -0.362053365f, -0.871744037f, 0.89624989f, 0.49536404f, -0.354902029f, 0.41177386f, -0.528435469f,
+    0.529660583f, 0.771918118f, -0.774136841f, -0.675905049f, 0.685218513f, -0.0140375122f, 0.595516205f, -0.448608071f,
+    0.503754914f, 0.0696666986f, 0.321078986f, 0.428840905f, -0.156862378f, -0.430105597f, -0.0305485241f, -0.146673307f,
+    -0.598797321f, -0.60870868f, -0.656619191f, -0.279038131f, -0.143085435f, -0.748836637f, -0.183072343f, -0.343160361f,
+    -0.630978644f, 0.0935614854f, -0.890160322f, -0.773578405f, 0.346845001f, -0.380109012f, 0.733568251f, -0.358897954f,
+    0.112053566f, 0.531101704f, -0.184828609f, -0.467392296f, 0.438847303f, -0.908329725f, 0.234878197f, 0.245427296f,
+    -0.754173398f, -0.657797754f, 0.505342007f, -0.351523668f, 0.172864124f, 0.522992253f, -0.951649904f, 0.772838473f,
+    0.609099805f, 0.00706368731f, 0.980680704f, -0.500419259f, 0.226100639f, -0.687274456f, 0.639401495f, -0.411791265f,
+    0.957107961f, 0.522690058f, 0.862900198f, -0.806257308f, -0.0644406825f, -0.0948412418f, 0.72476995f, 0.0963507965f,
+    0.0400511883f, 0.433619112f, 0.450290471f, 0.967087746f, -0.443584859f, -0.854775727f, -0.346924603f, -0.708950162f,
+    0.980269253f, -0.0291954186f, 0.663600624f, -0.37150678f, 0.0108603528f, 0.219052419f, 0.246903807f, -0.21144715f,
+    -0.0087289745f, 0.358783722f, -0.689472079f, -0.788937628f, 0.583131135f, -0.363595873f, -0.303188086f, 0.153296277f,
+    0.871858537f, -0.498269767f, 0.0548007004f, -0.0639006421f, 0.81745255f, -0.0859192833f, -0.522069573f, 0.0579842664f,
+    0.976253986f, 0.746903539f, -0.155816823f, -0.600361943f, 0.620593071f, -0.156041279f, 0.759722054f, 0.495100886f,
+    -0.148648709f, 0.139414161f, -0.104970679f, -0.844779372f, -0.976021111f, 0.727796733f, 0.130686119f, -0.874470294f,
+    -0.881101608f, -0.312811166f, -0.139738932f, -0.579987407f, -0.723944545f, 0.977294147f, 0.133626729f, 0.154698864f,
+    0.734415412f, -0.629230022f, 0.910741091f, 0.649710476f, -0.0425747745f, -0.411801815f, -0.708316445f, -0.175620571f,
+    -0.991453648f, 0.468320668f, -0.791205585f, 0.957136929f, -0.312174529f, -0.814261198f, -0.279857278f, 0.617589235f,
+    -0.300214678f, -0.377143234f, 0.0286055058f, -0.0128093939f, -0.0840181187f, 0.28868109f, 0.367273688f, 0.672459781f,
+    -0.617385805f, -0.592389822f, -0.874740899f, -0.178750142f, 0.913580775f, -0.2055507f, -0.526234508f, 0.422945827f,
+    -0.553053141f, 0.0436850078f, 0.20316489f, -0.915406466f, -0.16713208f, 0.521467626f, 0.774627447f, -0.950552464f,
+    0.425343215f, 0.1534141f, 0.0778637156f, -0.0833738446f, 0.294331044f, -0.666446805f, 0.287757307f, -0.474202663f,
+    0.831626892f, -0.164325237f, -0.050014846f, -0.424224287f, 0.788249373f, -0.00204204768f, -0.919258654f, -0.757139087f,
+    -0.765841663f, 0.925002813f, -0.88789469f, -0.32424432f, -0.560737491f, 0.523082435f, -0.19280684f, 0.314704806f,
+    -0.317514807f, -0.204905361f, 0.390048176f, 0.19650571f, -0.262072325f, -0.50337702f, 0.243874982f, -0.49553746f,
+    0.406557739f, -0.493236035f, 0.301342905f, 0.0740498453f, -0.566912413f, 0.975178301f, 0.538508952f, 0.77616322f,
+    -0.225186378f, 0.431804895f, -0.144305646f, -0.189668983f, -0.815611064f, 0.55418241f, 0.353562087f, -0.347331464f,
+    -0.541914701f, 0.119583696f, -0.537132978f, -0.637259066f, -0.780930042f, 0.882421553f, 0.198650554f, -0.956544936f,
+    -0.903658926f, -0.909529924f, -0.945337057f, -0.346393406f, -0.568736434f, -0.807111979f, 0.0749502182f, -0.397988677f,
+    0.565575123f, -0.808802545f, -0.787447035f, 0.252729833f, -0.870677948f, -0.909363866f, -0.146910727f, 0.434064388f,
+    0.854129136f, 0.0787710473f, -0.693492711f, -0.741686285f, -0.542482972f, -0.304697484f, -0.16328451f, -0.0971695483f,
+    -0.895826519f, -0.452640235f, -0.430061489f, -0.179731384f, 0.117336407f, -0.93166101f, 0.0331090018f, -0.698217869f,
+    0.787362456f, 0.93719542f, -0.429330945f, -0.936165869f, -0.507292151f, 0.555245936f, -0.936652958f, 0.319110006f,
+    0.903152585f, -0.229632929f, -0.185569257f, -0.0438405573f, -0.4525249f, -0.182005137f, -0.696907103f, -0.819946349f,
+    -0.225071445f, 0.837301731f, 0.167949006f, 0.461128563f, 0.801034808f, 0.0485039726f, -0.684976995f, -0.624431014f,
+    -0.630681634f, 0.857934713f, -0.294814497f, -0.449140757f, 0.037840113f, 0.47185427f, 0.923866451f, 0.64788264f,
+    0.618146062f, -0.902309895f, 0.770353556f, -0.987999558f, 0.0891513228f, 0.135948524f, 0.660991132f, -0.905296087f,
+    -0.561784744f, 0.657060981f, 0.53290236f, 0.269645452f, -0.176379964f, -0.804162562f, 0.739702642f, 0.933200359f,
+    0.92154187f, -0.801095068f, 0.292909592f, 0.459344625f, 0.673712432f, -0.854747355f, 0.25534904f, -0.0971827358f,
+    -0.203749239f, -0.379593283f, 0.0986657366f, -0.878793061f, -0.441593498f, -0.077474013f, -0.0729228184f, 0.417036653f,
+    -0.264597416f, -0.595909178f, 0.510821164f, -0.074863106f, -0.7270872f, 0.819647789f, -0.450111806f, -0.416472167f,
+    0.965547204f, -0.952283621f, 0.459863484f, 0.802782536f, 0.582451224f, 0.601283014f, 0.129855871f, -0.63420701f,
+    -0.473619908f, 0.688309252f, 0.981390536f, 0.107876241f, -0.137216821f, 0.333886832f, -0.24271661f, 0.354567558f,
+    0.277416825f, -0.88224411f, 0.247623011f, -0.813817024f, 0.574866891f, -0.347005665f, -0.864521205f, 0.452055931f,
+    -0.925913572f, -0.697108924f, 0.933292747f, 0.838809848f, 0.223329708f, 0.713230729f, 0.0439161956f, -0.0491523631f,
+    0.680670798f, -0.40637669f, 0.0938912928f, 0.64659059f, 0.13336733f, 0.291264415f, -0.934344888f, -0.65860343f,
+    0.918545842f, 0.792458653f, -0.510865331f, -0.282799542f, 0.162165776f, 0.770763993f, 0.621871948f, 0.504526794f,
+    0.401497751f, 0.477466762f, -0.55882889f, -0.533305943f, 0.746121585f, -0.410804033f, 0.886329234f, 0.243774474f,
+    -0.976223648f, 0.324088931f, 0.41224885f, 0.998124123f, 0.278925538f, 0.070266068f, -0.0362718217f, -0.932820857f,
+    0.0677207708f, -0.364621222f, -0.0119106229f, -0.756527424f, 0.733772874f, -0.0343892723f, -0.949359715f, -0.764289796f,
+    -0.178708687f, -0.958420038f, 0.0608066544f, 0.828727424f, -0.128782406f, -0.97192657f, 0.229068026f, -0.246498868f,
+    0.579434216f, -0.356151611f, 0.880803287f, -0.252040923f, -0.00172543409f, -0.34539181f, 0.239073709f, -0.0423602052f,
+    0.288043946f, 0.248206839f, 0.870865226f, -0.620091617f, -0.877595842f, 0.901297152f, 0.241280138f, -0.951009095f,
+    -0.402920306f, 0.472697496f, -0.726446152f, -0.703488588f, -0.475685239f, -0.692776442f, -0.162385613f, -0.766275764f,
+    -0.739073873f, 0.113334604f, 0.119585216f, 0.256982118f, -0.93765831f, 0.255494952f, -0.480783612f, 0.00730455108f,
+    -0.105233289f, -0.0540182889f, 0.219290406f, -0.735736191f, -0.565053999f, -0.0886007473f, -0.178329736f, -0.994821489f,
+    0.733874857f, -0.981734633f, 0.0606986359f, 0.339222759f, -0.642853856f, -0.747587979f, -0.289296299f, 0.136826262f,
+    -0.813962996f, 0.886696398f, 0.978145003f, -0.466718137f, 0.0901862383f, 0.902060926f, -0.383935243f, -0.196236238f,
+    -0.415460199f, 0.712546766f, -0.384576827f, 0.259355307f, -0.522257626f, 0.967358887f, -0.302836061f, 0.152045131f,
+    0.417805523f, 0.540166974f, -0.39412412f, 0.343490034f, 0.943937004f, 0.394862771f, 0.073923938f, 0.570918918f,
+    0.627221048f, -0.076952301f, -0.774832547f, -0.256272793f, -0.137297675f, 0.237212151f, 0.466611803f, -0.392288864f,
+    0.761091113f, -0.257365942f, -0.678819597f, 0.80201453f, 0.516236424f, -0.610420525f, 0.487865716f, -0.75271219f,
+    0.5620839f, 0.297912627f, 0.642135262f, -0.288300246f, 0.752711415f, 0.756726444f, 0.034983255f, 0.480121136f,
+    0.706956983f, 0.551729977f, -0.343247592f, 0.580093384f, -0.390346467f, 0.197723597f, -0.829596221f, 0.231354132f,
+    -0.35899815f, -0.902027845f, 0.0902920887f, 0.326322377f, 0.299325556f, -0.502150714f, 0.119678877f, 0.0661873668f,
+    0.825220346f, 0.456648111f, -0.0712579116f, 0.207525462f, 0.53380394f, 0.788485825f, -0.935841143f, 0.16635555f,
+    0.304270566f, -0.0123298177f, -0.931317329f, 0.119346306f, -0.680097818f, -0.740812063f, 0.357590735f, -0.320519984f,
+    0.66384238f, -0.760011613f, -0.364642948f, -0.50569123f, -0.513830304f, -0.337482154f, 0.0256666876f, -0.252783537f,
+    -0.171097532f, 0.161680296f, 0.921347916f, -0.525180042f, -0.289441019f, 0.867395043f, -0.21581465f, -0.624226332f,
+    -0.133671001f, -0.480881035f, -0.0593149476f, 0.647442281f, 0.596485198f, -0.866419733f, -0.901666641f, 0.657336712f,
+    -0.968338609f, -0.270699799f, -0.595127523f, -0.7827968f, -0.836152494f, 0.633421421f, 0.1196502f, -0.0564952455f,
+    -0.727640748f, -0.043132633f, -0.30696851f, 0.885949373f, 0.878503263f, -0.849010825f, 0.764070809f, 0.103841983f,
+    -0.605588436f, 0.16995129f, -0.848295331f, 0.13874577f, 0.136574715f, -0.882368922f, 0.845358491f, 0.352249473f,
+    0.58798188f, 0.442468911f, 0.22727637f, -0.79430306f, -0.775268793f, -0.943514943f, 0.682984531f, 0.168999255f,
+    0.288889319f, 0.806702137f, -0.462865174f, 0.634539843f, -0.021868553f, 0.33332479f, 0.569859326f, 0.999972999f,
+    0.866740465f, -0.843095958f, 0.941733479f, 0.109972611f, -0.884357214f, 0.23525165f, 0.0258966237f, 0.476652712f,
+    -0.65888083f, -0.55430311f, 0.0522185527f, -0.0427034423f, -0.411729634f, -0.0496095233f, 0.556463778f, -0.0792523548f,
+    -0.117713928f, 0.240784362f, 0.480318099f, 0.720195115f, 0.535949409f, 0.917768538f, -0.455229223f, -0.493732065f,
+    -0.995835006f, -0.875783384f, 0.925230563f, -0.533399105f, -0.498127669f, 0.523142457f, -0.522269189f, 0.0763726905f,
+    0.882103086f, 0.516015351f, -0.601215839f, 0.101598449f, -0.46489498f, -0.263504922f, 0.346648991f, -0.508331478f,
+    -0.915318549f, -0.890621245f, -0.644091189f, 0.918128014f, 0.993528783f, 0.646184504f, -0.224976167f, 0.884168029f,
+    0.38975665f, -0.94620502f, 0.650603056f, -0.676779687f, -0.0492490381f, 0.934559107f, 0.687903404f, -0.470497608f,
+    -0.113579184f, 0.824127972f, 0.871539891f, -0.464916736f, -0.239649698f, -0.038045425f, -0.134266853f, -0.84378165f,
+    -0.968898535f, -0.0659372881f, 0.919055641f, 0.720116436f, -0.384869397f, 0.889843166f, -0.449435383f, 0.65161556f,
+    -0.442566335f, -0.364410728f, 0.955851555f, -0.363748699f, 0.39805451f, 0.204853892f, 0.881848097f, 0.948911071f,
+    0.612942934f, 0.167902857f, -0.858498156f, -0.434243739f, 0.523614347f, 0.388089627f, -0.857410491f, -0.757957876f,
+    -0.208422676f, 0.220905423f, -0.874996662f, -0.175477549f, -0.620512605f, 0.741633534f, 0.856804192f, -0.342888355f,
+    -0.475907207f, 0.0535824485f, -0.629265428f, 0.280128717f, -0.434008449f, -0.80527705f, -0.0732707754f, -0.0220710821f,
+    -0.761614382f, -0.462446839f, -0.698211789f, -0.198905915f, -0.724272907f, -0.159524441f, -0.971125066f, 0.0322454125f,
+    -0.338045686f, -0.0882456154f, 0.847053647f, -0.941296518f, -0.801335156f, 0.478358358f, -0.451688617f, -0.47227028f,
+    0.815442801f, -0.584475338f, -0.101273887f, -0.0441979095f, 0.0696912035f, -0.129214123f, -0.989069521f, -0.988804996f,
+    -0.514343441f, 0.401682347f, 0.120591797f, -0.378043085f, 0.125188157f, 0.826771379f, -0.469285429f, 0.514803529f,
+    0.907097876f, 0.67452836f, -0.525408268f, 0.33186397f, 0.48486039f, -0.135612205f, 0.967221975f, -0.809137523f,
+    -0.0119871711f, 0.952154875f, -0.865462184f, 0.510055482f, -0.765559137f, 0.235955313f, 0.417448968f, -0.985799074f,
+    -0.303613871f, -0.588027239f, 0.84256959f, -0.552807808f, 0.126551971f, -0.208741516f, 0.693298101f, 0.337545246f,
+    -0.181300119f, -0.262228489f, 0.551125646f, 0.854568422f, 0.485330671f, -0.184544757f, -0.863393128f, 0.0258412194f,
+    -0.0729731172f, 0.958803236f, 0.692243993f, -0.524045825f, -0.160293832f, -0.296388626f, 0.662729859f, -0.138565734f,
+    0.440092504f, -0.732179046f, -0.68197757f, -0.169339776f, 0.913289607f, -0.25127092f, 0.162351042f, -0.669473112f,
+    0.401284873f, -0.332537413f, -0.852062464f, 0.782837868f, -0.374949396f, -0.342364937f, 0.637541234f, 0.140021756f,
+    0.287647396f, 0.0730576292f, -0.862111628f, 0.801166832f, 0.635716677f, 0.131781623f, -0.529452145f, -0.00992525835f,
+    -0.448759347f, -0.804551542f, 0.750882804f, -0.102291144f, 0.0416921824f, 0.782357454f, -0.714657366f, 0.935262799f,
+    -0.193893343f, -0.827911139f, -0.0010334691f, -0.266100913f, 0.367510706f, -0.218841493f, 0.65311414f, -0.450499654f,
+    -0.651403725f, 0.1530862f, 0.547302902f, 0.295449883f, 0.0647081435f, 0.288427979f, 0.815729439f, -0.334283888f,
+    -0.362627596f, 0.65192914f, 0.550819933f, -0.0724137798f, -0.799161434f, -0.975062132f, -0.54464066f, -0.480088741f,
+    0.289967597f, -0.199923724f, 0.862045944f, -0.711126924f, -0.492520541f, -0.279082447f, 0.450377703f, -0.669323027f,
+    0.56357348f, -0.0166698154f, -0.739173234f, 0.801921904f, 0.301547617f, -0.12716049f, -0.811162591f, 0.406794965f,
+    0.262401253f, 0.982527852f, -0.0540948324f, 0.840910316f, -0.324519634f, -0.165308982f, -0.26004234f, 0.635262966f,
+    -0.528909028f, 0.78102982f, 0.20663029f, -0.848287523f, 0.737301826f, -0.0290874727f, 0.378026426f, 0.247951552f,
+    0.439600736f, 0.395249456f, 0.94900769f, -0.312335521f, 0.854492962f, -0.0247959942f, -0.354782432f, 0.821640491f,
+    -0.549781919f, 0.142301366f, 0.469033122f, 0.589482248f, -0.267889321f, -0.862015784f, -0.445558578f, -0.452218652f,
+    -0.74272126f, -0.684297502f, -0.900509059f, 0.383150011f, 0.159272552f, -0.360509187f, 0.900483668f, -0.546993673f,
+    0.845442057f, 0.43539381f, -0.503297329f, -0.975707948f, -0.238608345f, 0.921637058f, -0.706137836f, 0.0810649246f,
+    0.840187609f, 0.0239264704f, 0.7710765f, -0.975267053f, -0.525226355f, -0.980740368f, -0.0403808057f, 0.390985876f,
+    0.789696932f, 0.7500633f, -0.156364664f, 0.568118632f, -0.175002649f, -0.343491107f, -0.566822588f, -0.228280395f,
+    0.162411854f, 0.77527988f, 0.978511512f, -0.894105554f, -0.922785878f, 0.964413226f, -0.70235759f, 0.76085639f,
+    -0.0136089744f, -0.0368279219f, -0.679157853f, 0.92486155f, 0.7887519f, -0.386127472f, -0.184822962f, 0.623156846f,
+    -0.12255086f, -0.807110548f, 0.673212945f, -0.600069344f, -0.845682621f, -0.382576257f, 0.317599475f, 0.644280374f,
+    -0.531488121f, -0.705125451f, -0.269864976f, 0.144468576f, -0.254985899f, -0.814967036f, 0.226857021f, 0.74947691f,
+    0.9062078f, 0.328784257f, 0.394085646f, 0.757294595f, 0.315597653f, -0.515682757f, -0.356027842f, -0.766874492f,
+    0.305990428f, 0.991322041f, 0.396297038f, -0.398200452f, 0.842719972f, 0.514360607f, 0.531950712f, 0.462659985f,
+    0.0717783645f, -0.679385841f, -0.0877575651f, 0.576064825f, -0.135155171f, -0.415578783f, -0.0231125429f, 0.993145943f,
+    -0.27330184f, 0.172820136f, 0.168661967f, -0.620097101f, -0.942700028f, -0.925421119f, 0.233788282f, -0.0455395505f,
+    0.814843237f, 0.0628407523f, -0.661620855f, 0.846094012f, 0.13541384f, -0.876367092f, 0.836424053f, -0.197519824f,
+};
+static const float bias_0[128] = {
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+};
+
+// Dense 1: 128 -> 5 (STATIC_ACT_SOFTMAX)
+static const float weights_1[640] = {
+    -0.546108365f, -0.159335092f, -0.539268196f, 0.379845679f, -0.198821411f, -0.53129673f, 0.679176927f, 0.235633358f,
+    0.0199021734f, -0.375978023f, -0.441148192f, -0.546175957f, -0.437011778f, -0.228459209f, -0.556472182f, 0.575485468f,
+    -0.589703381f, 0.816384614f, -0.0403494053f, -0.225137338f, 0.304075748f, -0.177392647f, -0.0343619026f, 0.768726587f,
+    -0.509501696f, 0.939774215f, -0.28645131f, -0.0127849784f, -0.432831705f, -0.566770852f, 0.544464231f, -0.912356198f,
+    -0.31519407f, -0.856021345f, 0.344665349f, -0.651296556f, 0.158733577f, 0.703810871f, -0.705696642f, -0.0538685843f,
+    0.404836595f, -0.0489490852f, -0.139201999f, 0.0524737835f, -0.493574321f, 0.237776145f, 0.600769222f, 0.0249565933f,
+    0.280317217f, -0.707212448f, -0.0154942637f, 0.528095961f, 0.44309786f, 0.760955632f, -0.291929901f, -0.995642483f,
+    0.952236593f, 0.962661922f, -0.334613413f, -0.709755123f, 0.584768176f, -0.357263565f, 0.0716191828f, -0.18330574f,
+    0.878874242f, 0.703617513f, 0.364252985f, 0.570532203f, 0.117788114f, 0.0873325169f, 0.193732053f, 0.637626112f,
+    -0.990621865f, -0.898099005f, -0.767232537f, -0.687349916f, -0.326485664f, -0.745757997f, 0.813545227f, -0.542161107f,
+    0.436929524f, 0.825609386f, 0.155026063f, -0.362159491f, -0.490405232f, -0.940595031f, -0.421005338f, -0.290778339f,
+    -0.122900784f, -0.0583115891f, 0.806066453f, -0.658315778f, -0.539466023f, 0.136752173f, -0.821444511f, 0.463327348f,
+    0.0841460526f, 0.638454437f, 0.207502738f, 0.359644711f, 0.447254956f, -0.899589539f, 0.9149189f, -0.128317103f,
+    -0.00931706186f, -0.501425803f, 0.0475950427f, -0.560811996f, -0.183860898f, 0.817084968f, 0.917590559f, 0.191084445f,
+    0.572984755f, 0.380601823f, -0.738086045f, 0.867146552f, -0.538399339f, 0.529214203f, 0.746772885f, 0.499931872f,
+    -0.0406039804f, -0.323418349f, 0.833351493f, -0.931240916f, -0.578315258f, -0.0573755316f, 0.552109957f, -0.614504158f,
+    0.674350023f, -0.650132835f, -0.656936347f, 0.545081377f, -0.596253037f, 0.0622341968f, -0.827514589f, 0.91170454f,
+    0.785544991f, -0.596097946f, -0.223913401f, -0.456746221f, -0.810930669f, 0.370166868f, 0.755629003f, 0.413922369f,
+    -0.0233899765f, 0.977391839f, 0.11781019f, -0.86438185f, -0.401660293f, 0.955617011f, -0.806834757f, -0.711479127f,
+    0.656425774f, -0.585251033f, 0.933157682f, 0.198277369f, -0.570166171f, 0.895009398f, 0.84419775f, 0.342466027f,
+    0.072547242f, 0.660172641f, 0.957754314f, -0.262309045f, -0.475250721f, 0.695219278f, -0.544328988f, 0.838824213f,
+    -0.0658983588f, 0.981077909f, 0.0574867278f, -0.33874777f, 0.144078285f, 0.350821882f, 0.22558783f, -0.513838172f,
+    -0.995228052f, 0.767237604f, -0.11480473f, -0.419493794f, 0.0930493996f, -0.764042139f, -0.251659065f, 0.108772121f,
+    -0.644629478f, 0.942963481f, 0.213660464f, -0.918464422f, -0.63335222f, 0.779309154f, 0.924684465f, 0.979322493f,
+    -0.0335452892f, -0.465279549f, 0.620923996f, -0.642902255f, 0.0162089504f, -0.655239046f, 0.312060624f, 0.587521791f,
+    0.423383892f, 0.130264685f, -0.814338446f, -0.600155771f, -0.896261454f, 0.30706802f, -0.945473611f, -0.927534163f,
+    -0.899692237f, -0.598634958f, 0.280131042f, -0.699750543f, 0.132797986f, 0.15762794f, -0.0170875937f, -0.071919553f,
+    0.802301347f, -0.367609352f, -0.499250144f, -0.743172765f, 0.679359972f, -0.693756878f, 0.065373227f, 0.690888822f,
+    0.791006148f, -0.487438649f, 0.687349021f, -0.528789043f, 0.874801457f, -0.833891392f, 0.435261399f, 0.385367244f,
+    0.884630501f, -0.112027936f, 0.461924344f, -0.543904424f, 0.326647907f, -0.777483702f, -0.25971359f, -0.682739615f,
+    -0.726172626f, 0.0748175532f, 0.863348365f, -0.923946977f, 0.949941695f, -0.246783376f, -0.71295011f, 0.0939892754f,
+    0.00432515983f, -0.210494846f, 0.0673851222f, 0.162790224f, -0.266052634f, 0.47707203f, 0.273138374f, 0.30070895f,
+    0.36142382f, -0.834664106f, -0.927797258f, -0.205970064f, 0.414574504f, 0.0718045309f, -0.917493641f, -0.673727691f,
+    0.76858294f, -0.638625324f, -0.208345756f, -0.997290254f, -0.568252087f, -0.47813645f, 0.792880237f, 0.559017062f,
+    0.265314817f, 0.609239459f, -0.676553011f, 0.0741328895f, -0.117285378f, -0.320146769f, 0.363772333f, 0.988816082f,
+    0.615026772f, 0.597173452f, -0.724652588f, -0.4607189f, -0.908494115f, -0.983685851f, -0.601856112f, -0.099886626f,
+    -0.846204817f, -0.687306941f, -0.994784653f, -0.144680485f, -0.0122790365f, 0.752419174f, 0.737627447f, -0.583044887f,
+    -0.787192702f, 0.903384864f, -0.153239816f, -0.485264063f, 0.557112634f, -0.256306052f, 0.671668947f, 0.277941287f,
+    0.346014202f, 0.163239956f, 0.177770585f, 0.691031754f, -0.05763321f, -0.177673757f, -0.621985853f, 0.0396845415f,
+    -0.52109611f, -0.911835849f, -0.697502792f, -0.714118242f, 0.568632603f, -0.798482418f, 0.0351189338f, 0.157610595f,
+    -0.376334131f, 0.380413145f, -0.21430847f, -0.215961784f, -0.0384225845f, -0.781050444f, 0.140305027f, 0.798719168f,
+    0.168440551f, 0.883576512f, -0.148142323f, 0.409416288f, 0.40368861f, -0.789510012f, -0.942884743f, -0.011066366f,
+    0.204936162f, 0.260231167f, -0.0279843379f, -0.263179183f, -0.736601055f, 0.430361837f, -0.592966616f, -0.217348218f,
+    0.728947341f, 0.456448317f, -0.338325799f, -0.108147085f, -0.0101467837f, -0.981844962f, -0.892389357f, 0.689607918f,
+    -0.0517588742f, -0.815697789f, 0.98557061f, 0.23065947f, -0.423878908f, -0.564540923f, -0.793077826f, 0.279084146f,
+    0.741169572f, -0.576100826f, -0.349496305f, 0.370768249f, -0.205887839f, -0.314459711f, -0.0276119616f, 0.486530751f,
+    0.281476319f, -0.18644838f, 0.497281313f, 0.520338714f, -0.255654395f, 0.887854278f, -0.074320592f, -0.281959057f,
+    -0.0669117868f, 0.618263483f, 0.331531078f, 0.0802152082f, -0.952838182f, 0.829865813f, 0.0320784897f, 0.492542326f,
+    0.563888371f, -0.0734128207f, 0.886158526f, -0.540641248f, -0.411262274f, 0.0181459039f, 0.722957194f, -0.873978019f,
+    -0.97367394f, -0.166553095f, -0.833225965f, 0.818405032f, 0.0621040054f, 0.916720688f, -0.931410909f, -0.414473593f,
+    0.077214472f, -0.374276042f, -0.0449139327f, -0.945943952f, -0.0413179621f, -0.452901065f, -0.970972121f, -0.293080747f,
+    0.737777531f, 0.312120199f, -0.454998314f, -0.0939156935f, -0.158504561f, -0.884793997f, -0.758268952f, 0.131981581f,
+    0.649377584f, -0.980360448f, 0.140356168f, 0.898172319f, 0.444491178f, 0.44296512f, 0.785734594f, -0.438270092f,
+    0.255573243f, 0.256482482f, -0.190734833f, -0.15004763f, 0.265933603f, -0.880283296f, -0.422315091f, -0.837463498f,
+    -0.0238326527f, 0.693781793f, 0.966571152f, 0.618036985f, 0.569414735f, -0.0452649295f, 0.131684288f, 0.921404958f,
+    -0.175885841f, -0.776026547f, 0.024167126f, 0.56687516f, -0.775452495f, -0.126195699f, -0.684826672f, -0.164471745f,
+    -0.059245687f, 0.693748355f, 0.808329225f, 0.655725479f, -0.976408601f, -0.366318733f, 0.614898801f, -0.980921209f,
+    -0.138104931f, -0.37852329f, -0.548191667f, 0.408769041f, 0.954525113f, 0.662504733f, 0.65583688f, 0.794777155f,
+    0.159341007f, 0.421509594f, 0.914674759f, 0.830930054f, -0.508972704f, -0.138799563f, 0.517018259f, 0.244622529f,
+    0.974799633f, -0.741870642f, 0.393773347f, 0.860279202f, -0.691327214f, 0.518690825f, -0.0598047972f, -0.245819628f,
+    0.563606501f, -0.161233798f, -0.784207284f, -0.29503563f, 0.534165323f, 0.318999618f, -0.748492539f, -0.262706459f,
+    -0.418563187f, -0.877408206f, 0.892901123f, 0.476194978f, -0.0129158553f, 0.0329956822f, 0.249218956f, 0.399948567f,
+    -0.637378693f, -0.163962349f, -0.523921549f, -0.41201508f, 0.357740611f, 0.61387676f, -0.6615839f, -0.561899841f,
+    0.519139826f, 0.842012167f, 0.664301276f, 0.537006915f, 0.197582275f, -0.726035655f, 0.672451198f, -0.831458449f,
+    0.767427802f, -0.960489333f, 0.713280201f, 0.657489479f, 0.0774351209f, 0.745740533f, 0.270770878f, 0.155666456f,
+    -0.0426067933f, -0.564836562f, -0.931051672f, -0.590818346f, 0.41521427f, 0.0206939206f, -0.612746537f, -0.0832024738f,
+    -0.342256129f, 0.514888585f, -0.00475522969f, 0.039485991f, 0.761325061f, 0.908836186f, -0.199872971f, -0.856865346f,
+    0.781993032f, -0.976571143f, -0.952360094f, -0.496638238f, -0.138633966f, 0.630866945f, 0.962524593f, -0.883995473f,
+    0.314023942f, -0.596330941f, -0.689425766f, -0.275940359f, -0.892195046f, 0.379111975f, 0.93393296f, 0.105284564f,
+    -0.465573877f, 0.26578173f, -0.276286364f, 0.943334818f, 0.667090237f, -0.384080142f, -0.183515772f, -0.0134835551f,
+    0.0744161978f, -0.764357984f, -0.653225601f, 0.728750467f, 0.243990302f, -0.367821574f, 0.984310925f, 0.014836059f,
+    0.111379981f, 0.630856514f, 0.829358578f, 0.299449801f, 0.767550349f, 0.259883344f, -0.963398218f, -0.890310109f,
+    0.938067973f, -0.650271654f, 0.140469044f, -0.280491203f, 0.120460741f, -0.378839761f, 0.48675701f, 0.893106759f,
+    -0.939399898f, 0.837908447f, -0.242166832f, 0.437601984f, 0.639172018f, -0.659270763f, -0.135002181f, 0.808133066f,
+    -0.503189683f, 0.206251457f, -0.391404837f, 0.613590837f, -0.592917502f, -0.396357596f, 0.405707955f, 0.849938214f,
+    0.733849764f, 0.779686511f, -0.963186324f, 0.552721381f, -0.599979281f, -0.42306295f, 0.820983827f, -0.992160261f,
+    0.237981796f, 0.554293036f, -0.535357416f, 0.95945245f, 0.542730868f, -0.919243336f, -0.615853846f, 0.792932391f,
+    -0.78178668f, -0.384180158f, -0.384595275f, -0.362550169f, -0.881571054f, 0.0302759074f, -0.423844486f, -0.166476756f,
+    0.0137827536f, 0.306767672f, 0.826227725f, -0.325963408f, 0.680956125f, 0.30048883f, -0.466488421f, -0.000104391052f,
+    0.242126897f, 0.905099869f, 0.894389749f, -0.289834768f, -0.583525002f, 0.134758741f, 0.490494102f, 0.270417243f,
+};
+static const float bias_1[5] = {
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+};
+
+typedef StaticModel<
+    StaticDense<128, 128, STATIC_ACT_RELU>,
+    StaticDense<128, 5, STATIC_ACT_SOFTMAX>
+> Model;
+
+static const Model model = { { weights_0, bias_0 }, { weights_1, bias_1 } };
+
+static const uint16_t input_dim = 128;
+static const uint16_t output_dim = 5;
+
+// Run one forward pass. output must hold output_dim floats.
+inline void infer(const float* input, float* output) {
+    model.forward(input, output);
+}
+
+} // namespace sentinel_god
+
+#endif // SENTINEL_GOD_STATIC_MODEL_H
@@ -38,29 +38,51 @@ struct SensorPacket {
 SensorPacket sensor_queue[4];
 volatile uint8_t queue_head = 0;
 
+// --- Reflex Fast Path ---
+// Pre-registered action that runs INSIDE the PIO IRQ handler,
+// microseconds after the pin edge: raise the interlock output before
+// either core's loop has even seen the event. The cognitive layers
+// below only observe and log what the spinal cord already did.
+#define INTERLOCK_PIN 14
+void reflex_fast_action() {
+    gpio_put(INTERLOCK_PIN, 1);
+}
+
 // --- Core 1: The "Basal Ganglia" (Reflexes & Sensors) ---
 // Runs independently of the AI Brain.
 // Monitors PIO, Reads Sensors, Handles Security.
 void setup1() {
+    // 0. Interlock actuator (driven from IRQ context by the reflex)
+    gpio_init(INTERLOCK_PIN);
+    gpio_set_dir(INTERLOCK_PIN, GPIO_OUT);
+    gpio_put(INTERLOCK_PIN, 0);
+
     // 1. Initialize Reflex Arc (PIO) on Pin 15 (hypothetical PIR/Motion)
-    ReflexArc::init(15);
-    
+    //    Edges are handled in the IRQ: actuate, timestamp, enqueue.
+    ReflexArc::init(15, reflex_fast_action);
+
     // 2. Initialize SIO Acceleration Unit (Core 1 unique instance)
     SIOAccel::begin();
 }
 
 void loop1() {
-    // A: High-Speed Polling (Simulated Reflex)
-    // If PIO detected movement (simulated by random here for demo)
-    if (random(1000) < 2) { 
+    // A: Drain the high-priority reflex lane. The actuation already
+    // happened in the IRQ handler - this is just bookkeeping: hand the
+    // timestamped event to Core 0 and flag the cognitive cycle.
+    ReflexEvent ev;
+    while (ReflexArc::pop(&ev)) {
+        SensorPacket& pkt = sensor_queue[queue_head & 3];
+        pkt.timestamp = (uint32_t)ev.t_us;
+        pkt.type = 0; // Motion
+        queue_head++;
         reflex_triggered = true;
     }
-    
+
     // B: Security Watchdog (JIT Decryption Simulation)
     // Burn cycles decrypting "next instruction"
     // SIOAccel::jit_decrypt_layer(NULL, 64);
-    
-    delay(10); // Run at 100Hz
+
+    delay(10); // Run at 100Hz (reflex latency no longer depends on this)
 }
 
 // --- Core 0: The "Cortex" (Thinking & Planning) ---
@@ -69,15 +91,22 @@ void loop1() {
 void setup() {
     Serial.begin(115200);
     perf.begin();
-    
-    
-    // Initialize Vector Memory
-    memory.count = 0;
-    
+
+    // One-shot kernel benchmark: naive byte loop vs word-unrolled Q7 MAC
+    SIOAccel::benchmark();
+
+
+    // Initialize Vector Memory - replays the LittleFS journal, so
+    // everything taught before the last power cycle comes back
+    uint8_t recovered = memory.begin();
+    Serial.printf("[BRAIN] %u memories recovered from flash\n", recovered);
+
     // Pre-load some vectors (Hardcoded knowledge for demo)
-    float vec_person[128];
-    for(int i=0; i<128; i++) vec_person[i] = (float)i/128.0; 
-    memory.add_vector(vec_person, "Unknown Person");
+    if (recovered == 0) {
+        float vec_person[128];
+        for(int i=0; i<128; i++) vec_person[i] = (float)i/128.0;
+        memory.add_vector(vec_person, "Unknown Person");
+    }
     
     // Mock parsing the model (In real life, read from Flash)
     // We just verify the parser compiles and logic holds
@@ -103,14 +132,24 @@ void loop() {
     if (reflex_triggered) {
         inferences++;
         reflex_triggered = false; // Acknowledge reflex
-        
+
+        // The interlock was already raised in the IRQ handler; the gap
+        // between the event timestamp and now is how late the "brain"
+        // is to its own reflex (typically one loop1 tick + one loop tick)
+        uint32_t event_us = sensor_queue[(queue_head - 1) & 3].timestamp;
+        uint32_t late_us = (uint32_t)micros() - event_us;
+
         // Waiting for HOST to send Feature Vector...
         // Real architecture:
         // 1. Host (PC/Phone) runs Vision (MobileNet)
         // 2. Host sends 128-float Embedding via Serial
         // 3. SerialEvent() captures it and triggers "Real" Vector Brain lookup.
-        
-        Serial.println("[SENTINEL] Reflex Active. Waiting for Vision Vector...");
+
+        Serial.printf("[SENTINEL] Reflex #%lu (interlock fired in-IRQ, cortex %luus behind). Waiting for Vision Vector...\n",
+                      ReflexArc::eventCount(), late_us);
+
+        // Cognitive layer decides when the reflex can relax
+        gpio_put(INTERLOCK_PIN, 0);
     }
     
     // 3. IDLE THOUGHTS
@@ -0,0 +1,100 @@
+/*
+ * sprite_crc.h
+ * Hardware CRC32 service for Sprite One
+ * Uses the RP2040 DMA sniffer: a DMA channel streams the buffer into a
+ * dummy word while the sniffer accumulates CRC-32 (IEEE, reflected) in
+ * hardware - same polynomial/seed/finalization as the software loops it
+ * replaces, so stored checksums stay valid.
+ */
+
+#ifndef SPRITE_CRC_H
+#define SPRITE_CRC_H
+
+#include <Arduino.h>
+
+#ifdef ARDUINO_ARCH_RP2040
+#include "hardware/dma.h"
+#endif
+
+class SpriteCRC {
+private:
+#ifdef ARDUINO_ARCH_RP2040
+  static int chan;
+  static uint32_t scratch;  // DMA write target (no increment)
+#endif
+
+  // Software fallback (non-RP2040 builds, or no free DMA channel)
+  static uint32_t crc32_sw(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+      crc ^= data[i];
+      for (int j = 0; j < 8; j++) {
+        crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+      }
+    }
+    return ~crc;
+  }
+
+public:
+  // Claim a DMA channel for the checksum path. Safe to skip - compute()
+  // lazy-initializes on first use and falls back to software if no
+  // channel is free.
+  static void begin() {
+    #ifdef ARDUINO_ARCH_RP2040
+    if (chan < 0) chan = dma_claim_unused_channel(false);
+    #endif
+  }
+
+  // CRC32 over a memory range (RAM or XIP flash - the sniffer rides the
+  // normal DMA read path either way).
+  //
+  // The sniffer is a single shared unit, so compute() is not reentrant;
+  // in this firmware all callers run from the protocol/fs paths, which
+  // already serialize through the command queue.
+  static uint32_t compute(const void* data, size_t len) {
+    #ifdef ARDUINO_ARCH_RP2040
+    if (chan < 0) begin();
+    if (chan >= 0 && len > 0) {
+      const uint8_t* p = (const uint8_t*)data;
+
+      // Word transfers when aligned (4 bytes/cycle through the sniffer);
+      // the accumulated CRC is over the same byte stream either way
+      bool words = ((((uintptr_t)p) & 3) == 0) && ((len & 3) == 0);
+
+      dma_channel_config c = dma_channel_get_default_config(chan);
+      channel_config_set_transfer_data_size(&c, words ? DMA_SIZE_32 : DMA_SIZE_8);
+      channel_config_set_read_increment(&c, true);
+      channel_config_set_write_increment(&c, false);
+      channel_config_set_sniff_enable(&c, true);
+
+      // Mode 1 = CRC-32 over bit-reversed data; OUT_REV+OUT_INV on the
+      // result register give the standard reflected/inverted CRC32
+      dma_sniffer_enable(chan, 0x1, true);
+      hw_set_bits(&dma_hw->sniff_ctrl,
+                  DMA_SNIFF_CTRL_OUT_REV_BITS | DMA_SNIFF_CTRL_OUT_INV_BITS);
+      dma_sniffer_set_data_accumulator(0xFFFFFFFF);
+
+      dma_channel_configure(chan, &c, &scratch, p, words ? (len >> 2) : len, true);
+      dma_channel_wait_for_finish_blocking(chan);
+
+      uint32_t crc = dma_sniffer_get_data_accumulator();
+      dma_sniffer_disable();
+      return crc;
+    }
+    #endif
+    return crc32_sw((const uint8_t*)data, len);
+  }
+};
+
+#ifdef ARDUINO_ARCH_RP2040
+int SpriteCRC::chan = -1;
+uint32_t SpriteCRC::scratch = 0;
+#endif
+
+// Convenience wrapper used by ModelManager, the upload path, and packet
+// verification
+inline uint32_t crc32_hw(const void* data, size_t len) {
+  return SpriteCRC::compute(data, len);
+}
+
+#endif // SPRITE_CRC_H
@@ -9,6 +9,14 @@
 #include <Arduino.h>
 #include <Wire.h>
 
+#ifdef ARDUINO_ARCH_RP2040
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#endif
+
 // Display configuration
 #define DISPLAY_WIDTH  128
 #define DISPLAY_HEIGHT 64
@@ -46,6 +54,23 @@ public:
   virtual void updateRegion(const uint8_t* framebuffer, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) = 0;
   virtual void setContrast(uint8_t level) = 0;
   virtual const char* name() = 0;
+
+  // Asynchronous full flush: snapshot the framebuffer into a back buffer and
+  // return immediately; the transfer completes in the background. Drivers
+  // without DMA support fall back to a blocking update().
+  virtual void flushAsync(const uint8_t* framebuffer) { update(framebuffer); }
+
+  // True while a background flush is still on the wire
+  virtual bool flushBusy() { return false; }
+
+  // Completion event: returns true once per finished async flush
+  virtual bool flushTakeDone() { return false; }
+
+  // clk_sys changed (DVFS reclock): recompute any bus dividers derived
+  // from it, the same way the UART baud is re-applied. Waits out an
+  // in-flight flush before touching the divider.
+  virtual void reclock() {}
+
   virtual ~SpriteDisplay() {}
 };
 
@@ -54,7 +79,44 @@ class SSD1306Display : public SpriteDisplay {
 private:
   TwoWire* wire;
   uint8_t i2c_addr;
-  
+
+#ifdef ARDUINO_ARCH_RP2040
+  // Double-buffered DMA flush: the framebuffer is snapshotted into a staging
+  // buffer of 16-bit I2C data/cmd words (control byte + 1KB frame, STOP on
+  // the last element) and streamed to the I2C FIFO by DMA. Core 1 keeps
+  // draining the command queue while the ~25ms transfer runs.
+  uint16_t dma_staging[DISPLAY_WIDTH * DISPLAY_HEIGHT / 8 + 1];
+  int dma_chan = -1;
+  volatile bool dma_busy = false;
+  volatile bool dma_done_event = false;
+  static SSD1306Display* dma_instance;
+
+  static void dmaIrqHandler() {
+    SSD1306Display* d = dma_instance;
+    if (d && d->dma_chan >= 0 && dma_channel_get_irq0_status(d->dma_chan)) {
+      dma_channel_acknowledge_irq0(d->dma_chan);
+      // Note: the last few bytes still drain from the I2C TX FIFO after this
+      d->dma_busy = false;
+      d->dma_done_event = true;
+    }
+  }
+
+  void initDma() {
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c0, true));
+    dma_channel_configure(dma_chan, &c, &i2c_get_hw(i2c0)->data_cmd, nullptr, 0, false);
+
+    dma_instance = this;
+    dma_channel_set_irq0_enabled(dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, dmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+  }
+#endif
+
   void sendCommand(uint8_t cmd) {
     wire->beginTransmission(i2c_addr);
     wire->write(0x00); // Command mode
@@ -109,6 +171,9 @@ public:
   }
   
   void update(const uint8_t* framebuffer) override {
+#ifdef ARDUINO_ARCH_RP2040
+    while (dma_busy) tight_loop_contents();  // Don't fight the async flush for the bus
+#endif
     // Set column and page address range (full screen)
     const uint8_t addr_cmds[] = {
       SSD1306_CMD_COLUMN_ADDR, 0, 127,
@@ -132,6 +197,9 @@ public:
   }
   
   void updateRegion(const uint8_t* framebuffer, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) override {
+#ifdef ARDUINO_ARCH_RP2040
+    while (dma_busy) tight_loop_contents();
+#endif
     // Calculate page bounds (each page is 8 pixels tall)
     uint8_t page_start = y1 / 8;
     uint8_t page_end = y2 / 8;
@@ -155,16 +223,418 @@ public:
     }
   }
   
+  void flushAsync(const uint8_t* framebuffer) override {
+#ifdef ARDUINO_ARCH_RP2040
+    while (dma_busy) tight_loop_contents();  // Previous flush still running
+
+    // Address window (blocking, 6 command bytes - negligible)
+    const uint8_t addr_cmds[] = {
+      SSD1306_CMD_COLUMN_ADDR, 0, 127,
+      SSD1306_CMD_PAGE_ADDR, 0, 7
+    };
+    sendCommands(addr_cmds, sizeof(addr_cmds));
+
+    // Snapshot into the back buffer as I2C data/cmd words
+    const size_t TOTAL_SIZE = (DISPLAY_WIDTH * DISPLAY_HEIGHT) / 8;
+    dma_staging[0] = 0x40;  // Data mode control byte
+    for (size_t i = 0; i < TOTAL_SIZE; i++) {
+      dma_staging[i + 1] = framebuffer[i];
+    }
+    dma_staging[TOTAL_SIZE] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+    if (dma_chan < 0) initDma();
+
+    // Retarget the raw I2C block (Wire shares i2c0 on this core)
+    i2c_hw_t* hw = i2c_get_hw(i2c0);
+    hw->enable = 0;
+    hw->tar = i2c_addr;
+    hw->enable = 1;
+
+    dma_busy = true;
+    dma_channel_set_read_addr(dma_chan, dma_staging, false);
+    dma_channel_set_trans_count(dma_chan, TOTAL_SIZE + 1, true);
+#else
+    update(framebuffer);
+#endif
+  }
+
+  bool flushBusy() override {
+#ifdef ARDUINO_ARCH_RP2040
+    return dma_busy;
+#else
+    return false;
+#endif
+  }
+
+  bool flushTakeDone() override {
+#ifdef ARDUINO_ARCH_RP2040
+    if (dma_done_event) {
+      dma_done_event = false;
+      return true;
+    }
+#endif
+    return false;
+  }
+
   void setContrast(uint8_t level) override {
     sendCommand(SSD1306_CMD_SET_CONTRAST);
     sendCommand(level);
   }
-  
+
+  void reclock() override {
+#ifdef ARDUINO_ARCH_RP2040
+    // The I2C divider was computed against the old clk_sys; at 250MHz
+    // turbo the bus would run double its configured rate. setClock
+    // recomputes against the current clock.
+    while (flushBusy()) tight_loop_contents();
+    wire->setClock(400000); // 400kHz I2C
+#endif
+  }
+
   const char* name() override {
     return "SSD1306";
   }
 };
 
+#ifdef ARDUINO_ARCH_RP2040
+SSD1306Display* SSD1306Display::dma_instance = nullptr;
+#endif
+
+// ST7789 / ILI9341 TFT Configuration (PIO-generated SPI)
+#define ST7789_WIDTH   240
+#define ST7789_HEIGHT  240
+#define ST7789_PIN_SCK  18
+#define ST7789_PIN_MOSI 19
+#define ST7789_PIN_DC   20
+#define ST7789_PIN_RST  21
+#define ST7789_PIN_CS   17
+
+// Panel commands (shared ST77xx/ILI93xx core set)
+#define ST7789_CMD_SWRESET 0x01
+#define ST7789_CMD_SLPOUT  0x11
+#define ST7789_CMD_NORON   0x13
+#define ST7789_CMD_INVON   0x21
+#define ST7789_CMD_DISPON  0x29
+#define ST7789_CMD_CASET   0x2A
+#define ST7789_CMD_RASET   0x2B
+#define ST7789_CMD_RAMWR   0x2C
+#define ST7789_CMD_MADCTL  0x36
+#define ST7789_CMD_COLMOD  0x3A
+
+// Pack an RGB color for the ST7789 RGB565 framebuffer. The panel takes
+// the high byte first while DMA streams memory in byte order, so the
+// value is stored byte-swapped - write framebuffer words with this, do
+// not do arithmetic on them.
+static inline uint16_t st7789_color565(uint8_t r, uint8_t g, uint8_t b) {
+  uint16_t c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  return (c >> 8) | (c << 8);
+}
+
+// ST7789/ILI9341 TFT over PIO SPI with DMA scan-out.
+//
+// The two-instruction PIO program clocks one bit per two system cycles
+// (62.5MHz SPI at a 125MHz clk_sys), far past what the SPI block's
+// practical Arduino path sustains. Native RGB565 frames go to the panel
+// as one DMA transfer straight from the caller's framebuffer - a full
+// 240x240x16bpp refresh is ~14.7ms of wire time with no CPU in the
+// loop. The 1bpp SpriteDisplay interface still works: pages are
+// expanded into two ping-pong scanline bounce buffers, the DMA IRQ
+// refilling one line while the other streams.
+class ST7789Display : public SpriteDisplay {
+private:
+#ifdef ARDUINO_ARCH_RP2040
+  // .program st7789_tx  (side-set 1: SCK)
+  //   out pins, 1   side 0
+  //   nop           side 1
+  static constexpr uint16_t tx_instructions[2] = { 0x6001, 0xB042 };
+
+  PIO pio = pio0;
+  int sm = -1;
+  int dma_chan = -1;
+  volatile bool dma_busy = false;
+  volatile bool dma_done_event = false;
+  static ST7789Display* dma_instance;
+
+  // 1bpp expansion state: ping-pong scanline buffers
+  uint16_t bounce[2][DISPLAY_WIDTH];
+  const uint8_t* scan_src = nullptr;
+  volatile uint16_t scan_row = 0;
+
+  static void dmaIrqHandler() {
+    ST7789Display* d = dma_instance;
+    if (d && d->dma_chan >= 0 && dma_channel_get_irq0_status(d->dma_chan)) {
+      dma_channel_acknowledge_irq0(d->dma_chan);
+      if (d->scan_src) {
+        d->scanlineDone();
+      } else {
+        d->dma_busy = false;
+        d->dma_done_event = true;
+      }
+    }
+  }
+
+  // Expand one 1bpp page-packed row to RGB565 (white on black)
+  void expandRow(uint16_t y, uint16_t* dst) {
+    const uint8_t* page = scan_src + (y / 8) * DISPLAY_WIDTH;
+    uint8_t bit = 1 << (y & 7);
+    for (uint16_t x = 0; x < DISPLAY_WIDTH; x++) {
+      dst[x] = (page[x] & bit) ? 0xFFFF : 0x0000;
+    }
+  }
+
+  // Previous scanline finished: kick the next one, then expand the row
+  // after it into the buffer that just freed up
+  void scanlineDone() {
+    uint16_t next = scan_row + 1;
+    if (next >= DISPLAY_HEIGHT) {
+      scan_src = nullptr;
+      dma_busy = false;
+      dma_done_event = true;
+      return;
+    }
+    scan_row = next;
+    dma_channel_set_read_addr(dma_chan, bounce[next & 1], false);
+    dma_channel_set_trans_count(dma_chan, DISPLAY_WIDTH * 2, true);
+    if (next + 1 < DISPLAY_HEIGHT) {
+      expandRow(next + 1, bounce[(next + 1) & 1]);
+    }
+  }
+
+  void initDma() {
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(dma_chan, &c, &pio->txf[sm], nullptr, 0, false);
+
+    dma_instance = this;
+    dma_channel_set_irq0_enabled(dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, dmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+  }
+
+  // Drain the PIO: TX FIFO empty and the state machine stalled on OUT
+  void waitIdle() {
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    pio->fdebug = stall;
+    while (!(pio->fdebug & stall)) tight_loop_contents();
+  }
+
+  void writeByte(uint8_t b) {
+    pio_sm_put_blocking(pio, sm, (uint32_t)b << 24);  // Shift-left OSR
+  }
+
+  void command(uint8_t cmd, const uint8_t* data = nullptr, size_t n = 0) {
+    waitIdle();
+    gpio_put(ST7789_PIN_DC, 0);
+    writeByte(cmd);
+    waitIdle();
+    gpio_put(ST7789_PIN_DC, 1);
+    for (size_t i = 0; i < n; i++) writeByte(data[i]);
+    if (n) waitIdle();
+  }
+
+  void setWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    uint8_t ca[4] = { (uint8_t)(x1 >> 8), (uint8_t)x1, (uint8_t)(x2 >> 8), (uint8_t)x2 };
+    uint8_t ra[4] = { (uint8_t)(y1 >> 8), (uint8_t)y1, (uint8_t)(y2 >> 8), (uint8_t)y2 };
+    command(ST7789_CMD_CASET, ca, 4);
+    command(ST7789_CMD_RASET, ra, 4);
+    command(ST7789_CMD_RAMWR);
+  }
+
+  void waitFlush() {
+    while (dma_busy) tight_loop_contents();
+  }
+
+  // Divider that pins the wire at the panel's 62.5MHz design rate:
+  // bit rate is clk_sys / (2 * div), so div = clk_sys / 125MHz in
+  // 8.8 fixed point, floored at 1.0 (a slower clk_sys just yields a
+  // slower wire - only overspeed is dangerous)
+  static uint32_t clkdiv256() {
+    uint32_t div256 = (uint32_t)(((uint64_t)clock_get_hz(clk_sys) * 256) /
+                                 125000000u);
+    return div256 < 256 ? 256 : div256;
+  }
+#endif
+
+  bool is_ili9341;
+
+public:
+  ST7789Display(bool ili9341 = false) : is_ili9341(ili9341) {}
+
+  bool init() override {
+#ifdef ARDUINO_ARCH_RP2040
+    // CS/DC/RST are plain GPIO; SCK+MOSI belong to the PIO
+    gpio_init(ST7789_PIN_CS);  gpio_set_dir(ST7789_PIN_CS, GPIO_OUT);
+    gpio_init(ST7789_PIN_DC);  gpio_set_dir(ST7789_PIN_DC, GPIO_OUT);
+    gpio_init(ST7789_PIN_RST); gpio_set_dir(ST7789_PIN_RST, GPIO_OUT);
+    gpio_put(ST7789_PIN_CS, 0);  // Panel is the only device on the bus
+
+    gpio_put(ST7789_PIN_RST, 0); delay(10);
+    gpio_put(ST7789_PIN_RST, 1); delay(120);
+
+    sm = pio_claim_unused_sm(pio, true);
+    pio_program_t prog = { tx_instructions, 2, -1 };
+    uint offset = pio_add_program(pio, &prog);
+
+    pio_gpio_init(pio, ST7789_PIN_SCK);
+    pio_gpio_init(pio, ST7789_PIN_MOSI);
+    pio_sm_set_consecutive_pindirs(pio, sm, ST7789_PIN_SCK, 1, true);
+    pio_sm_set_consecutive_pindirs(pio, sm, ST7789_PIN_MOSI, 1, true);
+
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset, offset + 1);
+    sm_config_set_sideset(&c, 1, false, false);
+    sm_config_set_sideset_pins(&c, ST7789_PIN_SCK);
+    sm_config_set_out_pins(&c, ST7789_PIN_MOSI, 1);
+    sm_config_set_out_shift(&c, false, true, 8);  // MSB first, autopull
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    uint32_t div = clkdiv256();                   // 62.5MHz at any clk_sys
+    sm_config_set_clkdiv_int_frac(&c, (uint16_t)(div >> 8), (uint8_t)(div & 0xFF));
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+
+    // Panel bring-up (shared ST77xx/ILI93xx sequence)
+    command(ST7789_CMD_SWRESET); delay(150);
+    command(ST7789_CMD_SLPOUT);  delay(120);
+    uint8_t colmod = 0x55;  // 16bpp
+    command(ST7789_CMD_COLMOD, &colmod, 1);
+    uint8_t madctl = is_ili9341 ? 0x48 : 0x00;
+    command(ST7789_CMD_MADCTL, &madctl, 1);
+    if (!is_ili9341) command(ST7789_CMD_INVON);  // ST7789 panels ship inverted
+    command(ST7789_CMD_NORON);
+    command(ST7789_CMD_DISPON); delay(100);
+
+    initDma();
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // ----- Native RGB565 path (zero-copy: DMA reads the framebuffer) -----
+
+  // Asynchronous full-frame scan-out of a w x h RGB565 buffer (values
+  // packed with st7789_color565). Returns once DMA owns the transfer.
+  void flushAsyncColor(const uint16_t* fb565, uint16_t w = ST7789_WIDTH,
+                       uint16_t h = ST7789_HEIGHT) {
+#ifdef ARDUINO_ARCH_RP2040
+    waitFlush();
+    scan_src = nullptr;  // Single contiguous transfer, no scanline refill
+    setWindow(0, 0, w - 1, h - 1);
+    dma_busy = true;
+    dma_channel_set_read_addr(dma_chan, fb565, false);
+    dma_channel_set_trans_count(dma_chan, (uint32_t)w * h * 2, true);
+#else
+    (void)fb565; (void)w; (void)h;
+#endif
+  }
+
+  void updateColor(const uint16_t* fb565, uint16_t w = ST7789_WIDTH,
+                   uint16_t h = ST7789_HEIGHT) {
+#ifdef ARDUINO_ARCH_RP2040
+    flushAsyncColor(fb565, w, h);
+    waitFlush();
+#else
+    (void)fb565; (void)w; (void)h;
+#endif
+  }
+
+  // ----- 1bpp SpriteDisplay interface (expansion via bounce buffers) -----
+
+  void flushAsync(const uint8_t* framebuffer) override {
+#ifdef ARDUINO_ARCH_RP2040
+    waitFlush();
+    setWindow(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
+    scan_src = framebuffer;
+    scan_row = 0;
+    expandRow(0, bounce[0]);
+    expandRow(1, bounce[1]);
+    dma_busy = true;
+    dma_channel_set_read_addr(dma_chan, bounce[0], false);
+    dma_channel_set_trans_count(dma_chan, DISPLAY_WIDTH * 2, true);
+#else
+    (void)framebuffer;
+#endif
+  }
+
+  void update(const uint8_t* framebuffer) override {
+#ifdef ARDUINO_ARCH_RP2040
+    flushAsync(framebuffer);
+    waitFlush();
+#else
+    (void)framebuffer;
+#endif
+  }
+
+  void updateRegion(const uint8_t* framebuffer, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) override {
+#ifdef ARDUINO_ARCH_RP2040
+    waitFlush();
+    setWindow(x1, y1, x2, y2);
+    for (uint16_t y = y1; y <= y2; y++) {
+      const uint8_t* page = framebuffer + (y / 8) * DISPLAY_WIDTH;
+      uint8_t bit = 1 << (y & 7);
+      for (uint16_t x = x1; x <= x2; x++) {
+        uint8_t on = (page[x] & bit) ? 0xFF : 0x00;
+        writeByte(on);
+        writeByte(on);
+      }
+    }
+    waitIdle();
+#else
+    (void)framebuffer; (void)x1; (void)y1; (void)x2; (void)y2;
+#endif
+  }
+
+  bool flushBusy() override {
+#ifdef ARDUINO_ARCH_RP2040
+    return dma_busy;
+#else
+    return false;
+#endif
+  }
+
+  bool flushTakeDone() override {
+#ifdef ARDUINO_ARCH_RP2040
+    if (dma_done_event) {
+      dma_done_event = false;
+      return true;
+    }
+#endif
+    return false;
+  }
+
+  void setContrast(uint8_t level) override {
+    (void)level;  // No contrast command on these panels
+  }
+
+  void reclock() override {
+#ifdef ARDUINO_ARCH_RP2040
+    if (sm < 0) return;
+    // The PIO divider scales with clk_sys - at 250MHz turbo a fixed
+    // div of 1 would clock the panel at 125MHz, double its design
+    // rate. Recompute for the new clock once the wire is quiet.
+    waitFlush();
+    waitIdle();
+    uint32_t div = clkdiv256();
+    pio_sm_set_clkdiv_int_frac(pio, sm, (uint16_t)(div >> 8),
+                               (uint8_t)(div & 0xFF));
+    pio_sm_clkdiv_restart(pio, sm);
+#endif
+  }
+
+  const char* name() override {
+    return is_ili9341 ? "ILI9341" : "ST7789";
+  }
+};
+
+#ifdef ARDUINO_ARCH_RP2040
+ST7789Display* ST7789Display::dma_instance = nullptr;
+constexpr uint16_t ST7789Display::tx_instructions[2];
+#endif
+
 // Simulated Display (Serial output, current behavior)
 class SimulatedDisplay : public SpriteDisplay {
 public:
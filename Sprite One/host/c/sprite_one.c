@@ -15,48 +15,76 @@ static uint8_t calc_checksum(const uint8_t* data, uint8_t len) {
     return (~sum + 1);
 }
 
-// Helper: Send command and receive response
-static bool send_command(sprite_context_t* ctx, uint8_t cmd, 
-                         const uint8_t* payload, uint8_t payload_len,
-                         uint8_t* resp_data, uint8_t* resp_len) {
-    // Send packet header
+// Helper: Write one request frame, no response handling
+static void write_frame(sprite_context_t* ctx, uint8_t cmd,
+                        const uint8_t* payload, uint8_t payload_len) {
     ctx->write_byte(SPRITE_HEADER);
     ctx->write_byte(cmd);
     ctx->write_byte(payload_len);
-    
-    // Send payload
     for (uint8_t i = 0; i < payload_len; i++) {
         ctx->write_byte(payload[i]);
     }
-    
-    // Send checksum
     ctx->write_byte(calc_checksum(payload, payload_len));
-    
+}
+
+// Helper: Consume the 4-byte CRC32 that terminates every response
+// frame (see send_response in the firmware). Reading fewer leaves the
+// next header scan landing mid-CRC. Not verified here - UART is
+// short-haul, same policy as the async library.
+static void read_crc(sprite_context_t* ctx) {
+    for (uint8_t i = 0; i < 4; i++) {
+        ctx->read_byte();
+    }
+}
+
+// Helper: Send command and receive response
+static bool send_command(sprite_context_t* ctx, uint8_t cmd,
+                         const uint8_t* payload, uint8_t payload_len,
+                         uint8_t* resp_data, uint8_t* resp_len) {
+    write_frame(ctx, cmd, payload, payload_len);
+
     // Wait for response with timeout
     uint32_t start = 0; // Platform-specific: get milliseconds
-    
-    // Read header
-    while (!ctx->data_available()) {
-        // Timeout check (platform-specific)
-    }
-    
-    uint8_t header = ctx->read_byte();
-    if (header != SPRITE_HEADER) return false;
-    
-    uint8_t resp_cmd = ctx->read_byte();
-    uint8_t resp_status = ctx->read_byte();
-    uint8_t resp_data_len = ctx->read_byte();
-    
-    // Read response data
-    for (uint8_t i = 0; i < resp_data_len && resp_data; i++) {
-        resp_data[i] = ctx->read_byte();
+
+    for (;;) {
+        // Read header
+        while (!ctx->data_available()) {
+            // Timeout check (platform-specific)
+        }
+
+        uint8_t header = ctx->read_byte();
+        if (header != SPRITE_HEADER) return false;
+
+        uint8_t resp_cmd = ctx->read_byte();
+        uint8_t resp_status = ctx->read_byte();
+        uint8_t resp_data_len = ctx->read_byte();
+
+        // Unsolicited push event arrived before our response: dispatch
+        // it and keep waiting for the real thing
+        if (resp_cmd == CMD_EVENT) {
+            uint8_t evt_data[64];
+            for (uint8_t i = 0; i < resp_data_len; i++) {
+                uint8_t b = ctx->read_byte();
+                if (i < sizeof(evt_data)) evt_data[i] = b;
+            }
+            read_crc(ctx);
+            if (ctx->on_event) {
+                ctx->on_event(resp_status, evt_data, resp_data_len,
+                              ctx->event_user);
+            }
+            continue;
+        }
+
+        // Read response data
+        for (uint8_t i = 0; i < resp_data_len && resp_data; i++) {
+            resp_data[i] = ctx->read_byte();
+        }
+        if (resp_len) *resp_len = resp_data_len;
+
+        read_crc(ctx);
+
+        return resp_status == RESP_OK;
     }
-    if (resp_len) *resp_len = resp_data_len;
-    
-    // Read checksum (ignored)
-    ctx->read_byte();
-    
-    return resp_status == RESP_OK;
 }
 
 // ===== Implementation =====
@@ -70,6 +98,8 @@ void sprite_init(sprite_context_t* ctx,
     ctx->read_byte = read_fn;
     ctx->data_available = available_fn;
     ctx->timeout_ms = timeout_ms;
+    ctx->on_event = 0;
+    ctx->event_user = 0;
 }
 
 bool sprite_get_version(sprite_context_t* ctx, 
@@ -195,3 +225,225 @@ bool sprite_ai_load(sprite_context_t* ctx, const char* filename) {
     uint8_t len = strlen(filename);
     return send_command(ctx, CMD_AI_LOAD, (uint8_t*)filename, len, NULL, NULL);
 }
+
+// ===== Display List =====
+
+// Append one op in batch sub-format: [cmd][len][data...]
+static bool dl_push(sprite_dl_t* dl, uint8_t cmd,
+                    const uint8_t* payload, uint8_t len) {
+    if (len > SPRITE_DL_MAX_PAYLOAD - 2 ||
+        (uint16_t)(dl->size + 2 + len) > SPRITE_DL_CAPACITY) {
+        dl->overflow = true;
+        return false;
+    }
+    dl->last_op = dl->size;
+    dl->ops[dl->size++] = cmd;
+    dl->ops[dl->size++] = len;
+    if (len > 0) {
+        memcpy(dl->ops + dl->size, payload, len);
+        dl->size += len;
+    }
+    return true;
+}
+
+void sprite_dl_begin(sprite_dl_t* dl) {
+    dl->size = 0;
+    dl->last_op = 0;
+    dl->overflow = false;
+}
+
+bool sprite_dl_clear(sprite_dl_t* dl, uint8_t color) {
+    // A full-screen clear makes everything before it invisible - start
+    // the list over (this also forgives an earlier overflow)
+    sprite_dl_begin(dl);
+    uint8_t payload[1] = {color};
+    return dl_push(dl, CMD_CLEAR, payload, 1);
+}
+
+bool sprite_dl_rect(sprite_dl_t* dl,
+                    int16_t x, int16_t y, int16_t w, int16_t h,
+                    uint8_t color) {
+    if (w <= 0 || h <= 0) return true;  // Nothing to draw
+
+    // Peephole against the previous op when it is also a rect
+    if (dl->size > 0 && dl->ops[dl->last_op] == CMD_RECT) {
+        uint8_t* prev = dl->ops + dl->last_op + 2;
+        int16_t px, py, pw, ph;
+        memcpy(&px, prev, 2);
+        memcpy(&py, prev + 2, 2);
+        memcpy(&pw, prev + 4, 2);
+        memcpy(&ph, prev + 6, 2);
+
+        // Overdraw: new rect fully covers the old one - rewrite in place
+        if (x <= px && y <= py &&
+            x + w >= px + pw && y + h >= py + ph) {
+            memcpy(prev, &x, 2);
+            memcpy(prev + 2, &y, 2);
+            memcpy(prev + 4, &w, 2);
+            memcpy(prev + 6, &h, 2);
+            prev[8] = color;
+            return true;
+        }
+        if (prev[8] == color) {
+            // Same row span, horizontally adjacent: widen
+            if (y == py && h == ph && (x == px + pw || px == x + w)) {
+                int16_t nx = x < px ? x : px;
+                int16_t nw = (int16_t)(pw + w);
+                memcpy(prev, &nx, 2);
+                memcpy(prev + 4, &nw, 2);
+                return true;
+            }
+            // Same column span, vertically adjacent: grow
+            if (x == px && w == pw && (y == py + ph || py == y + h)) {
+                int16_t ny = y < py ? y : py;
+                int16_t nh = (int16_t)(ph + h);
+                memcpy(prev + 2, &ny, 2);
+                memcpy(prev + 6, &nh, 2);
+                return true;
+            }
+        }
+    }
+
+    uint8_t payload[9];
+    memcpy(payload, &x, 2);
+    memcpy(payload + 2, &y, 2);
+    memcpy(payload + 4, &w, 2);
+    memcpy(payload + 6, &h, 2);
+    payload[8] = color;
+    return dl_push(dl, CMD_RECT, payload, 9);
+}
+
+bool sprite_dl_text(sprite_dl_t* dl,
+                    int16_t x, int16_t y, const char* text, uint8_t color) {
+    uint8_t payload[64];
+    memcpy(payload, &x, 2);
+    memcpy(payload + 2, &y, 2);
+    payload[4] = color;
+
+    uint8_t text_len = strlen(text);
+    if (text_len > 58) text_len = 58;
+    memcpy(payload + 5, text, text_len);
+
+    return dl_push(dl, CMD_TEXT, payload, 5 + text_len);
+}
+
+bool sprite_dl_sprite(sprite_dl_t* dl, uint8_t id, int16_t x, int16_t y) {
+    uint8_t payload[5];
+    payload[0] = id;
+    memcpy(payload + 1, &x, 2);
+    memcpy(payload + 3, &y, 2);
+    return dl_push(dl, CMD_SPRITE_MOVE, payload, 5);
+}
+
+bool sprite_dl_flush(sprite_dl_t* dl) {
+    return dl_push(dl, CMD_FLUSH, NULL, 0);
+}
+
+bool sprite_dl_end(sprite_context_t* ctx, sprite_dl_t* dl) {
+    if (dl->overflow) return false;
+    if (dl->size == 0) return true;
+
+    // A single op doesn't need batch framing - one ordinary round trip
+    if ((uint16_t)(2 + dl->ops[1]) == dl->size) {
+        return send_command(ctx, dl->ops[0], dl->ops + 2, dl->ops[1],
+                            NULL, NULL);
+    }
+
+    // Enter pipelined mode: the batches' per-op ACKs coalesce into
+    // credit frames device-side instead of one response per op
+    uint8_t enable[1] = {1};
+    if (!send_command(ctx, CMD_PIPELINE, enable, 1, NULL, NULL)) {
+        return false;
+    }
+
+    // Slice the op buffer into CMD_BATCH packets at op boundaries,
+    // each filled up to the 255-byte payload limit, sent back-to-back
+    // without waiting
+    uint16_t p = 0;
+    while (p < dl->size) {
+        uint16_t start = p;
+        while (p < dl->size) {
+            uint16_t op_len = (uint16_t)(2 + dl->ops[p + 1]);
+            if ((p - start) + op_len > SPRITE_DL_MAX_PAYLOAD) break;
+            p += op_len;
+        }
+        write_frame(ctx, CMD_BATCH, dl->ops + start, (uint8_t)(p - start));
+    }
+
+    // Leave pipelined mode, then drain queued credit frames (and any
+    // immediate error frames) until the zero-length disable ACK - the
+    // single response the whole frame costs
+    uint8_t disable[1] = {0};
+    write_frame(ctx, CMD_PIPELINE, disable, 1);
+
+    bool ok = true;
+    for (;;) {
+        while (!ctx->data_available()) {
+            // Timeout check (platform-specific)
+        }
+        if (ctx->read_byte() != SPRITE_HEADER) continue;
+
+        uint8_t rx_cmd = ctx->read_byte();
+        uint8_t rx_status = ctx->read_byte();
+        uint8_t rx_len = ctx->read_byte();
+        uint8_t rx_data[64];
+        for (uint8_t i = 0; i < rx_len; i++) {
+            uint8_t b = ctx->read_byte();
+            if (i < sizeof(rx_data)) rx_data[i] = b;
+        }
+        read_crc(ctx);
+
+        if (rx_cmd == CMD_EVENT) {
+            if (ctx->on_event) {
+                ctx->on_event(rx_status, rx_data, rx_len, ctx->event_user);
+            }
+            continue;
+        }
+        if (rx_status != RESP_OK) ok = false;  // An op was rejected mid-stream
+        if (rx_cmd == CMD_PIPELINE && rx_len == 0) {
+            return ok;  // Disable ACK - everything before it is accounted for
+        }
+        // Credit refills (CMD_PIPELINE with a count) fall through
+    }
+}
+
+// ===== Event Push Channel =====
+
+void sprite_on_event(sprite_context_t* ctx, sprite_event_fn cb, void* user) {
+    ctx->on_event = cb;
+    ctx->event_user = user;
+}
+
+bool sprite_subscribe_events(sprite_context_t* ctx, uint8_t mask) {
+    uint8_t resp[1];
+    uint8_t len;
+    return send_command(ctx, CMD_EVENTS, &mask, 1, resp, &len);
+}
+
+uint8_t sprite_poll_events(sprite_context_t* ctx) {
+    uint8_t dispatched = 0;
+
+    while (ctx->data_available()) {
+        uint8_t header = ctx->read_byte();
+        if (header != SPRITE_HEADER) continue;
+
+        uint8_t cmd = ctx->read_byte();
+        uint8_t status = ctx->read_byte();
+        uint8_t data_len = ctx->read_byte();
+
+        uint8_t data[64];
+        for (uint8_t i = 0; i < data_len; i++) {
+            uint8_t b = ctx->read_byte();
+            if (i < sizeof(data)) data[i] = b;
+        }
+        read_crc(ctx);
+
+        // Only push frames are expected between commands; anything
+        // else is a stale response and gets dropped
+        if (cmd == CMD_EVENT && ctx->on_event) {
+            ctx->on_event(status, data, data_len, ctx->event_user);
+            dispatched++;
+        }
+    }
+    return dispatched;
+}
@@ -24,6 +24,8 @@
 #define CMD_TEXT            0x21
 #define CMD_FLUSH           0x2F
 
+#define CMD_SPRITE_MOVE     0x31
+
 #define CMD_AI_INFER        0x50
 #define CMD_AI_TRAIN        0x51
 #define CMD_AI_STATUS       0x52
@@ -31,6 +33,18 @@
 #define CMD_AI_LOAD         0x54
 #define CMD_AI_LIST         0x55
 
+#define CMD_BATCH           0x70  // Multiple sub-commands in one packet
+#define CMD_PIPELINE        0x71  // Fire-and-forget mode + credit window
+#define CMD_EVENTS          0x72  // Subscribe to device push events
+#define CMD_EVENT           0xFF  // Unsolicited device->host event frame
+
+// Event types (carried in the status byte of a CMD_EVENT frame)
+#define SPRITE_EVT_TRAIN_DONE   0x01  // Payload: float32 batch loss
+#define SPRITE_EVT_FLUSH_DONE   0x02
+#define SPRITE_EVT_QUEUE_CREDIT 0x03  // Payload: u8 free queue slots
+#define SPRITE_EVT_REFLEX       0x04
+#define SPRITE_EVT_MAX          8     // Handler table size
+
 // Response codes
 #define RESP_OK             0x00
 #define RESP_ERROR          0x01
@@ -51,12 +65,22 @@ typedef void (*sprite_uart_write_fn)(uint8_t byte);
 typedef uint8_t (*sprite_uart_read_fn)(void);
 typedef bool (*sprite_uart_available_fn)(void);
 
+// Device push event callback (see SPRITE_EVT_*)
+typedef void (*sprite_event_fn)(uint8_t event_type,
+                                const uint8_t* data, uint8_t len,
+                                void* user);
+
 // Library context
 typedef struct {
     sprite_uart_write_fn write_byte;
     sprite_uart_read_fn read_byte;
     sprite_uart_available_fn data_available;
     uint32_t timeout_ms;
+
+    // Push events that arrive while waiting for a response are handed
+    // here instead of being mistaken for the response
+    sprite_event_fn on_event;
+    void* event_user;
 } sprite_context_t;
 
 // ===== Initialization =====
@@ -199,4 +223,120 @@ bool sprite_ai_save(sprite_context_t* ctx, const char* filename);
  */
 bool sprite_ai_load(sprite_context_t* ctx, const char* filename);
 
+// ===== Display List =====
+//
+// Accumulate a frame's draw calls on the host, then compile and send
+// them as a handful of CMD_BATCH packets instead of one round trip per
+// call. The builder coalesces adjacent same-color rects, rewrites
+// rects that are fully overdrawn by the next one, and drops everything
+// behind a full-screen clear. Transmission is bracketed in CMD_PIPELINE
+// mode so the per-op ACKs coalesce device-side - a typical UI frame
+// goes from ~40 round trips to 2.
+
+#define SPRITE_DL_CAPACITY    1024  // Host-side op buffer, bytes
+#define SPRITE_DL_MAX_PAYLOAD 255   // Batch packet payload limit
+
+typedef struct {
+    uint8_t ops[SPRITE_DL_CAPACITY];  // Batch sub-format: [cmd][len][data]
+    uint16_t size;
+    uint16_t last_op;   // Offset of the newest op (peephole window)
+    bool overflow;      // An op didn't fit; sprite_dl_end() reports failure
+} sprite_dl_t;
+
+/**
+ * Start (or restart) a display list. No I/O happens until
+ * sprite_dl_end().
+ *
+ * @param dl Display list
+ */
+void sprite_dl_begin(sprite_dl_t* dl);
+
+/**
+ * Record a full-screen clear. Ops recorded before the clear are
+ * dropped - they could never be seen.
+ *
+ * @param dl Display list
+ * @param color Clear color (0 or 1)
+ * @return false if the op didn't fit
+ */
+bool sprite_dl_clear(sprite_dl_t* dl, uint8_t color);
+
+/**
+ * Record a filled rectangle. Merged with the previous op when they
+ * form a larger rect or the previous rect is fully covered.
+ *
+ * @return false if the op didn't fit
+ */
+bool sprite_dl_rect(sprite_dl_t* dl,
+                    int16_t x, int16_t y, int16_t w, int16_t h,
+                    uint8_t color);
+
+/**
+ * Record a text draw (up to 58 characters, as sprite_text()).
+ *
+ * @return false if the op didn't fit
+ */
+bool sprite_dl_text(sprite_dl_t* dl,
+                    int16_t x, int16_t y, const char* text, uint8_t color);
+
+/**
+ * Record a sprite move (CMD_SPRITE_MOVE).
+ *
+ * @param dl Display list
+ * @param id Sprite slot
+ * @return false if the op didn't fit
+ */
+bool sprite_dl_sprite(sprite_dl_t* dl, uint8_t id, int16_t x, int16_t y);
+
+/**
+ * Record a framebuffer flush - typically the last op of a frame.
+ *
+ * @return false if the op didn't fit
+ */
+bool sprite_dl_flush(sprite_dl_t* dl);
+
+/**
+ * Compile the list into CMD_BATCH packets (split at the 255-byte
+ * payload limit) and transmit them back-to-back inside a CMD_PIPELINE
+ * bracket: two round trips total, with one final ACK. Push events that
+ * arrive mid-drain go to the registered event handler.
+ *
+ * @param ctx Context
+ * @param dl Display list (unchanged; reusable or re-begin)
+ * @return true if every op was accepted by the device
+ */
+bool sprite_dl_end(sprite_context_t* ctx, sprite_dl_t* dl);
+
+// ===== Event Push Channel =====
+
+/**
+ * Register a handler for device push events (CMD_EVENT frames).
+ * Events that arrive while a command is waiting for its response are
+ * dispatched here; events between commands are picked up by
+ * sprite_poll_events().
+ *
+ * @param ctx Context
+ * @param cb Callback (NULL to disable)
+ * @param user Opaque pointer handed to the callback
+ */
+void sprite_on_event(sprite_context_t* ctx, sprite_event_fn cb, void* user);
+
+/**
+ * Subscribe to device push events.
+ *
+ * @param ctx Context
+ * @param mask Bitmask: bit (SPRITE_EVT_x - 1) per event type, 0 = off
+ * @return true on success
+ */
+bool sprite_subscribe_events(sprite_context_t* ctx, uint8_t mask);
+
+/**
+ * Drain pending push events while no command is in flight. Call from
+ * the host's idle loop; returns the number of events dispatched.
+ *
+ * @param ctx Context
+ * @return Events dispatched this call
+ */
+uint8_t sprite_poll_events(sprite_context_t* ctx);
+
 #endif // SPRITE_ONE_H
@@ -0,0 +1,245 @@
+/**
+ * Sprite One - Asynchronous C Host Library Implementation
+ */
+
+#include "sprite_one_async.h"
+#include <string.h>
+
+// RX parser states
+enum {
+    RX_IDLE = 0,   // waiting for 0xAA
+    RX_CMD,
+    RX_STATUS,
+    RX_LEN,
+    RX_DATA,
+    RX_CRC         // 4 CRC bytes (not verified here; UART is short-haul)
+};
+
+// Future completions route through the normal callback path
+static void future_cb(uint8_t cmd, uint8_t status,
+                      const uint8_t* data, uint8_t len, void* user) {
+    sprite_future_t* fut = (sprite_future_t*)user;
+    (void)cmd;
+    fut->status = status;
+    fut->len = len > SPRITE_ASYNC_MAX_PAYLOAD ? SPRITE_ASYNC_MAX_PAYLOAD : len;
+    if (fut->len > 0 && data) {
+        memcpy(fut->data, data, fut->len);
+    }
+    fut->done = true;
+}
+
+void sprite_async_init(sprite_async_context_t* ctx,
+                       sprite_uart_write_fn write_fn,
+                       sprite_uart_read_fn read_fn,
+                       sprite_uart_available_fn available_fn,
+                       sprite_millis_fn millis_fn,
+                       uint32_t timeout_ms) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->write_byte = write_fn;
+    ctx->read_byte = read_fn;
+    ctx->data_available = available_fn;
+    ctx->millis = millis_fn;
+    ctx->timeout_ms = timeout_ms;
+}
+
+void sprite_async_on_event(sprite_async_context_t* ctx,
+                           sprite_callback_fn cb, void* user) {
+    ctx->event_cb = cb;
+    ctx->event_user = user;
+}
+
+void sprite_async_on_event_type(sprite_async_context_t* ctx,
+                                uint8_t event_type,
+                                sprite_callback_fn cb, void* user) {
+    if (event_type == 0 || event_type > SPRITE_EVT_MAX) return;
+    ctx->evt_handlers[event_type - 1] = cb;
+    ctx->evt_users[event_type - 1] = user;
+}
+
+bool sprite_async_subscribe_events(sprite_async_context_t* ctx,
+                                   sprite_callback_fn cb, void* user) {
+    uint8_t mask = 0;
+    for (uint8_t t = 1; t <= SPRITE_EVT_MAX; t++) {
+        if (ctx->evt_handlers[t - 1]) mask |= (uint8_t)(1u << (t - 1));
+    }
+    return sprite_async_send(ctx, CMD_EVENTS, &mask, 1, cb, user);
+}
+
+uint8_t sprite_async_free_slots(sprite_async_context_t* ctx) {
+    uint8_t used = (uint8_t)((ctx->q_head - ctx->q_tail) &
+                             (SPRITE_ASYNC_QUEUE_DEPTH - 1));
+    return (uint8_t)(SPRITE_ASYNC_QUEUE_DEPTH - 1 - used);
+}
+
+bool sprite_async_send(sprite_async_context_t* ctx, uint8_t cmd,
+                       const uint8_t* payload, uint8_t len,
+                       sprite_callback_fn cb, void* user) {
+    if (len > SPRITE_ASYNC_MAX_PAYLOAD) return false;
+
+    uint8_t next = (uint8_t)((ctx->q_head + 1) & (SPRITE_ASYNC_QUEUE_DEPTH - 1));
+    if (next == ctx->q_tail) return false;  // Queue full
+
+    sprite_async_entry_t* e = &ctx->queue[ctx->q_head];
+    e->cmd = cmd;
+    e->len = len;
+    if (len > 0 && payload) {
+        memcpy(e->payload, payload, len);
+    }
+    e->callback = cb;
+    e->user = user;
+    ctx->q_head = next;
+    return true;
+}
+
+bool sprite_async_send_future(sprite_async_context_t* ctx, uint8_t cmd,
+                              const uint8_t* payload, uint8_t len,
+                              sprite_future_t* fut) {
+    fut->done = false;
+    fut->status = RESP_TIMEOUT;
+    fut->len = 0;
+    return sprite_async_send(ctx, cmd, payload, len, future_cb, fut);
+}
+
+// Transmit the next queued command (request framing matches the
+// blocking library: [0xAA][CMD][LEN][payload][checksum])
+static void transmit_next(sprite_async_context_t* ctx) {
+    sprite_async_entry_t* e = &ctx->queue[ctx->q_tail];
+    ctx->q_tail = (uint8_t)((ctx->q_tail + 1) & (SPRITE_ASYNC_QUEUE_DEPTH - 1));
+
+    ctx->write_byte(SPRITE_HEADER);
+    ctx->write_byte(e->cmd);
+    ctx->write_byte(e->len);
+
+    uint8_t sum = 0;
+    for (uint8_t i = 0; i < e->len; i++) {
+        ctx->write_byte(e->payload[i]);
+        sum += e->payload[i];
+    }
+    ctx->write_byte((uint8_t)(~sum + 1));
+
+    ctx->in_flight = true;
+    ctx->inflight_cmd = e->cmd;
+    ctx->inflight_cb = e->callback;
+    ctx->inflight_user = e->user;
+    ctx->sent_at = ctx->millis ? ctx->millis() : 0;
+}
+
+// A complete response frame has been parsed - dispatch it
+static bool dispatch(sprite_async_context_t* ctx) {
+    // The parser captures at most SPRITE_ASYNC_MAX_PAYLOAD bytes of a
+    // frame (the device can send up to 255); hand callbacks the
+    // captured length, never the wire length, or they read past rx_data
+    uint8_t len = ctx->rx_len > SPRITE_ASYNC_MAX_PAYLOAD
+                      ? SPRITE_ASYNC_MAX_PAYLOAD : ctx->rx_len;
+
+    if (ctx->in_flight && ctx->rx_cmd == ctx->inflight_cmd) {
+        ctx->in_flight = false;
+        if (ctx->inflight_cb) {
+            ctx->inflight_cb(ctx->rx_cmd, ctx->rx_status,
+                             ctx->rx_data, len, ctx->inflight_user);
+        }
+        return true;
+    }
+    // CMD_EVENT push frame: the status byte carries the event type -
+    // a registered per-type handler takes precedence
+    if (ctx->rx_cmd == CMD_EVENT &&
+        ctx->rx_status >= 1 && ctx->rx_status <= SPRITE_EVT_MAX &&
+        ctx->evt_handlers[ctx->rx_status - 1]) {
+        ctx->evt_handlers[ctx->rx_status - 1](
+            ctx->rx_cmd, ctx->rx_status, ctx->rx_data, len,
+            ctx->evt_users[ctx->rx_status - 1]);
+        return false;
+    }
+    // Not ours: unsolicited device frame (credit refill, push event)
+    if (ctx->event_cb) {
+        ctx->event_cb(ctx->rx_cmd, ctx->rx_status,
+                      ctx->rx_data, len, ctx->event_user);
+    }
+    return false;
+}
+
+uint8_t sprite_poll(sprite_async_context_t* ctx) {
+    uint8_t completions = 0;
+
+    // 1. Kick the next command if the wire is free
+    if (!ctx->in_flight && ctx->q_head != ctx->q_tail) {
+        transmit_next(ctx);
+    }
+
+    // 2. Drain whatever response bytes have arrived
+    while (ctx->data_available()) {
+        uint8_t b = ctx->read_byte();
+
+        switch (ctx->rx_state) {
+            case RX_IDLE:
+                if (b == SPRITE_HEADER) ctx->rx_state = RX_CMD;
+                break;
+            case RX_CMD:
+                ctx->rx_cmd = b;
+                ctx->rx_state = RX_STATUS;
+                break;
+            case RX_STATUS:
+                ctx->rx_status = b;
+                ctx->rx_state = RX_LEN;
+                break;
+            case RX_LEN:
+                ctx->rx_len = b;
+                ctx->rx_pos = 0;
+                ctx->rx_state = (b > 0) ? RX_DATA : RX_CRC;
+                break;
+            case RX_DATA:
+                if (ctx->rx_pos < SPRITE_ASYNC_MAX_PAYLOAD) {
+                    ctx->rx_data[ctx->rx_pos] = b;
+                }
+                ctx->rx_pos++;
+                if (ctx->rx_pos >= ctx->rx_len) {
+                    ctx->rx_pos = 0;
+                    ctx->rx_state = RX_CRC;
+                }
+                break;
+            case RX_CRC:
+                ctx->rx_pos++;
+                if (ctx->rx_pos >= 4) {
+                    if (dispatch(ctx)) completions++;
+                    ctx->rx_state = RX_IDLE;
+                }
+                break;
+        }
+    }
+
+    // 3. Time out a stuck command so the queue keeps moving
+    if (ctx->in_flight && ctx->millis &&
+        (uint32_t)(ctx->millis() - ctx->sent_at) > ctx->timeout_ms) {
+        ctx->in_flight = false;
+        ctx->rx_state = RX_IDLE;
+        if (ctx->inflight_cb) {
+            ctx->inflight_cb(ctx->inflight_cmd, RESP_TIMEOUT, NULL, 0,
+                             ctx->inflight_user);
+        }
+        completions++;
+    }
+
+    return completions;
+}
+
+// ===== Convenience wrappers =====
+
+bool sprite_async_infer(sprite_async_context_t* ctx,
+                        float input0, float input1, sprite_future_t* fut) {
+    uint8_t payload[8];
+    memcpy(payload, &input0, 4);
+    memcpy(payload + 4, &input1, 4);
+    return sprite_async_send_future(ctx, CMD_AI_INFER, payload, 8, fut);
+}
+
+bool sprite_async_train(sprite_async_context_t* ctx, uint8_t epochs,
+                        sprite_callback_fn cb, void* user) {
+    uint8_t payload[1] = {epochs};
+    return sprite_async_send(ctx, CMD_AI_TRAIN, payload, 1, cb, user);
+}
+
+bool sprite_future_f32(const sprite_future_t* fut, float* out) {
+    if (!fut->done || fut->status != RESP_OK || fut->len < 4) return false;
+    memcpy(out, fut->data, 4);
+    return true;
+}
@@ -0,0 +1,247 @@
+/**
+ * Sprite One - Asynchronous C Host Library
+ *
+ * Non-blocking layer over the same UART function pointers as
+ * sprite_one.h. Commands go into a transmit queue, sprite_poll() pumps
+ * TX/RX from the host's main loop, and completions are delivered via
+ * per-command callbacks (or futures for result-carrying commands like
+ * CMD_AI_INFER) — so an ESP32 host keeps sampling sensors while
+ * CMD_AI_TRAIN grinds away on the device.
+ *
+ * One command is in flight at a time; the device answers in order, so
+ * responses are matched FIFO. Parses the current firmware framing:
+ * [0xAA][CMD][STATUS][LEN][DATA][CRC32 LE].
+ */
+
+#ifndef SPRITE_ONE_ASYNC_H
+#define SPRITE_ONE_ASYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sprite_one.h"  // Protocol constants, command codes, UART fn types
+
+// Delivered when no response arrives within timeout_ms
+#define RESP_TIMEOUT        0xFF
+
+// Queue geometry
+#define SPRITE_ASYNC_QUEUE_DEPTH   8
+#define SPRITE_ASYNC_MAX_PAYLOAD   64
+
+/**
+ * Completion callback.
+ *
+ * @param cmd    Command the response belongs to
+ * @param status RESP_OK / RESP_ERROR / ... / RESP_TIMEOUT
+ * @param data   Response payload (valid only during the call)
+ * @param len    Response payload length
+ * @param user   Opaque pointer passed at send time
+ */
+typedef void (*sprite_callback_fn)(uint8_t cmd, uint8_t status,
+                                   const uint8_t* data, uint8_t len,
+                                   void* user);
+
+/**
+ * Millisecond clock, e.g. millis() on Arduino-style hosts.
+ * Needed for response timeouts.
+ */
+typedef uint32_t (*sprite_millis_fn)(void);
+
+/**
+ * Future: poll `done`, then read status/data.
+ * Fill-in target for sprite_async_send_future().
+ */
+typedef struct {
+    volatile bool done;
+    uint8_t status;
+    uint8_t len;
+    uint8_t data[SPRITE_ASYNC_MAX_PAYLOAD];
+} sprite_future_t;
+
+// Queued command slot (internal)
+typedef struct {
+    uint8_t cmd;
+    uint8_t len;
+    uint8_t payload[SPRITE_ASYNC_MAX_PAYLOAD];
+    sprite_callback_fn callback;
+    void* user;
+} sprite_async_entry_t;
+
+// Async library context
+typedef struct {
+    sprite_uart_write_fn write_byte;
+    sprite_uart_read_fn read_byte;
+    sprite_uart_available_fn data_available;
+    sprite_millis_fn millis;
+    uint32_t timeout_ms;
+
+    // TX queue (FIFO)
+    sprite_async_entry_t queue[SPRITE_ASYNC_QUEUE_DEPTH];
+    uint8_t q_head;
+    uint8_t q_tail;
+
+    // In-flight command awaiting its response
+    bool in_flight;
+    uint8_t inflight_cmd;
+    sprite_callback_fn inflight_cb;
+    void* inflight_user;
+    uint32_t sent_at;
+
+    // RX parser state
+    uint8_t rx_state;
+    uint8_t rx_cmd;
+    uint8_t rx_status;
+    uint8_t rx_len;
+    uint8_t rx_pos;
+    uint8_t rx_data[SPRITE_ASYNC_MAX_PAYLOAD];
+
+    // Unsolicited frames (e.g. CMD_PIPELINE credit refills) land here
+    sprite_callback_fn event_cb;
+    void* event_user;
+
+    // Per-type handlers for CMD_EVENT (0xFF) push frames, indexed by
+    // event type. Takes precedence over event_cb for those frames.
+    sprite_callback_fn evt_handlers[SPRITE_EVT_MAX];
+    void* evt_users[SPRITE_EVT_MAX];
+} sprite_async_context_t;
+
+// ===== Initialization =====
+
+/**
+ * Initialize the async context.
+ *
+ * @param ctx Context structure
+ * @param write_fn Function to write byte to UART
+ * @param read_fn Function to read byte from UART
+ * @param available_fn Function to check if data available
+ * @param millis_fn Millisecond clock for timeouts
+ * @param timeout_ms Response timeout in milliseconds
+ */
+void sprite_async_init(sprite_async_context_t* ctx,
+                       sprite_uart_write_fn write_fn,
+                       sprite_uart_read_fn read_fn,
+                       sprite_uart_available_fn available_fn,
+                       sprite_millis_fn millis_fn,
+                       uint32_t timeout_ms);
+
+/**
+ * Register a handler for unsolicited device frames (responses that
+ * don't match the in-flight command, e.g. pipeline credit refills).
+ *
+ * @param ctx Context
+ * @param cb Callback (NULL to disable)
+ * @param user Opaque pointer handed to the callback
+ */
+void sprite_async_on_event(sprite_async_context_t* ctx,
+                           sprite_callback_fn cb, void* user);
+
+/**
+ * Register a handler for one CMD_EVENT push type (SPRITE_EVT_*).
+ * The callback receives cmd = CMD_EVENT and status = event type.
+ * Subscribe on the device with sprite_async_subscribe_events().
+ *
+ * @param ctx Context
+ * @param event_type SPRITE_EVT_TRAIN_DONE .. SPRITE_EVT_REFLEX
+ * @param cb Callback (NULL to unregister)
+ * @param user Opaque pointer handed to the callback
+ */
+void sprite_async_on_event_type(sprite_async_context_t* ctx,
+                                uint8_t event_type,
+                                sprite_callback_fn cb, void* user);
+
+/**
+ * Send CMD_EVENTS with a mask built from the registered per-type
+ * handlers (bit event_type-1 per non-NULL handler), turning the
+ * device's push channel on for exactly those events.
+ *
+ * @param ctx Context
+ * @param cb Completion callback for the subscribe command itself
+ * @param user Opaque pointer handed to the callback
+ * @return true if queued
+ */
+bool sprite_async_subscribe_events(sprite_async_context_t* ctx,
+                                   sprite_callback_fn cb, void* user);
+
+// ===== Core pump =====
+
+/**
+ * Pump the transmit queue and response parser. Call from the host's
+ * main loop; never blocks.
+ *
+ * @param ctx Context
+ * @return Number of completions delivered this call
+ */
+uint8_t sprite_poll(sprite_async_context_t* ctx);
+
+/**
+ * Queue a command for transmission.
+ *
+ * @param ctx Context
+ * @param cmd Command code
+ * @param payload Payload bytes (copied; may be NULL if len is 0)
+ * @param len Payload length (max SPRITE_ASYNC_MAX_PAYLOAD)
+ * @param cb Completion callback (NULL for fire-and-forget)
+ * @param user Opaque pointer handed to the callback
+ * @return true if queued, false if the queue is full
+ */
+bool sprite_async_send(sprite_async_context_t* ctx, uint8_t cmd,
+                       const uint8_t* payload, uint8_t len,
+                       sprite_callback_fn cb, void* user);
+
+/**
+ * Queue a command whose completion fills a future instead of invoking
+ * a callback. Poll fut->done from the host loop.
+ *
+ * @param ctx Context
+ * @param cmd Command code
+ * @param payload Payload bytes (copied)
+ * @param len Payload length
+ * @param fut Future to fill on completion
+ * @return true if queued
+ */
+bool sprite_async_send_future(sprite_async_context_t* ctx, uint8_t cmd,
+                              const uint8_t* payload, uint8_t len,
+                              sprite_future_t* fut);
+
+/**
+ * Number of free slots in the transmit queue.
+ */
+uint8_t sprite_async_free_slots(sprite_async_context_t* ctx);
+
+// ===== Convenience wrappers =====
+
+/**
+ * Run inference asynchronously; the result arrives in the future.
+ *
+ * @param ctx Context
+ * @param input0 First input value
+ * @param input1 Second input value
+ * @param fut Future; on done with RESP_OK, use sprite_future_f32()
+ * @return true if queued
+ */
+bool sprite_async_infer(sprite_async_context_t* ctx,
+                        float input0, float input1, sprite_future_t* fut);
+
+/**
+ * Start training asynchronously.
+ *
+ * @param ctx Context
+ * @param epochs Number of training epochs
+ * @param cb Called with the final loss payload when training finishes
+ * @param user Opaque pointer handed to the callback
+ * @return true if queued
+ */
+bool sprite_async_train(sprite_async_context_t* ctx, uint8_t epochs,
+                        sprite_callback_fn cb, void* user);
+
+/**
+ * Read the first float out of a completed future (e.g. inference
+ * output or training loss).
+ *
+ * @param fut Completed future
+ * @param out Output: float value
+ * @return true if the future completed OK and carried >= 4 bytes
+ */
+bool sprite_future_f32(const sprite_future_t* fut, float* out);
+
+#endif // SPRITE_ONE_ASYNC_H
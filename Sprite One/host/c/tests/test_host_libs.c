@@ -0,0 +1,389 @@
+/**
+ * Sprite One - Host Library Behavior Tests
+ *
+ * Exercises the sync and async C libraries against an in-process
+ * scripted device: the UART function pointers feed a little state
+ * machine that parses request frames and queues response bytes, so
+ * the display-list slicing, pipeline drain, event dispatch, and
+ * timeout paths all run without hardware or the Python mock.
+ *
+ * Build and run (no dependencies beyond a C compiler):
+ *     cc -Wall -o test_host_libs tests/test_host_libs.c \
+ *        sprite_one.c sprite_one_async.c && ./test_host_libs
+ */
+
+#include "../sprite_one.h"
+#include "../sprite_one_async.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ===== Scripted device behind the UART function pointers =====
+
+// Bytes queued for the host to read
+static uint8_t dev_rx[16384];
+static uint32_t rx_head, rx_tail;
+
+// Request parser (framing: [0xAA][CMD][LEN][payload][checksum])
+static uint8_t req_state, req_cmd, req_len, req_pos;
+static uint8_t req_buf[256];
+
+// Device behavior switches, set per test
+static bool dev_mute;             // Swallow requests (timeout path)
+static bool dev_event_before;     // Push a CMD_EVENT before the response
+static uint8_t dev_resp_len;      // Nonzero: respond with this many bytes
+
+// Pipeline state, mirroring the firmware
+static bool pipe_mode;
+static uint16_t pipe_window, pipe_done;
+
+// Recorded traffic for assertions
+static uint8_t req_log[64];       // Command byte of each frame, in order
+static uint8_t req_log_n;
+static uint16_t batch_sizes[16];  // Payload length of each CMD_BATCH
+static uint8_t batch_count;
+static bool batch_bounds_ok;      // Every batch split cleanly at op edges
+static uint16_t batch_op_bytes;   // Total sub-op bytes across batches
+static uint8_t events_delivered;  // Host-side event callback count
+
+static void rx_push(uint8_t b) {
+    dev_rx[rx_head++ % sizeof(dev_rx)] = b;
+}
+
+static void dev_emit(uint8_t cmd, uint8_t status,
+                     const uint8_t* data, uint8_t len) {
+    rx_push(SPRITE_HEADER);
+    rx_push(cmd);
+    rx_push(status);
+    rx_push(len);
+    for (uint8_t i = 0; i < len; i++) rx_push(data ? data[i] : (uint8_t)i);
+    // CRC32 trailer: the libraries consume it without verifying, so the
+    // bytes only need to exist - and not be 0xAA, so a parser that
+    // under-reads the tail desyncs loudly instead of passing by luck
+    rx_push(0x21); rx_push(0x43); rx_push(0x65); rx_push(0x87);
+}
+
+static void dev_flush_credits(void) {
+    if (pipe_done == 0) return;
+    uint8_t body[2] = { (uint8_t)(pipe_done & 0xFF),
+                        (uint8_t)(pipe_done >> 8) };
+    pipe_done = 0;
+    dev_emit(CMD_PIPELINE, RESP_OK, body, 2);
+}
+
+// send_response semantics from the firmware: bare OKs from draw/batch
+// traffic coalesce into credit frames while pipelined
+static void dev_respond(uint8_t cmd, uint8_t status,
+                        const uint8_t* data, uint8_t len) {
+    if (pipe_mode && status == RESP_OK && len == 0 &&
+        ((cmd >= CMD_CLEAR && cmd <= 0x36) || cmd == CMD_BATCH)) {
+        pipe_done++;
+        if (pipe_done >= (uint16_t)((pipe_window + 1) / 2)) {
+            dev_flush_credits();
+        }
+        return;
+    }
+    dev_emit(cmd, status, data, len);
+}
+
+static void dev_handle(uint8_t cmd, const uint8_t* payload, uint8_t len) {
+    if (req_log_n < sizeof(req_log)) req_log[req_log_n++] = cmd;
+    if (dev_mute) return;
+    if (dev_event_before) {
+        dev_event_before = false;
+        uint8_t loss[4] = {0};
+        dev_emit(CMD_EVENT, SPRITE_EVT_TRAIN_DONE, loss, 4);
+    }
+    if (dev_resp_len > 0) {
+        uint8_t big = dev_resp_len;
+        dev_resp_len = 0;
+        dev_emit(cmd, RESP_OK, NULL, big);
+        return;
+    }
+
+    switch (cmd) {
+        case CMD_VERSION: {
+            uint8_t v[3] = {2, 2, 0};
+            dev_respond(cmd, RESP_OK, v, 3);
+            break;
+        }
+        case CMD_PIPELINE:
+            if (len >= 1 && payload[0]) {
+                pipe_window = (len >= 2 && payload[1] > 0) ? payload[1] : 16;
+                pipe_done = 0;
+                pipe_mode = true;
+                uint8_t w = (uint8_t)pipe_window;
+                dev_emit(cmd, RESP_OK, &w, 1);
+            } else {
+                dev_flush_credits();
+                pipe_mode = false;
+                dev_emit(cmd, RESP_OK, NULL, 0);
+            }
+            break;
+        case CMD_BATCH: {
+            if (batch_count < 16) batch_sizes[batch_count] = len;
+            batch_count++;
+            uint8_t p = 0;
+            while (p < len) {
+                if (p + 2 > len || p + 2 + payload[p + 1] > len) {
+                    batch_bounds_ok = false;  // An op was split mid-frame
+                    break;
+                }
+                uint8_t sub_cmd = payload[p];
+                uint8_t sub_len = payload[p + 1];
+                p += 2 + sub_len;
+                batch_op_bytes += 2 + sub_len;
+                dev_respond(sub_cmd, RESP_OK, NULL, 0);
+            }
+            if (p != len) batch_bounds_ok = false;
+            dev_respond(cmd, RESP_OK, NULL, 0);
+            break;
+        }
+        default:  // Draw commands and everything else: bare ACK
+            dev_respond(cmd, RESP_OK, NULL, 0);
+            break;
+    }
+}
+
+static void uart_write(uint8_t b) {
+    switch (req_state) {
+        case 0: if (b == SPRITE_HEADER) req_state = 1; break;
+        case 1: req_cmd = b; req_state = 2; break;
+        case 2: req_len = b; req_pos = 0; req_state = req_len ? 3 : 4; break;
+        case 3:
+            req_buf[req_pos++] = b;
+            if (req_pos >= req_len) req_state = 4;
+            break;
+        case 4:  // Trailing checksum byte, then act on the frame
+            dev_handle(req_cmd, req_buf, req_len);
+            req_state = 0;
+            break;
+    }
+}
+
+static uint8_t uart_read(void) {
+    if (rx_tail == rx_head) return 0;
+    return dev_rx[rx_tail++ % sizeof(dev_rx)];
+}
+
+static bool uart_available(void) {
+    return rx_tail != rx_head;
+}
+
+static uint32_t fake_now;
+static uint32_t fake_millis(void) { return fake_now; }
+
+static void dev_reset(void) {
+    rx_head = rx_tail = 0;
+    req_state = 0;
+    dev_mute = false;
+    dev_event_before = false;
+    dev_resp_len = 0;
+    pipe_mode = false;
+    pipe_done = 0;
+    req_log_n = 0;
+    batch_count = 0;
+    batch_bounds_ok = true;
+    batch_op_bytes = 0;
+    events_delivered = 0;
+    fake_now = 0;
+}
+
+static void on_event(uint8_t type, const uint8_t* data, uint8_t len,
+                     void* user) {
+    (void)type; (void)data; (void)len; (void)user;
+    events_delivered++;
+}
+
+// ===== Test plumbing =====
+
+static int failures;
+
+#define CHECK(name, cond) do { \
+    if (cond) { printf("  ok   %s\n", name); } \
+    else { printf("  FAIL %s\n", name); failures++; } \
+} while (0)
+
+// ===== Sync library / display list =====
+
+static void test_dl_single_op(void) {
+    printf("[dl] single op bypasses batch framing\n");
+    dev_reset();
+    sprite_context_t ctx;
+    sprite_init(&ctx, uart_write, uart_read, uart_available, 1000);
+
+    sprite_dl_t dl;
+    sprite_dl_begin(&dl);
+    sprite_dl_rect(&dl, 4, 4, 8, 8, 1);
+    CHECK("end returns true", sprite_dl_end(&ctx, &dl));
+    CHECK("one plain CMD_RECT on the wire",
+          req_log_n == 1 && req_log[0] == CMD_RECT);
+}
+
+static void test_dl_slicing(void) {
+    printf("[dl] multi-packet frame slices at op boundaries\n");
+    dev_reset();
+    sprite_context_t ctx;
+    sprite_init(&ctx, uart_write, uart_read, uart_available, 1000);
+
+    sprite_dl_t dl;
+    sprite_dl_begin(&dl);
+    sprite_dl_clear(&dl, 0);
+    for (int i = 0; i < 30; i++) {
+        // Alternate colors so the rect peephole can't merge them away
+        sprite_dl_rect(&dl, (int16_t)(i * 4), (int16_t)((i % 2) * 32),
+                       4, 4, (uint8_t)(i % 2));
+    }
+    sprite_dl_text(&dl, 0, 56, "slicing test", 1);
+    sprite_dl_flush(&dl);
+    uint16_t recorded = dl.size;
+
+    CHECK("list larger than one packet", recorded > SPRITE_DL_MAX_PAYLOAD);
+    CHECK("end returns true", sprite_dl_end(&ctx, &dl));
+    CHECK("pipeline bracket around batches",
+          req_log_n >= 4 && req_log[0] == CMD_PIPELINE &&
+          req_log[req_log_n - 1] == CMD_PIPELINE);
+    CHECK("sliced into multiple batches", batch_count >= 2);
+    CHECK("every packet within the payload limit",
+          batch_sizes[0] <= SPRITE_DL_MAX_PAYLOAD &&
+          batch_sizes[batch_count - 1] <= SPRITE_DL_MAX_PAYLOAD);
+    CHECK("no op split across packets", batch_bounds_ok);
+    CHECK("every recorded byte transmitted", batch_op_bytes == recorded);
+}
+
+static void test_dl_error_propagates(void) {
+    printf("[dl] device error mid-stream fails the frame\n");
+    dev_reset();
+    sprite_context_t ctx;
+    sprite_init(&ctx, uart_write, uart_read, uart_available, 1000);
+
+    sprite_dl_t dl;
+    sprite_dl_begin(&dl);
+    sprite_dl_clear(&dl, 0);
+    for (int i = 0; i < 40; i++) {
+        sprite_dl_rect(&dl, (int16_t)i, (int16_t)((i % 2) * 8), 2, 2,
+                       (uint8_t)(i % 2));
+    }
+    CHECK("clean run succeeds first", sprite_dl_end(&ctx, &dl));
+
+    // Re-send the same list with the device refusing one op: an error
+    // frame ahead of the disable ACK must surface as a false return
+    req_log_n = 0;
+    batch_count = 0;
+    dev_emit(CMD_RECT, RESP_ERROR, NULL, 0);
+    CHECK("stranded error frame fails the next frame",
+          !sprite_dl_end(&ctx, &dl));
+}
+
+static void test_dl_peephole(void) {
+    printf("[dl] rect peephole\n");
+    sprite_dl_t dl;
+    sprite_dl_begin(&dl);
+    sprite_dl_rect(&dl, 0, 0, 10, 10, 1);
+    uint16_t one = dl.size;
+    sprite_dl_rect(&dl, 10, 0, 10, 10, 1);   // Adjacent, same row: widen
+    CHECK("adjacent rects merge", dl.size == one);
+    sprite_dl_rect(&dl, 0, 0, 30, 10, 1);    // Covers the merged rect
+    CHECK("overdraw rewrites in place", dl.size == one);
+    sprite_dl_rect(&dl, 50, 50, 4, 4, 0);    // Unrelated: new op
+    CHECK("disjoint rect appends", dl.size > one);
+}
+
+static void test_event_before_response(void) {
+    printf("[sync] event frame ahead of the response\n");
+    dev_reset();
+    sprite_context_t ctx;
+    sprite_init(&ctx, uart_write, uart_read, uart_available, 1000);
+    sprite_on_event(&ctx, on_event, NULL);
+
+    dev_event_before = true;
+    uint8_t maj, min, pat;
+    CHECK("command still succeeds",
+          sprite_get_version(&ctx, &maj, &min, &pat));
+    CHECK("event dispatched to the handler", events_delivered == 1);
+    CHECK("version parsed past the event", maj == 2 && min == 2);
+    // A second command proves the stream stayed in sync (all four CRC
+    // bytes of the event frame were consumed)
+    CHECK("stream still aligned",
+          sprite_get_version(&ctx, &maj, &min, &pat));
+}
+
+// ===== Async library =====
+
+static uint8_t async_status = 0xEE;
+static uint8_t async_len;
+static void async_cb(uint8_t cmd, uint8_t status, const uint8_t* data,
+                     uint8_t len, void* user) {
+    (void)cmd; (void)data; (void)user;
+    async_status = status;
+    async_len = len;
+}
+
+static void test_async_timeout(void) {
+    printf("[async] timeout delivers RESP_TIMEOUT and frees the wire\n");
+    dev_reset();
+    dev_mute = true;
+
+    sprite_async_context_t ctx;
+    sprite_async_init(&ctx, uart_write, uart_read, uart_available,
+                      fake_millis, 100);
+
+    async_status = 0xEE;
+    CHECK("command queued",
+          sprite_async_send(&ctx, CMD_AI_TRAIN, NULL, 0, async_cb, NULL));
+    sprite_poll(&ctx);                       // Transmit
+    fake_now = 50;
+    CHECK("no completion before the deadline", sprite_poll(&ctx) == 0);
+    fake_now = 150;
+    CHECK("timeout completion delivered", sprite_poll(&ctx) == 1);
+    CHECK("status is RESP_TIMEOUT", async_status == RESP_TIMEOUT);
+
+    // The queue must keep moving after a timeout
+    dev_mute = false;
+    sprite_future_t fut;
+    CHECK("next command queued",
+          sprite_async_send_future(&ctx, CMD_VERSION, NULL, 0, &fut));
+    for (int i = 0; i < 4 && !fut.done; i++) sprite_poll(&ctx);
+    CHECK("next command completes", fut.done && fut.status == RESP_OK);
+}
+
+static void test_async_oversized_response(void) {
+    printf("[async] oversized response is clamped, not overread\n");
+    dev_reset();
+
+    sprite_async_context_t ctx;
+    sprite_async_init(&ctx, uart_write, uart_read, uart_available,
+                      fake_millis, 100);
+
+    dev_resp_len = 200;  // Larger than SPRITE_ASYNC_MAX_PAYLOAD
+    async_len = 0;
+    async_status = 0xEE;
+    sprite_async_send(&ctx, CMD_AI_STATUS, NULL, 0, async_cb, NULL);
+    for (int i = 0; i < 4 && async_status == 0xEE; i++) sprite_poll(&ctx);
+    CHECK("completion delivered", async_status == RESP_OK);
+    CHECK("length clamped to the capture buffer",
+          async_len == SPRITE_ASYNC_MAX_PAYLOAD);
+
+    // Stream stays aligned after the long frame
+    sprite_future_t fut;
+    sprite_async_send_future(&ctx, CMD_VERSION, NULL, 0, &fut);
+    for (int i = 0; i < 4 && !fut.done; i++) sprite_poll(&ctx);
+    CHECK("stream still aligned", fut.done && fut.status == RESP_OK);
+}
+
+int main(void) {
+    test_dl_single_op();
+    test_dl_slicing();
+    test_dl_error_propagates();
+    test_dl_peephole();
+    test_event_before_response();
+    test_async_timeout();
+    test_async_oversized_response();
+
+    if (failures) {
+        printf("\n%d FAILURE(S)\n", failures);
+        return 1;
+    }
+    printf("\nAll host library tests passed.\n");
+    return 0;
+}
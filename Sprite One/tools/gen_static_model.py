@@ -0,0 +1,211 @@
+"""
+Static Model Generator
+Emits a compile-time specialized inference header from an .aif32 file.
+
+The firmware's DynamicModel re-parses descriptors and schedules arena
+memory for every loaded model. For fixed deployments the generated
+header bakes everything into types instead: weights become const
+arrays (served from XIP flash), each Dense layer becomes a
+StaticDense<IN, OUT, ACT> with its activation fused in, and the whole
+chain is one StaticModel<...> instantiation with an infer() wrapper.
+See examples/sprite_one_unified/sprite_static.h for the engine.
+
+Dense chains only (Input -> Dense [-> ReLU/Sigmoid/Softmax] ...).
+Models with Conv2D/MaxPool layers keep using DynamicModel.
+
+Usage:
+  python gen_static_model.py model.aif32 out_model.h [namespace] [engine_include]
+
+engine_include defaults to "sprite_static.h"; pass the relative path
+when the header lands outside examples/sprite_one_unified, e.g.
+  python gen_static_model.py ../sentinel_god.aif32 \
+      ../examples/sprite_sentinel/sentinel_static_model.h \
+      sentinel_god ../sprite_one_unified/sprite_static.h
+"""
+
+import struct
+import sys
+import os
+
+# Layer Types (Matches Firmware)
+LAYER_TYPE_INPUT   = 0x01
+LAYER_TYPE_DENSE   = 0x02
+LAYER_TYPE_RELU    = 0x03
+LAYER_TYPE_SIGMOID = 0x04
+LAYER_TYPE_SOFTMAX = 0x05
+LAYER_TYPE_CONV2D  = 0x06
+LAYER_TYPE_FLATTEN = 0x07
+LAYER_TYPE_MAXPOOL = 0x08
+
+MODEL_MAGIC = 0x54525053  # "SPRT"
+
+ACT_NAMES = {
+    LAYER_TYPE_RELU:    'STATIC_ACT_RELU',
+    LAYER_TYPE_SIGMOID: 'STATIC_ACT_SIGMOID',
+    LAYER_TYPE_SOFTMAX: 'STATIC_ACT_SOFTMAX',
+}
+
+
+def parse_aif32_v3(data):
+    """Parse header + descriptors; return (name, layers, weights_blob)."""
+    magic, version, layer_count, total_weights, crc, name = \
+        struct.unpack_from('<IHHII16s', data, 0)
+    if magic != MODEL_MAGIC:
+        raise ValueError("Not an .aif32 file (bad magic)")
+    if version != 3:
+        raise ValueError(f"Only V3 (float32) supported, got V{version}")
+
+    layers = []
+    off = 32
+    for _ in range(layer_count):
+        ltype, flags, p1, p2, p3, p4, p5, p6, _res = \
+            struct.unpack_from('<BBHHHHHHH', data, off)
+        layers.append((ltype, p1, p2, p3))
+        off += 16
+
+    weights = data[off:off + total_weights]
+    if len(weights) != total_weights:
+        raise ValueError("Truncated weight blob")
+    return name.rstrip(b'\x00').decode(), layers, weights
+
+
+def build_dense_chain(layers):
+    """Fold the descriptor list into [(in, out, act_name), ...]."""
+    if not layers or layers[0][0] != LAYER_TYPE_INPUT:
+        raise ValueError("Model must start with an Input layer")
+    ltype, p1, p2, p3 = layers[0]
+    if p2 or p3:
+        raise ValueError("2D input - conv topology, use DynamicModel")
+    cur_dim = p1
+
+    chain = []
+    for ltype, p1, p2, p3 in layers[1:]:
+        if ltype == LAYER_TYPE_DENSE:
+            chain.append([cur_dim, p1, 'STATIC_ACT_NONE'])
+            cur_dim = p1
+        elif ltype in ACT_NAMES:
+            if not chain:
+                raise ValueError("Activation before any Dense layer")
+            if chain[-1][2] != 'STATIC_ACT_NONE':
+                raise ValueError("Two activations after one Dense layer")
+            chain[-1][2] = ACT_NAMES[ltype]  # Fuse into the dense
+        elif ltype == LAYER_TYPE_FLATTEN:
+            pass  # No-op on a 1D chain
+        else:
+            raise ValueError(
+                f"Layer type 0x{ltype:02X} not supported by StaticModel - "
+                "use DynamicModel for conv topologies")
+    if not chain:
+        raise ValueError("No Dense layers found")
+    return chain
+
+
+def format_float(v):
+    s = f'{v:.9g}'
+    if '.' not in s and 'e' not in s and 'n' not in s:
+        s += '.0'  # "0" -> "0.0f", valid C++ literal
+    return s + 'f'
+
+
+def format_float_array(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = ', '.join(format_float(v) for v in values[i:i + per_line])
+        lines.append('    ' + chunk + ',')
+    return '\n'.join(lines)
+
+
+def emit_header(name, chain, weights, namespace, src_name,
+                engine_include='sprite_static.h'):
+    floats = struct.unpack(f'<{len(weights) // 4}f', weights)
+    pos = 0
+    out = []
+    guard = f'{namespace.upper()}_STATIC_MODEL_H'
+
+    out.append('/*')
+    out.append(f' * Generated by tools/gen_static_model.py from {src_name}')
+    out.append(f' * Model: {name} - do not edit, regenerate instead.')
+    out.append(' */')
+    out.append('')
+    out.append(f'#ifndef {guard}')
+    out.append(f'#define {guard}')
+    out.append('')
+    out.append(f'#include "{engine_include}"')
+    out.append('')
+    out.append(f'namespace {namespace} {{')
+    out.append('')
+
+    types = []
+    inits = []
+    for idx, (in_dim, out_dim, act) in enumerate(chain):
+        w_count = in_dim * out_dim
+        w = floats[pos:pos + w_count]
+        pos += w_count
+        b = floats[pos:pos + out_dim]
+        pos += out_dim
+        out.append(f'// Dense {idx}: {in_dim} -> {out_dim} ({act})')
+        out.append(f'static const float weights_{idx}[{w_count}] = {{')
+        out.append(format_float_array(w))
+        out.append('};')
+        out.append(f'static const float bias_{idx}[{out_dim}] = {{')
+        out.append(format_float_array(b))
+        out.append('};')
+        out.append('')
+        types.append(f'StaticDense<{in_dim}, {out_dim}, {act}>')
+        inits.append(f'{{ weights_{idx}, bias_{idx} }}')
+
+    if pos != len(floats):
+        raise ValueError(f"Weight blob mismatch: used {pos} of {len(floats)} floats")
+
+    # StaticModel<A, B, C> nests as { a, { b, { c } } }
+    nested = inits[-1]
+    for init in reversed(inits[:-1]):
+        nested = f'{{ {init}, {nested} }}'
+
+    type_list = ',\n    '.join(types)
+    out.append(f'typedef StaticModel<\n    {type_list}\n> Model;')
+    out.append('')
+    out.append(f'static const Model model = {nested};')
+    out.append('')
+    out.append(f'static const uint16_t input_dim = {chain[0][0]};')
+    out.append(f'static const uint16_t output_dim = {chain[-1][1]};')
+    out.append('')
+    out.append('// Run one forward pass. output must hold output_dim floats.')
+    out.append('inline void infer(const float* input, float* output) {')
+    out.append('    model.forward(input, output);')
+    out.append('}')
+    out.append('')
+    out.append(f'}} // namespace {namespace}')
+    out.append('')
+    out.append(f'#endif // {guard}')
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+
+    src, dst = sys.argv[1], sys.argv[2]
+    namespace = sys.argv[3] if len(sys.argv) > 3 else \
+        os.path.splitext(os.path.basename(src))[0]
+    engine_include = sys.argv[4] if len(sys.argv) > 4 else 'sprite_static.h'
+
+    data = open(src, 'rb').read()
+    name, layers, weights = parse_aif32_v3(data)
+    chain = build_dense_chain(layers)
+
+    print(f"Model: {name}")
+    for in_dim, out_dim, act in chain:
+        print(f"  Dense {in_dim} -> {out_dim}  {act}")
+
+    header = emit_header(name, chain, weights, namespace,
+                         os.path.basename(src), engine_include)
+    with open(dst, 'w') as f:
+        f.write(header)
+    print(f"Wrote {dst} ({os.path.getsize(dst)} bytes)")
+
+
+if __name__ == '__main__':
+    main()
@@ -55,6 +55,14 @@ CMD_FINETUNE_START = 0x65
 CMD_FINETUNE_DATA = 0x66
 CMD_FINETUNE_STOP = 0x67
 CMD_BATCH = 0x70
+CMD_PIPELINE = 0x71
+CMD_EVENTS = 0x72
+CMD_EVENT = 0xFF
+
+# Sprite engine (only MOVE/CLEAR are simulated; the mock tracks no
+# sprite state but the opcodes matter for pipeline coalescing)
+CMD_SPRITE_MOVE = 0x31
+CMD_SPRITE_CLEAR = 0x36
 
 # Sentinel "God Mode" Commands
 CMD_SENTINEL_STATUS = 0x80 # Returns Temp, Freq, MemCount
@@ -96,6 +104,12 @@ class MockDevice:
         self.circular_buffer = []         # Rolling float samples (max 60)
         self.baseline = None              # Captured mean float, or None
 
+        # Pipeline / event state (mirrors the unified firmware)
+        self.pipeline_mode = False
+        self.pipeline_window = 16
+        self.pipeline_done = 0
+        self.events_mask = 0
+
         # Current Command Context (for response construction)
         self.current_cmd = 0x00
 
@@ -123,7 +137,11 @@ class MockDevice:
             CMD_FINETUNE_START: self._cmd_ack,
             CMD_FINETUNE_DATA: self._cmd_finetune_data,
             CMD_FINETUNE_STOP: self._cmd_ack,
+            CMD_SPRITE_MOVE: self._cmd_ack,
+            CMD_SPRITE_CLEAR: self._cmd_ack,
             CMD_BATCH: self._cmd_batch,
+            CMD_PIPELINE: self._cmd_pipeline,
+            CMD_EVENTS: self._cmd_events,
             # Sentinel Handlers
             CMD_SENTINEL_STATUS: self._cmd_sentinel_status,
             CMD_SENTINEL_TRIGGER: self._cmd_sentinel_trigger,
@@ -415,13 +433,76 @@ class MockDevice:
         return self._make_response(RESP_OK)
 
     def _cmd_batch(self, payload):
-        return self._make_response(RESP_OK)
+        """Execute [CMD][LEN][DATA] sub-commands. Like the firmware, each
+        sub-command sends its own response (coalesced into credits when
+        pipelined) and the batch itself confirms with a bare OK."""
+        out = bytearray()
+        p = 0
+        while p < len(payload):
+            if p + 2 > len(payload):
+                break  # Incomplete sub-header
+            sub_cmd = payload[p]
+            sub_len = payload[p + 1]
+            if p + 2 + sub_len > len(payload):
+                break  # Incomplete sub-payload
+            sub_data = payload[p + 2:p + 2 + sub_len]
+            p += 2 + sub_len
+
+            saved = self.current_cmd
+            self.current_cmd = sub_cmd
+            handler = self.command_handlers.get(sub_cmd)
+            if handler and sub_cmd != CMD_BATCH:  # No nesting
+                out.extend(handler(sub_data))
+            else:
+                out.extend(self._make_response(RESP_ERROR))
+            self.current_cmd = saved
+
+        out.extend(self._make_response(RESP_OK))
+        return bytes(out)
+
+    def _cmd_pipeline(self, payload):
+        if len(payload) < 1:
+            return self._make_response(RESP_ERROR)
+        if payload[0]:
+            self.pipeline_window = payload[1] if len(payload) >= 2 and payload[1] > 0 else 16
+            self.pipeline_done = 0
+            self.pipeline_mode = True
+            return self._make_response(RESP_OK, bytes([self.pipeline_window]))
+        # Disable: outstanding credits first, then the zero-length ACK
+        out = self._flush_credits()
+        self.pipeline_mode = False
+        return out + self._make_response(RESP_OK)
+
+    def _cmd_events(self, payload):
+        if len(payload) >= 1:
+            self.events_mask = payload[0]
+        return self._make_response(RESP_OK, bytes([self.events_mask]))
+
+    def _flush_credits(self):
+        if self.pipeline_done == 0:
+            return b''
+        count = self.pipeline_done
+        self.pipeline_done = 0
+        return self._make_response(RESP_OK, struct.pack('<H', count),
+                                   cmd=CMD_PIPELINE)
 
     # --- Response construction ---
 
-    def _make_response(self, status, data=b''):
+    def _make_response(self, status, data=b'', cmd=None):
+        if cmd is None:
+            cmd = self.current_cmd
+
+        # Pipelined fire-and-forget: bare OKs from graphics/sprite/batch
+        # traffic coalesce into a credit frame once half the window is
+        # used, exactly like send_response in the firmware
+        if (self.pipeline_mode and status == RESP_OK and len(data) == 0 and
+                (CMD_CLEAR <= cmd <= CMD_SPRITE_CLEAR or cmd == CMD_BATCH)):
+            self.pipeline_done += 1
+            if self.pipeline_done >= (self.pipeline_window + 1) // 2:
+                return self._flush_credits()
+            return b''
+
         # Header: HEADER, CMD, STATUS, LEN
-        cmd = self.current_cmd
         header = bytearray([HEADER, cmd, status, len(data)])
         header.extend(data)
         
@@ -562,6 +643,106 @@ def run_loopback_test():
     print("\nTests Complete.")
 
 
+def run_pipeline_test():
+    """Loopback test for CMD_BATCH / CMD_PIPELINE / CMD_EVENTS."""
+    device = MockDevice()
+    print("=== Batch / Pipeline / Events Test (no hardware required) ===\n")
+
+    def make_packet(cmd, payload=b''):
+        data = bytearray([HEADER, cmd, len(payload)])
+        data.extend(payload)
+        crc = zlib.crc32(data[1:]) & 0xFFFFFFFF
+        data.extend(struct.pack('<I', crc))
+        return bytes(data)
+
+    def split_frames(stream):
+        """Split a concatenated response stream into whole frames."""
+        frames = []
+        i = 0
+        while i < len(stream):
+            assert stream[i] == HEADER, f"Desync at offset {i}"
+            length = stream[i + 3]
+            end = i + 4 + length + 4
+            assert end <= len(stream), "Truncated frame"
+            frames.append(stream[i:end])
+            i = end
+        return frames
+
+    def sub_op(cmd, payload):
+        return bytes([cmd, len(payload)]) + payload
+
+    def rect_op(x, y, w, h, color):
+        return sub_op(CMD_RECT, struct.pack('<hhhh', x, y, w, h) + bytes([color]))
+
+    passed = [0]
+
+    def check(name, cond, extra=''):
+        sym = '✓' if cond else '✗'
+        print(f"  {sym} {name}  {extra}")
+        assert cond, name
+        passed[0] += 1
+
+    # 1. Event subscription echoes the mask now in effect
+    resp = device.process_packet(make_packet(CMD_EVENTS, bytes([0x07])))
+    frames = split_frames(resp)
+    check("EVENTS subscribe echoes mask",
+          len(frames) == 1 and frames[0][4] == 0x07)
+
+    # 2. Unpipelined batch: one response per sub-op plus the batch OK
+    batch = rect_op(0, 0, 8, 8, 1) + rect_op(8, 0, 8, 8, 1) + sub_op(CMD_FLUSH, b'')
+    frames = split_frames(device.process_packet(make_packet(CMD_BATCH, batch)))
+    check("Unpipelined batch responds per sub-op",
+          len(frames) == 4 and all(f[2] == RESP_OK for f in frames))
+
+    # 3. Pipeline enable acknowledges the window
+    frames = split_frames(device.process_packet(
+        make_packet(CMD_PIPELINE, bytes([1, 8]))))
+    check("PIPELINE enable returns window",
+          len(frames) == 1 and frames[0][4] == 8)
+
+    # 4. Pipelined batch: per-op ACKs coalesce into credit frames.
+    # 6 draws + the batch OK = 7 completions; half of window 8 -> one
+    # credit frame of 4 with 3 still pending
+    batch = b''.join(rect_op(i * 8, 0, 8, 8, 1) for i in range(6))
+    frames = split_frames(device.process_packet(make_packet(CMD_BATCH, batch)))
+    check("Pipelined batch coalesces into credits",
+          len(frames) == 1 and frames[0][1] == CMD_PIPELINE and
+          struct.unpack('<H', frames[0][4:6])[0] == 4)
+
+    # 5. An error mid-stream passes through instead of coalescing
+    batch = rect_op(0, 0, 4, 4, 1) + sub_op(0xEE, b'') + rect_op(4, 0, 4, 4, 1)
+    frames = split_frames(device.process_packet(make_packet(CMD_BATCH, batch)))
+    check("Mid-batch error frame passes through",
+          any(f[2] == RESP_ERROR for f in frames))
+
+    # 6. Disable flushes the remaining credits, then the bare ACK last
+    frames = split_frames(device.process_packet(
+        make_packet(CMD_PIPELINE, bytes([0]))))
+    check("PIPELINE disable flushes credits before ACK",
+          len(frames) == 2 and frames[0][1] == CMD_PIPELINE and
+          frames[0][3] == 2 and frames[1][1] == CMD_PIPELINE and
+          frames[1][3] == 0 and frames[1][2] == RESP_OK)
+
+    # 7. Credit accounting balances across a multi-batch frame (the
+    # display-list library slices at 255 payload bytes and counts on
+    # every op being acknowledged by the time the disable ACK arrives)
+    device.process_packet(make_packet(CMD_PIPELINE, bytes([1, 16])))
+    total_ops = 0
+    credits = 0
+    for _ in range(3):
+        batch = b''.join(rect_op(i, i, 2, 2, 1) for i in range(20))
+        total_ops += 20 + 1  # sub-ops + the batch's own OK
+        for f in split_frames(device.process_packet(make_packet(CMD_BATCH, batch))):
+            credits += struct.unpack('<H', f[4:6])[0]
+    frames = split_frames(device.process_packet(make_packet(CMD_PIPELINE, bytes([0]))))
+    for f in frames[:-1]:
+        credits += struct.unpack('<H', f[4:6])[0]
+    check("Credits balance across batches", credits == total_ops,
+          f"({credits}/{total_ops})")
+
+    print(f"\n=== All {passed[0]} Pipeline Tests Passed! ===")
+
+
 def run_api_test():
     """Self-contained loopback test for the Open API Primitives (0xA0-0xA7)."""
     device = MockDevice()
@@ -706,5 +887,7 @@ if __name__ == '__main__':
         run_loopback_test()
     elif sys.argv[1] == '--test-api':
         run_api_test()
+    elif sys.argv[1] == '--test-pipeline':
+        run_pipeline_test()
     else:
         run_serial_server(sys.argv[1])